@@ -45,6 +45,7 @@
 #include "mongo/db/catalog/collection_options.h"
 #include "mongo/db/catalog_raii.h"
 #include "mongo/db/client.h"
+#include "mongo/db/collection_crud/capped_collection_maintenance.h"
 #include "mongo/db/collection_crud/collection_write_path.h"
 #include "mongo/db/concurrency/lock_manager_defs.h"
 #include "mongo/db/concurrency/locker.h"
@@ -65,6 +66,7 @@
 #include "mongo/db/storage/recovery_unit.h"
 #include "mongo/db/storage/write_unit_of_work.h"
 #include "mongo/db/transaction_resources.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/framework.h"
 
@@ -98,10 +100,11 @@ protected:
     }
 
 
-    void makeCapped(NamespaceString nss, long long cappedSize = 8192) {
+    void makeCapped(NamespaceString nss, long long cappedSize = 8192, long long cappedMaxDocs = 0) {
         CollectionOptions options;
         options.capped = true;
         options.cappedSize = cappedSize;  // Maximum size of capped collection in bytes.
+        options.cappedMaxDocs = cappedMaxDocs;
         bool createIdIndex = false;
         auto opCtx = newOperationContext();
         ASSERT_OK(storageInterface()->createCollection(opCtx.get(), nss, options, createIdIndex));
@@ -151,6 +154,16 @@ Status insertBSON(OperationContext* opCtx, const NamespaceString& nss, RecordId
     return Status::OK();
 }
 
+long long numRecords(OperationContext* opCtx, const NamespaceString& nss) {
+    AutoGetCollectionForRead acfr(opCtx, nss);
+    return acfr.getCollection()->numRecords(opCtx);
+}
+
+UUID collectionUUID(OperationContext* opCtx, const NamespaceString& nss) {
+    AutoGetCollectionForRead acfr(opCtx, nss);
+    return acfr.getCollection()->uuid();
+}
+
 Status _insertBSON(OperationContext* opCtx, const CollectionPtr& coll, RecordId id) {
     BSONObj obj = BSON("a" << 1);
     auto cappedObserver = coll->getCappedVisibilityObserver();
@@ -570,5 +583,65 @@ TEST_F(CappedCollectionTest, SeekOplogWithReadTimestamp) {
     }
 }
 
+TEST_F(CappedCollectionTest, InsertsDeferDeletesWithinSlack) {
+    RAIIServerParameterControllerForTest slack("cappedDeleteSlackPercent", 50);
+    NamespaceString nss = NamespaceString::createNamespaceString_forTest("local.capped.deferred");
+    makeCapped(nss, 1024 * 1024, 10 /* cappedMaxDocs */);
+
+    auto opCtx = newOperationContext();
+    const auto uuid = collectionUUID(opCtx.get(), nss);
+
+    // Up to 50% over the maximum document count, inserts leave the deletes to the deleter.
+    for (int i = 1; i <= 15; ++i) {
+        ASSERT_OK(insertBSON(opCtx.get(), nss, RecordId(i)));
+    }
+    ASSERT_EQ(numRecords(opCtx.get(), nss), 15);
+
+    auto uuids = collection_internal::waitForDeferredCappedDeletes(opCtx.get(), Date_t::now());
+    ASSERT_EQ(uuids.size(), 1U);
+    ASSERT_EQ(uuids[0], uuid);
+
+    // The deferred deletes are forgotten once returned, unless they are retried.
+    ASSERT(collection_internal::waitForDeferredCappedDeletes(opCtx.get(), Date_t::now()).empty());
+    collection_internal::retryDeferredCappedDeletes(getServiceContext(), uuids);
+    uuids = collection_internal::waitForDeferredCappedDeletes(opCtx.get(), Date_t::now());
+    ASSERT_EQ(uuids.size(), 1U);
+    ASSERT_EQ(uuids[0], uuid);
+
+    // An insert exceeding the slack deletes the excess documents itself.
+    ASSERT_OK(insertBSON(opCtx.get(), nss, RecordId(16)));
+    ASSERT_EQ(numRecords(opCtx.get(), nss), 10);
+}
+
+TEST_F(CappedCollectionTest, DeferredDeleteBatchDeletesOldestDocumentsUpToTheBatchSize) {
+    RAIIServerParameterControllerForTest slack("cappedDeleteSlackPercent", 100);
+    NamespaceString nss = NamespaceString::createNamespaceString_forTest("local.capped.deferred");
+    makeCapped(nss, 1024 * 1024, 10 /* cappedMaxDocs */);
+
+    auto opCtx = newOperationContext();
+    for (int i = 1; i <= 20; ++i) {
+        ASSERT_OK(insertBSON(opCtx.get(), nss, RecordId(i)));
+    }
+    ASSERT_EQ(numRecords(opCtx.get(), nss), 20);
+
+    auto deleteBatch = [&](long long maxDocsToDelete) {
+        AutoGetCollection coll(opCtx.get(), nss, MODE_IX);
+        return collection_internal::cappedDeleteDeferredBatch(
+            opCtx.get(), coll.getCollection(), maxDocsToDelete);
+    };
+
+    ASSERT_EQ(deleteBatch(3), 3);
+    ASSERT_EQ(numRecords(opCtx.get(), nss), 17);
+
+    // A batch stops once the collection is back under its maximum.
+    ASSERT_EQ(deleteBatch(100), 7);
+    ASSERT_EQ(numRecords(opCtx.get(), nss), 10);
+    ASSERT_EQ(deleteBatch(100), 0);
+
+    AutoGetCollectionForRead acfr(opCtx.get(), nss);
+    auto cursor = acfr.getCollection()->getCursor(opCtx.get());
+    ASSERT_EQ(cursor->next()->id, RecordId(11));
+}
+
 }  // namespace
 }  // namespace mongo
@@ -52,7 +52,9 @@ struct ExternalDataSourceMetadata {
                 "File url must start with {}"_format(kUrlProtocolFile),
                 urlStr.startsWith(kUrlProtocolFile));
         uassert(6968501, "Storage type must be 'pipe'", storageType == StorageTypeEnum::pipe);
-        uassert(6968502, "File type must be 'bson'", fileType == FileTypeEnum::bson);
+        uassert(6968502,
+                "File type must be 'bson' or 'bsonColumn'",
+                fileType == FileTypeEnum::bson || fileType == FileTypeEnum::bsonColumn);
     }
 
     ExternalDataSourceMetadata(const ExternalDataSourceInfo& dataSourceInfo)
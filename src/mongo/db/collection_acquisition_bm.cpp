@@ -31,11 +31,21 @@
 #include <fmt/format.h>
 
 #include "mongo/base/init.h"
+#include "mongo/client/connection_string.h"
+#include "mongo/db/catalog/create_collection.h"
+#include "mongo/db/db_raii.h"
 #include "mongo/db/repl/replication_coordinator_mock.h"
+#include "mongo/db/s/collection_metadata.h"
+#include "mongo/db/s/collection_sharding_runtime.h"
+#include "mongo/db/s/operation_sharding_state.h"
 #include "mongo/db/service_context_d_test_fixture.h"
 #include "mongo/db/shard_role.h"
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_domain_global.h"
+#include "mongo/s/catalog/type_chunk.h"
+#include "mongo/s/chunk_manager.h"
+#include "mongo/s/shard_version_factory.h"
+#include "mongo/s/sharding_state.h"
 #include "mongo/stdx/mutex.h"
 #include "mongo/unittest/join_thread.h"
 #include "mongo/unittest/unittest.h"
@@ -58,6 +68,11 @@ MONGO_INITIALIZER_GENERAL(DisableLogging, (), ())
 
 constexpr bool superVerbose = false;
 
+const ShardId kMyShardName("myShardName");
+const NamespaceString kShardedNss = NamespaceString::createNamespaceString_forTest("test.sharded");
+const ChunkVersion kShardedPlacementVersion({OID("5592bee00d21e3aa796e185e"), Timestamp(1, 0)},
+                                            {2, 0});
+
 /**
  * Multithreaded benchmarks are tricky.
  * Several instances will spawn. They synchronize on the state.KeepRunning()
@@ -70,7 +85,11 @@ constexpr bool superVerbose = false;
  */
 class CollectionAcquisitionBenchmark {
 public:
-    explicit CollectionAcquisitionBenchmark(benchmark::State& state) : _state{state} {
+    /**
+     * If 'sharded' is set, this node is set up as a shard, owning every chunk of 'kShardedNss'.
+     */
+    explicit CollectionAcquisitionBenchmark(benchmark::State& state, bool sharded = false)
+        : _state{state}, _sharded{sharded} {
         if constexpr (superVerbose)
             std::cout << "CollectionAcquisitionBenchmark ctor: thread=[{}/{}]\n"_format(
                 _state.thread_index, _state.threads);
@@ -103,11 +122,11 @@ private:
      */
     class TestEnv {
     public:
-        TestEnv() {
+        explicit TestEnv(bool sharded) {
             if constexpr (superVerbose)
                 std::cout << "Creating TestEnv @{}\n"_format((void*)this);
-            _thread = unittest::JoinThread([this] {
-                auto uniqueTest = std::make_unique<Test>();
+            _thread = unittest::JoinThread([this, sharded] {
+                auto uniqueTest = std::make_unique<Test>(sharded);
                 _test = uniqueTest.get();
                 _test->setUp();
                 _running.promise.emplaceValue();
@@ -135,6 +154,8 @@ private:
         /** A `unittest::Test` fixture being overloaded as a benchmark harness. */
         class Test : public ServiceContextMongoDTest {
         public:
+            explicit Test(bool sharded) : _sharded(sharded) {}
+
             void _doTest() override {}
 
             void setUp() override {
@@ -142,9 +163,76 @@ private:
 
                 auto sc = getServiceContext();
                 ReplicationCoordinator::set(sc, std::make_unique<ReplicationCoordinatorMock>(sc));
+
+                if (_sharded) {
+                    _setUpShardedCollection();
+                }
             }
 
             using ServiceContextMongoDTest::tearDown;  // Widen visibility from protected to public
+
+        private:
+            void _setUpShardedCollection() {
+                ShardingState::get(getServiceContext())
+                    ->setRecoveryCompleted({OID::gen(),
+                                            ClusterRole::ShardServer,
+                                            ConnectionString(HostAndPort("configHost", 27019)),
+                                            kMyShardName});
+
+                auto opCtx = makeOperationContext();
+                {
+                    OperationShardingState::ScopedAllowImplicitCollectionCreate_UNSAFE
+                        unsafeCreateCollection(opCtx.get());
+                    uassertStatusOK(createCollection(opCtx.get(),
+                                                     kShardedNss.dbName(),
+                                                     BSON("create" << kShardedNss.coll())));
+                }
+
+                AutoGetCollection coll(opCtx.get(), kShardedNss, MODE_IX);
+                const auto uuid = coll->uuid();
+                const KeyPattern shardKeyPattern(BSON("skey" << 1));
+
+                // Two chunks, so that the ownership filter has more than one range to look at.
+                const auto version = kShardedPlacementVersion;
+                std::vector<ChunkType> chunks{
+                    ChunkType(uuid,
+                              ChunkRange{BSON("skey" << MINKEY), BSON("skey" << 0)},
+                              ChunkVersion(version, {1, 0}),
+                              kMyShardName),
+                    ChunkType(uuid,
+                              ChunkRange{BSON("skey" << 0), BSON("skey" << MAXKEY)},
+                              version,
+                              kMyShardName)};
+
+                auto rt = RoutingTableHistory::makeNew(kShardedNss,
+                                                       uuid,
+                                                       shardKeyPattern,
+                                                       false, /* unsplittable */
+                                                       nullptr,
+                                                       false,
+                                                       version.epoch(),
+                                                       version.getTimestamp(),
+                                                       boost::none /* timeseriesFields */,
+                                                       boost::none /* reshardingFields */,
+                                                       true /* allowMigrations */,
+                                                       chunks);
+                const auto rtHandle = RoutingTableHistoryValueHandle(
+                    std::make_shared<RoutingTableHistory>(std::move(rt)),
+                    ComparableChunkVersion::makeComparableChunkVersion(version));
+
+                CollectionShardingRuntime::assertCollectionLockedAndAcquireExclusive(opCtx.get(),
+                                                                                     kShardedNss)
+                    ->setFilteringMetadata(
+                        opCtx.get(),
+                        CollectionMetadata(ChunkManager(kMyShardName,
+                                                        DatabaseVersion(UUID::gen(),
+                                                                        version.getTimestamp()),
+                                                        rtHandle,
+                                                        boost::none),
+                                           kMyShardName));
+            }
+
+            const bool _sharded;
         };
 
         PromiseAndFuture<void> _running;
@@ -155,11 +243,12 @@ private:
 
     std::shared_ptr<TestEnv> _ensureTestEnv() {
         std::unique_lock lk{_mu};
-        auto sp = _fixtureWeak.lock();
+        auto& fixtureWeak = _fixtureWeak[_sharded];
+        auto sp = fixtureWeak.lock();
         if (!sp) {
             if constexpr (superVerbose)
                 std::cout << "Need to create fixture\n";
-            _fixtureWeak = sp = std::make_shared<TestEnv>();
+            fixtureWeak = sp = std::make_shared<TestEnv>(_sharded);
             if constexpr (superVerbose)
                 std::cout << "Created fixture\n";
         } else {
@@ -175,9 +264,11 @@ private:
     }
 
     static inline stdx::mutex _mu;
-    static inline std::weak_ptr<TestEnv> _fixtureWeak;
+    // Indexed by whether the fixture was set up for sharded acquisitions.
+    static inline std::weak_ptr<TestEnv> _fixtureWeak[2];
 
     benchmark::State& _state;
+    const bool _sharded;
     std::shared_ptr<TestEnv> _fixture;
     boost::optional<ThreadClient> _threadClient;
     ServiceContext::UniqueOperationContext _uniqueOpCtx;
@@ -253,8 +344,55 @@ void BM_acquireMultiCollection(benchmark::State& state) {
     CollectionAcquisitionBenchmark{state}(BM_acquireMultiCollectionFunc);
 }
 
+void BM_acquireShardedCollectionLockFreeFunc(benchmark::State& state,
+                                             CollectionAcquisitionBenchmark& fixture) {
+    auto opCtx = fixture.getOperationContext();
+
+    const auto shardVersion = ShardVersionFactory::make(
+        kShardedPlacementVersion, boost::optional<CollectionIndexes>(boost::none));
+    const auto readConcern = repl::ReadConcernArgs::kLocal;
+    for (auto _ : state) {
+        // Building the request is part of the work required to acquire a collection, so we include
+        // this in the benchmark.
+        CollectionAcquisitionRequest request{kShardedNss,
+                                             PlacementConcern{boost::none, shardVersion},
+                                             readConcern,
+                                             AcquisitionPrerequisites::kRead};
+        auto acquisition = acquireCollectionMaybeLockFree(opCtx, request);
+        benchmark::DoNotOptimize(acquisition);
+    }
+}
+void BM_acquireShardedCollectionLockFree(benchmark::State& state) {
+    CollectionAcquisitionBenchmark{state, true /* sharded */}(
+        BM_acquireShardedCollectionLockFreeFunc);
+}
+
+void BM_acquireShardedCollectionFunc(benchmark::State& state,
+                                     CollectionAcquisitionBenchmark& fixture) {
+    auto opCtx = fixture.getOperationContext();
+
+    const auto shardVersion = ShardVersionFactory::make(
+        kShardedPlacementVersion, boost::optional<CollectionIndexes>(boost::none));
+    const auto readConcern = repl::ReadConcernArgs::kLocal;
+    for (auto _ : state) {
+        // Building the request is part of the work required to acquire a collection, so we include
+        // this in the benchmark.
+        CollectionAcquisitionRequest request{kShardedNss,
+                                             PlacementConcern{boost::none, shardVersion},
+                                             readConcern,
+                                             AcquisitionPrerequisites::kRead};
+        auto acquisition = acquireCollection(opCtx, request, MODE_IS);
+        benchmark::DoNotOptimize(acquisition);
+    }
+}
+void BM_acquireShardedCollection(benchmark::State& state) {
+    CollectionAcquisitionBenchmark{state, true /* sharded */}(BM_acquireShardedCollectionFunc);
+}
+
 BENCHMARK(BM_acquireCollectionLockFree)->ThreadRange(1, 16);
 BENCHMARK(BM_acquireCollection)->ThreadRange(1, 16);
 BENCHMARK(BM_acquireMultiCollection)->ThreadRange(1, 16);
+BENCHMARK(BM_acquireShardedCollectionLockFree)->ThreadRange(1, 16);
+BENCHMARK(BM_acquireShardedCollection)->ThreadRange(1, 16);
 }  // namespace
 }  // namespace mongo::repl
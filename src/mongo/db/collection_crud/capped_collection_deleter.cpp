@@ -0,0 +1,216 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/collection_crud/capped_collection_deleter.h"
+
+#include <string>
+#include <vector>
+
+#include <boost/optional/optional.hpp>
+
+#include "mongo/base/error_codes.h"
+#include "mongo/base/status.h"
+#include "mongo/db/catalog/collection.h"
+#include "mongo/db/catalog/collection_catalog.h"
+#include "mongo/db/client.h"
+#include "mongo/db/collection_crud/capped_collection_maintenance.h"
+#include "mongo/db/commands/server_status_metric.h"
+#include "mongo/db/concurrency/d_concurrency.h"
+#include "mongo/db/concurrency/exception_util.h"
+#include "mongo/db/concurrency/lock_manager_defs.h"
+#include "mongo/db/repl/replication_coordinator.h"
+#include "mongo/db/shard_role.h"
+#include "mongo/logv2/log.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/decorable.h"
+#include "mongo/util/fail_point.h"
+#include "mongo/util/scopeguard.h"
+#include "mongo/util/time_support.h"
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kStorage
+
+
+namespace mongo {
+
+namespace {
+
+const auto getCappedCollectionDeleter =
+    ServiceContext::declareDecoration<CappedCollectionDeleter>();
+
+MONGO_FAIL_POINT_DEFINE(hangCappedCollectionDeleter);
+
+// Upper bound on the documents deleted in a single storage transaction, so that a collection far
+// over its maximum neither holds the capped lock for long nor builds a large transaction.
+constexpr long long kMaxDocsToDeletePerBatch = 1000;
+
+// How long the thread waits for deferred deletes before checking for interrupts again.
+constexpr Milliseconds kWaitForDeferredDeletesPeriod{100};
+
+auto& cappedDeleterCollectionPasses =
+    *MetricBuilder<Counter64>{"cappedCollectionDeleter.collectionPasses"};
+auto& cappedDeleterDeletedDocuments =
+    *MetricBuilder<Counter64>{"cappedCollectionDeleter.deletedDocuments"};
+
+}  // namespace
+
+CappedCollectionDeleter* CappedCollectionDeleter::get(ServiceContext* serviceCtx) {
+    return &getCappedCollectionDeleter(serviceCtx);
+}
+
+bool CappedCollectionDeleter::_deleteExcessDocuments(OperationContext* opCtx, const UUID& uuid) {
+    const auto nss = CollectionCatalog::get(opCtx)->lookupNSSByUUID(opCtx, uuid);
+    if (!nss) {
+        return true;
+    }
+
+    ON_BLOCK_EXIT([&] { cappedDeleterCollectionPasses.increment(); });
+
+    bool canAcceptWrites = true;
+    bool moreToDelete = true;
+    while (moreToDelete) {
+        moreToDelete = writeConflictRetry(opCtx, "cappedCollectionDeleter", *nss, [&] {
+            const auto acquisition = acquireCollection(
+                opCtx,
+                CollectionAcquisitionRequest::fromOpCtx(
+                    opCtx, *nss, AcquisitionPrerequisites::kWrite),
+                MODE_IX);
+            if (!acquisition.exists() || acquisition.uuid() != uuid) {
+                return false;
+            }
+
+            // Only the primary deletes capped documents, secondaries apply its delete oplog
+            // entries. The deletes are retried in case this node becomes primary again, as no
+            // other node knows that they were deferred.
+            canAcceptWrites =
+                repl::ReplicationCoordinator::get(opCtx)->canAcceptWritesFor(opCtx, *nss);
+            if (!canAcceptWrites) {
+                return false;
+            }
+
+            const auto& collection = acquisition.getCollectionPtr();
+            boost::optional<Lock::ResourceLock> cappedLock;
+            if (collection->needsCappedLock()) {
+                cappedLock.emplace(opCtx, ResourceId(RESOURCE_METADATA, *nss), MODE_X);
+            }
+
+            const auto docsDeleted = collection_internal::cappedDeleteDeferredBatch(
+                opCtx, collection, kMaxDocsToDeletePerBatch);
+            cappedDeleterDeletedDocuments.increment(docsDeleted);
+            return docsDeleted == kMaxDocsToDeletePerBatch;
+        });
+    }
+    return canAcceptWrites;
+}
+
+void CappedCollectionDeleter::start() {
+    massert(9886400, "CappedCollectionDeleter already started", !_thread.joinable());
+    _thread = stdx::thread(&CappedCollectionDeleter::_run, this);
+}
+
+void CappedCollectionDeleter::_run() {
+    const std::string name = "CappedCollectionDeleter";
+    setThreadName(name);
+
+    LOGV2_DEBUG(9886401, 1, "Capped collection deleter thread started");
+    ThreadClient tc(name, getGlobalServiceContext()->getService(ClusterRole::ShardServer));
+
+    {
+        stdx::lock_guard<Client> lk(*tc.get());
+        tc.get()->setSystemOperationUnkillableByStepdown(lk);
+    }
+
+    ServiceContext::UniqueOperationContext opCtx;
+    while (true) {
+        // Reset the opCtx between passes for the same reasons as the oplog cap maintainer thread:
+        // holding one while idle could block storage engine changes.
+        ON_BLOCK_EXIT([&] { opCtx.reset(); });
+        try {
+            opCtx = tc->makeOperationContext();
+
+            if (MONGO_unlikely(hangCappedCollectionDeleter.shouldFail())) {
+                LOGV2(9886402, "Hanging the capped collection deleter thread due to fail point");
+                hangCappedCollectionDeleter.pauseWhileSet(opCtx.get());
+            }
+
+            const auto uuids = collection_internal::waitForDeferredCappedDeletes(
+                opCtx.get(), Date_t::now() + kWaitForDeferredDeletesPeriod);
+
+            std::vector<UUID> uuidsToRetry;
+            for (const auto& uuid : uuids) {
+                try {
+                    if (!_deleteExcessDocuments(opCtx.get(), uuid)) {
+                        uuidsToRetry.push_back(uuid);
+                    }
+                } catch (const ExceptionForCat<ErrorCategory::ShutdownError>&) {
+                    throw;
+                } catch (const DBException& e) {
+                    LOGV2_DEBUG(9886407,
+                                1,
+                                "Failed to delete the excess documents of a capped collection, "
+                                "will retry",
+                                "uuid"_attr = uuid,
+                                "error"_attr = e);
+                    uuidsToRetry.push_back(uuid);
+                }
+            }
+
+            if (!uuidsToRetry.empty()) {
+                // Back off before retrying, as the deletes are likely to fail again right away.
+                collection_internal::retryDeferredCappedDeletes(opCtx->getServiceContext(),
+                                                                uuidsToRetry);
+                opCtx->sleepFor(kWaitForDeferredDeletesPeriod);
+            }
+        } catch (const ExceptionForCat<ErrorCategory::ShutdownError>& e) {
+            LOGV2_DEBUG(9886403,
+                        1,
+                        "Interrupted due to shutdown. CappedCollectionDeleter exiting",
+                        "error"_attr = e);
+            return;
+        } catch (const DBException& e) {
+            // Failures while deleting are retried above, so this is only reached when waiting for
+            // deferred deletes is interrupted, which loses none.
+            LOGV2_DEBUG(9886404,
+                        1,
+                        "Capped collection deleter thread was interrupted, but can safely continue",
+                        "error"_attr = e);
+        }
+    }
+
+    MONGO_UNREACHABLE;
+}
+
+void CappedCollectionDeleter::shutdown() {
+    if (_thread.joinable()) {
+        LOGV2_INFO(9886405, "Shutting down capped collection deleter thread");
+        _thread.join();
+        LOGV2(9886406, "Finished shutting down capped collection deleter thread");
+    }
+}
+
+}  // namespace mongo
@@ -0,0 +1,70 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include "mongo/db/operation_context.h"
+#include "mongo/db/service_context.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/util/uuid.h"
+
+namespace mongo {
+
+/**
+ * Responsible for deleting the excess documents of capped collections, other than the oplog, whose
+ * deletes were deferred by inserts. See 'cappedDeleteSlackPercent'.
+ */
+class CappedCollectionDeleter {
+public:
+    static CappedCollectionDeleter* get(ServiceContext* serviceCtx);
+
+    /**
+     * Create the deleter thread. Must be called at most once.
+     */
+    void start();
+
+    /**
+     * Waits until the deleter thread finishes. Must not be called concurrently with start().
+     */
+    void shutdown();
+
+private:
+    void _run();
+
+    /**
+     * Deletes the excess documents of the capped collection with the given UUID in batches, as long
+     * as it still exists and this node can accept writes for it. Returns false if the deletes must
+     * be retried later because this node cannot accept writes for the collection.
+     */
+    bool _deleteExcessDocuments(OperationContext* opCtx, const UUID& uuid);
+
+    stdx::thread _thread;
+};
+
+}  // namespace mongo
@@ -54,9 +54,12 @@
 #include "mongo/db/storage/record_store.h"
 #include "mongo/db/storage/recovery_unit.h"
 #include "mongo/db/storage/storage_engine.h"
+#include "mongo/db/storage/storage_parameters_gen.h"
 #include "mongo/db/storage/write_unit_of_work.h"
 #include "mongo/db/transaction_resources.h"
+#include "mongo/stdx/condition_variable.h"
 #include "mongo/stdx/mutex.h"
+#include "mongo/stdx/unordered_set.h"
 #include "mongo/util/assert_util_core.h"
 #include "mongo/util/decorable.h"
 
@@ -109,6 +112,15 @@ struct CappedCollectionState {
 const auto cappedCollectionState =
     SharedCollectionDecorations::declareDecoration<CappedCollectionState>();
 
+// Capped collections whose deletes were deferred by inserts to the background deleter.
+struct DeferredCappedDeletes {
+    stdx::mutex mutex;
+    stdx::condition_variable cv;
+    stdx::unordered_set<UUID, UUID::Hash> pending;
+};
+
+const auto deferredCappedDeletes = ServiceContext::declareDecoration<DeferredCappedDeletes>();
+
 }  // namespace
 
 
@@ -132,19 +144,18 @@ bool shouldDeferCappedDeletesToOplogApplication(OperationContext* opCtx,
     return false;
 }
 
-void cappedDeleteUntilBelowConfiguredMaximum(OperationContext* opCtx,
-                                             const CollectionPtr& collection,
-                                             const RecordId& justInserted,
-                                             OpDebug* opDebug) {
-    if (!collection->isCappedAndNeedsDelete(opCtx))
-        return;
-
-    if (shouldDeferCappedDeletesToOplogApplication(opCtx, collection)) {
-        // The primary has already executed the following logic and generated the necessary delete
-        // oplogs. We will apply them later.
-        return;
-    }
+namespace {
 
+/**
+ * Deletes the oldest documents of the capped collection until it is back under its configured
+ * maximum, never deleting 'justInserted' and deleting at most 'maxDocsToDelete' documents if
+ * specified. Returns the number of documents deleted.
+ */
+long long deleteUntilBelowConfiguredMaximum(OperationContext* opCtx,
+                                            const CollectionPtr& collection,
+                                            const RecordId& justInserted,
+                                            OpDebug* opDebug,
+                                            boost::optional<long long> maxDocsToDelete) {
     const auto& nss = collection->ns();
     auto& ccs = cappedCollectionState(*collection->getSharedDecorations());
 
@@ -210,6 +221,10 @@ void cappedDeleteUntilBelowConfiguredMaximum(OperationContext* opCtx,
             break;
         }
 
+        if (maxDocsToDelete && docsRemoved >= *maxDocsToDelete) {
+            break;
+        }
+
         if (record->id == justInserted) {
             // We're prohibited from deleting what was just inserted.
             break;
@@ -264,17 +279,95 @@ void cappedDeleteUntilBelowConfiguredMaximum(OperationContext* opCtx,
             ccs.cappedFirstRecord = std::move(record->id);
         }
     } else {
-        // Update the next record to be deleted. The next record must exist as we're using the same
-        // snapshot the insert was performed on and we can't delete newly inserted records.
-        invariant(record);
+        // Update the next record to be deleted. When deleting on behalf of an insert, the next
+        // record must exist as we're using the same snapshot the insert was performed on and we
+        // can't delete newly inserted records.
+        invariant(record || justInserted.isNull());
         shard_role_details::getRecoveryUnit(opCtx)->onCommit(
-            [&ccs, recordId = std::move(record->id)](OperationContext*,
-                                                     boost::optional<Timestamp>) {
+            [&ccs, recordId = record ? std::move(record->id) : RecordId()](
+                OperationContext*, boost::optional<Timestamp>) {
                 ccs.cappedFirstRecord = std::move(recordId);
             });
     }
 
     wuow.commit();
+    return docsRemoved;
+}
+
+// Returns whether the collection exceeds its configured maximum by more than 'slackPercent'.
+bool exceedsConfiguredMaximumWithSlack(OperationContext* opCtx,
+                                       const CollectionPtr& collection,
+                                       int slackPercent) {
+    const auto exceeds = [&](long long value, long long maximum) {
+        return value > maximum + maximum * slackPercent / 100;
+    };
+
+    const auto& options = collection->getCollectionOptions();
+    if (exceeds(collection->dataSize(opCtx), options.cappedSize))
+        return true;
+    return options.cappedMaxDocs != 0 &&
+        exceeds(collection->numRecords(opCtx), options.cappedMaxDocs);
+}
+
+}  // namespace
+
+
+void cappedDeleteUntilBelowConfiguredMaximum(OperationContext* opCtx,
+                                             const CollectionPtr& collection,
+                                             const RecordId& justInserted,
+                                             OpDebug* opDebug) {
+    if (!collection->isCappedAndNeedsDelete(opCtx))
+        return;
+
+    if (shouldDeferCappedDeletesToOplogApplication(opCtx, collection)) {
+        // The primary has already executed the following logic and generated the necessary delete
+        // oplogs. We will apply them later.
+        return;
+    }
+
+    const auto slackPercent = gCappedDeleteSlackPercent.load();
+    if (slackPercent > 0 && !collection->ns().isOplog() &&
+        !exceedsConfiguredMaximumWithSlack(opCtx, collection, slackPercent)) {
+        // Leave the deletes to the background deleter, so that they neither add to the latency of
+        // this insert nor serialize it with concurrent inserts any longer than necessary.
+        auto& deferred = deferredCappedDeletes(opCtx->getServiceContext());
+        stdx::lock_guard<stdx::mutex> lk(deferred.mutex);
+        if (deferred.pending.insert(collection->uuid()).second)
+            deferred.cv.notify_one();
+        return;
+    }
+
+    deleteUntilBelowConfiguredMaximum(opCtx, collection, justInserted, opDebug, boost::none);
+}
+
+long long cappedDeleteDeferredBatch(OperationContext* opCtx,
+                                    const CollectionPtr& collection,
+                                    long long maxDocsToDelete) {
+    if (!collection->isCappedAndNeedsDelete(opCtx))
+        return 0;
+
+    if (shouldDeferCappedDeletesToOplogApplication(opCtx, collection))
+        return 0;
+
+    return deleteUntilBelowConfiguredMaximum(
+        opCtx, collection, RecordId(), /*opDebug=*/nullptr, maxDocsToDelete);
+}
+
+std::vector<UUID> waitForDeferredCappedDeletes(OperationContext* opCtx, Date_t deadline) {
+    auto& deferred = deferredCappedDeletes(opCtx->getServiceContext());
+    stdx::unique_lock<stdx::mutex> lk(deferred.mutex);
+    opCtx->waitForConditionOrInterruptUntil(
+        deferred.cv, lk, deadline, [&] { return !deferred.pending.empty(); });
+
+    std::vector<UUID> uuids(deferred.pending.begin(), deferred.pending.end());
+    deferred.pending.clear();
+    return uuids;
+}
+
+void retryDeferredCappedDeletes(ServiceContext* serviceContext, const std::vector<UUID>& uuids) {
+    auto& deferred = deferredCappedDeletes(serviceContext);
+    stdx::lock_guard<stdx::mutex> lk(deferred.mutex);
+    deferred.pending.insert(uuids.begin(), uuids.end());
 }
 
 void cappedTruncateAfter(OperationContext* opCtx,
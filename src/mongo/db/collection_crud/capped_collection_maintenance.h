@@ -29,9 +29,13 @@
 
 #pragma once
 
+#include <vector>
+
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/record_id.h"
+#include "mongo/util/time_support.h"
+#include "mongo/util/uuid.h"
 
 namespace mongo {
 namespace collection_internal {
@@ -45,12 +49,37 @@ bool shouldDeferCappedDeletesToOplogApplication(OperationContext* opCtx,
  * in order to bring it back to under that confuguration.
  *
  * Generates oplog entries for the deleted records in FCV >= 5.0.
+ *
+ * When 'cappedDeleteSlackPercent' is set and the collection is not the oplog, collections that are
+ * over their maximum by no more than the slack are instead handed to the background capped
+ * collection deleter, and the deletes are left to it.
  */
 void cappedDeleteUntilBelowConfiguredMaximum(OperationContext* opCtx,
                                              const CollectionPtr& collection,
                                              const RecordId& justInserted,
                                              OpDebug* opDebug);
 
+/**
+ * Deletes at most 'maxDocsToDelete' of the oldest documents of a capped collection whose deletes
+ * were deferred, stopping early once it is back under its configured maximum. The caller must
+ * hold the locks an insert into the collection would. Returns the number of documents deleted.
+ */
+long long cappedDeleteDeferredBatch(OperationContext* opCtx,
+                                    const CollectionPtr& collection,
+                                    long long maxDocsToDelete);
+
+/**
+ * Waits until 'deadline' for capped collections to have their deletes deferred, then returns and
+ * forgets the UUIDs of all of them. Throws if 'opCtx' is interrupted while waiting.
+ */
+std::vector<UUID> waitForDeferredCappedDeletes(OperationContext* opCtx, Date_t deadline);
+
+/**
+ * Records again the deferred deletes of the given capped collections, which the background deleter
+ * could not perform, so that they are returned by the next waitForDeferredCappedDeletes().
+ */
+void retryDeferredCappedDeletes(ServiceContext* serviceContext, const std::vector<UUID>& uuids);
+
 /**
  * This function starts its own WUOW to truncate documents newer than the document at 'end' from the
  * capped collection.
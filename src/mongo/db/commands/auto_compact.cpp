@@ -30,25 +30,243 @@
 
 #include <boost/cstdint.hpp>
 #include <boost/optional/optional.hpp>
+#include <string>
+#include <vector>
 
 #include "mongo/base/error_codes.h"
 #include "mongo/base/status.h"
+#include "mongo/db/admission/ticketholder_manager.h"
 #include "mongo/db/auth/authorization_session.h"
 #include "mongo/db/catalog/collection_catalog.h"
+#include "mongo/db/client.h"
 #include "mongo/db/commands.h"
 #include "mongo/db/commands/auto_compact.h"
+#include "mongo/db/commands/auto_compact_throttle.h"
 #include "mongo/db/commands/compact_gen.h"
+#include "mongo/db/commands/server_status.h"
 #include "mongo/db/concurrency/d_concurrency.h"
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/server_feature_flags_gen.h"
+#include "mongo/db/storage/compact_options.h"
+#include "mongo/db/storage/storage_parameters_gen.h"
 #include "mongo/db/transaction_resources.h"
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/util/concurrency/with_lock.h"
+#include "mongo/util/periodic_runner.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kCommand
 
 namespace mongo {
+namespace {
+
+/**
+ * Remembers the configuration auto compaction was last enabled with, and periodically pauses and
+ * resumes it based on the foreground load observed by AutoCompactThrottle. Compaction that runs
+ * once is never throttled, as resuming it would start a new pass over all files.
+ */
+class AutoCompactController {
+public:
+    static AutoCompactController& get(ServiceContext* svcCtx);
+
+    /**
+     * Enables or disables auto compaction in the storage engine. The caller must hold the global
+     * lock.
+     */
+    Status configure(OperationContext* opCtx, const AutoCompactOptions& options);
+
+    void appendStats(BSONObjBuilder& builder) const;
+
+private:
+    void _run(Client* client);
+
+    /**
+     * Pauses or resumes auto compaction with the remembered configuration.
+     */
+    Status _toggle(WithLock, OperationContext* opCtx, bool enable);
+
+    /**
+     * Records that the throttle paused or resumed compaction.
+     */
+    void _setPaused(WithLock, bool paused);
+
+    mutable stdx::mutex _mutex;
+
+    // Configuration compaction was last enabled with, or none if it is disabled. The excluded
+    // idents of '_options' refer to '_excludedIdents'.
+    boost::optional<AutoCompactOptions> _options;
+    std::vector<std::string> _excludedIdents;
+
+    AutoCompactThrottle _throttle;
+    Date_t _pausedAt;
+    int64_t _timesPaused = 0;
+    int64_t _timesResumed = 0;
+    Milliseconds _totalTimePaused{0};
+
+    PeriodicJobAnchor _job;
+};
+
+const auto getAutoCompactController = ServiceContext::declareDecoration<AutoCompactController>();
+
+AutoCompactController& AutoCompactController::get(ServiceContext* svcCtx) {
+    return getAutoCompactController(svcCtx);
+}
+
+Status AutoCompactController::configure(OperationContext* opCtx,
+                                        const AutoCompactOptions& options) {
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+
+    auto* storageEngine = opCtx->getServiceContext()->getStorageEngine();
+    auto status =
+        storageEngine->autoCompact(*shard_role_details::getRecoveryUnit(opCtx), options);
+    if (!status.isOK())
+        return status;
+
+    // Reconfiguring ends a pause without the throttle having resumed compaction, so the pause is
+    // accounted for but not counted as a resume.
+    if (_throttle.isPaused()) {
+        _totalTimePaused += Date_t::now() - _pausedAt;
+        _throttle.setPaused(false);
+    }
+
+    if (!options.enable) {
+        _options.reset();
+        _excludedIdents.clear();
+        return status;
+    }
+
+    _excludedIdents.assign(options.excludedIdents.begin(), options.excludedIdents.end());
+    _options = options;
+    _options->excludedIdents.assign(_excludedIdents.begin(), _excludedIdents.end());
+
+    if (!_job) {
+        _job = opCtx->getServiceContext()->getPeriodicRunner()->makeJob(
+            PeriodicRunner::PeriodicJob{"AutoCompactThrottle",
+                                        [this](Client* client) { _run(client); },
+                                        Seconds(1),
+                                        false /*isKillableByStepdown*/});
+        _job.start();
+    }
+    return status;
+}
+
+void AutoCompactController::appendStats(BSONObjBuilder& builder) const {
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    builder.append("enabled", _options.has_value());
+    if (_options) {
+        builder.append("runOnce", _options->runOnce);
+        if (_options->freeSpaceTargetMB)
+            builder.append("freeSpaceTargetMB", *_options->freeSpaceTargetMB);
+        builder.append("timeSliceSecs", _options->timeSliceSecs.value_or(0));
+    }
+
+    auto totalTimePaused = _totalTimePaused;
+    if (_throttle.isPaused())
+        totalTimePaused += Date_t::now() - _pausedAt;
+
+    BSONObjBuilder throttleBuilder(builder.subobjStart("throttle"));
+    throttleBuilder.append("paused", _throttle.isPaused());
+    throttleBuilder.append("timesPaused", _timesPaused);
+    throttleBuilder.append("timesResumed", _timesResumed);
+    throttleBuilder.append("totalTimePausedMillis", durationCount<Milliseconds>(totalTimePaused));
+}
+
+void AutoCompactController::_run(Client* client) try {
+    auto* svcCtx = client->getServiceContext();
+    auto* ticketHolderManager = admission::TicketHolderManager::get(svcCtx);
+    if (!ticketHolderManager)
+        return;
+
+    {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        if (!_options || _options->runOnce)
+            return;
+    }
+
+    auto queued = ticketHolderManager->getTicketHolder(MODE_IS)->queued() +
+        ticketHolderManager->getTicketHolder(MODE_IX)->queued();
+
+    auto opCtx = client->makeOperationContext();
+
+    // Lock ordering matches configure(), which is called with the global lock held.
+    Lock::GlobalLock globalLock{
+        opCtx.get(),
+        MODE_IS,
+        Date_t::max(),
+        Lock::InterruptBehavior::kThrow,
+        Lock::GlobalLockSkipOptions{.skipFlowControlTicket = true, .skipRSTLLock = true}};
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    if (!_options || _options->runOnce)
+        return;
+
+    auto action = _throttle.sample(queued,
+                                   gAutoCompactThrottleQueuedOperations.load(),
+                                   gAutoCompactThrottleQuietSamplesToResume.load());
+    if (action == AutoCompactThrottle::Action::kNone)
+        return;
+
+    const bool resume = action == AutoCompactThrottle::Action::kResume;
+    auto status = _toggle(lk, opCtx.get(), resume);
+    if (!status.isOK()) {
+        // The storage engine may still be processing a previous request, try again on the next
+        // sample.
+        LOGV2_DEBUG(9886300,
+                    1,
+                    "Failed to throttle auto compaction",
+                    "resume"_attr = resume,
+                    "error"_attr = status);
+        return;
+    }
+
+    _setPaused(lk, !resume);
+    LOGV2_DEBUG(9886301,
+                1,
+                resume ? "Resumed auto compaction" : "Paused auto compaction",
+                "queuedOperations"_attr = queued);
+} catch (const DBException& ex) {
+    LOGV2(9886302, "Caught exception while throttling auto compaction", "error"_attr = ex);
+}
+
+Status AutoCompactController::_toggle(WithLock, OperationContext* opCtx, bool enable) {
+    auto options = *_options;
+    options.enable = enable;
+    return opCtx->getServiceContext()->getStorageEngine()->autoCompact(
+        *shard_role_details::getRecoveryUnit(opCtx), options);
+}
+
+void AutoCompactController::_setPaused(WithLock, bool paused) {
+    if (paused) {
+        ++_timesPaused;
+        _pausedAt = Date_t::now();
+    } else {
+        ++_timesResumed;
+        _totalTimePaused += Date_t::now() - _pausedAt;
+    }
+    _throttle.setPaused(paused);
+}
+
+class AutoCompactServerStatusSection : public ServerStatusSection {
+public:
+    using ServerStatusSection::ServerStatusSection;
+
+    bool includeByDefault() const override {
+        return true;
+    }
+
+    BSONObj generateSection(OperationContext* opCtx,
+                            const BSONElement& configElement) const override {
+        BSONObjBuilder builder;
+        AutoCompactController::get(opCtx->getServiceContext()).appendStats(builder);
+        return builder.obj();
+    }
+};
+
+auto& autoCompactSection =
+    *ServerStatusSectionBuilder<AutoCompactServerStatusSection>("autoCompact").forShard();
+
+}  // namespace
 
 class AutoCompactCmd final : public TypedCommand<AutoCompactCmd> {
 public:
@@ -62,7 +280,8 @@ public:
             uassertStatusOK(autoCompact(opCtx,
                                         request().getCommandParameter(),
                                         request().getRunOnce(),
-                                        request().getFreeSpaceTargetMB()));
+                                        request().getFreeSpaceTargetMB(),
+                                        request().getTimeSliceSecs()));
         }
 
     private:
@@ -97,10 +316,13 @@ public:
                "warning: compact operation has blocking behaviour and is slow, enabling auto "
                "compact will allow compact to run on any collection at any time. You can cancel "
                "by disabling auto compact.\n"
-               "{ autoCompact : <bool>, [freeSpaceTargetMB:<int64_t>], [runOnce:<bool>] }\n"
+               "{ autoCompact : <bool>, [freeSpaceTargetMB:<int64_t>], [runOnce:<bool>], "
+               "[timeSliceSecs:<int64_t>] }\n"
                "  freeSpaceTargetMB - minimum amount of space recoverable for compaction to "
                "proceed\n"
-               "  runOnce - executes compaction on the database only once\n";
+               "  runOnce - executes compaction on the database only once\n"
+               "  timeSliceSecs - maximum time spent compacting a single file before moving on "
+               "to the next one\n";
     }
 };
 
@@ -109,14 +331,13 @@ MONGO_REGISTER_COMMAND(AutoCompactCmd).forShard();
 Status autoCompact(OperationContext* opCtx,
                    bool enable,
                    bool runOnce,
-                   boost::optional<int64_t> freeSpaceTargetMB) {
+                   boost::optional<int64_t> freeSpaceTargetMB,
+                   boost::optional<int64_t> timeSliceSecs) {
     if (!opCtx->getServiceContext()->userWritesAllowed()) {
         return Status(ErrorCodes::IllegalOperation,
                       "autoCompact can only be executed when writes are allowed");
     }
 
-    auto* storageEngine = opCtx->getServiceContext()->getStorageEngine();
-
     // Holding the global lock to prevent racing with storage shutdown. However, no need to hold the
     // RSTL nor acquire a flow control ticket. This doesn't care about the replica state of the node
     // and the operation is not replicated.
@@ -150,10 +371,13 @@ Status autoCompact(OperationContext* opCtx,
             excludedIdents.push_back(collection->getSharedIdent()->getIdent());
     }
 
-    AutoCompactOptions options{enable, runOnce, freeSpaceTargetMB, std::move(excludedIdents)};
+    if (!timeSliceSecs)
+        timeSliceSecs = gAutoCompactTimeSliceSecs.load();
+    AutoCompactOptions options{
+        enable, runOnce, freeSpaceTargetMB, timeSliceSecs, std::move(excludedIdents)};
 
     Status status =
-        storageEngine->autoCompact(*shard_role_details::getRecoveryUnit(opCtx), options);
+        AutoCompactController::get(opCtx->getServiceContext()).configure(opCtx, options);
     if (!status.isOK())
         return status;
     LOGV2(8012100, "AutoCompact", "enabled"_attr = enable);
@@ -44,6 +44,7 @@ namespace mongo {
 Status autoCompact(OperationContext* opCtx,
                    bool enable,
                    bool runOnce,
-                   boost::optional<int64_t> freeSpaceTargetMB);
+                   boost::optional<int64_t> freeSpaceTargetMB,
+                   boost::optional<int64_t> timeSliceSecs = boost::none);
 
 }  // namespace mongo
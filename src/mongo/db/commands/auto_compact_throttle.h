@@ -0,0 +1,84 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace mongo {
+
+/**
+ * Decides when auto compaction should yield to foreground work, based on periodic samples of the
+ * number of operations queued for execution. Compaction is paused as soon as a sample exceeds the
+ * threshold, and resumed once a number of consecutive samples have stayed at or below it.
+ *
+ * The throttle only recommends actions; callers report the outcome through setPaused() once an
+ * action has been applied, so that failed attempts are retried on the next sample.
+ */
+class AutoCompactThrottle {
+public:
+    enum class Action {
+        kNone,
+        kPause,
+        kResume,
+    };
+
+    /**
+     * Returns the action to take given the latest sample. A non-positive 'threshold' disables
+     * throttling, resuming compaction if it was paused.
+     */
+    Action sample(int64_t queuedOperations, int64_t threshold, int quietSamplesToResume) {
+        if (threshold <= 0)
+            return _paused ? Action::kResume : Action::kNone;
+
+        if (queuedOperations > threshold) {
+            _quietSamples = 0;
+            return _paused ? Action::kNone : Action::kPause;
+        }
+
+        if (!_paused)
+            return Action::kNone;
+        return ++_quietSamples >= quietSamplesToResume ? Action::kResume : Action::kNone;
+    }
+
+    void setPaused(bool paused) {
+        _paused = paused;
+        _quietSamples = 0;
+    }
+
+    bool isPaused() const {
+        return _paused;
+    }
+
+private:
+    bool _paused = false;
+    int _quietSamples = 0;
+};
+
+}  // namespace mongo
@@ -0,0 +1,189 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <boost/filesystem/path.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "mongo/base/error_codes.h"
+#include "mongo/base/status.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/auth/action_set.h"
+#include "mongo/db/auth/action_type.h"
+#include "mongo/db/auth/authorization_session.h"
+#include "mongo/db/auth/resource_pattern.h"
+#include "mongo/db/commands.h"
+#include "mongo/db/commands/copy_backup_blocks_gen.h"
+#include "mongo/db/database_name.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/storage/backup_block.h"
+#include "mongo/db/storage/backup_block_copier.h"
+#include "mongo/db/storage/storage_engine.h"
+#include "mongo/db/storage/storage_options.h"
+#include "mongo/idl/idl_parser.h"
+#include "mongo/logv2/log.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/scopeguard.h"
+#include "mongo/util/timer.h"
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kStorage
+
+
+namespace mongo {
+namespace {
+
+// Number of blocks requested from the backup cursor at a time. Each batch is copied before the
+// next one is requested.
+constexpr std::size_t kBackupBlocksBatchSize = 1000;
+
+class CmdCopyBackupBlocks : public BasicCommand {
+public:
+    CmdCopyBackupBlocks() : BasicCommand("copyBackupBlocks") {}
+
+    AllowedOnSecondary secondaryAllowed(ServiceContext*) const override {
+        return AllowedOnSecondary::kAlways;
+    }
+
+    bool adminOnly() const final {
+        return true;
+    }
+
+    bool supportsWriteConcern(const BSONObj& cmd) const override {
+        return false;
+    }
+
+    std::string help() const override {
+        return "Opens a backup cursor and copies the files, or for an incremental backup the "
+               "changed blocks, it returns into a local directory";
+    }
+
+    Status checkAuthForOperation(OperationContext* opCtx,
+                                 const DatabaseName& dbName,
+                                 const BSONObj&) const final {
+        // Besides reading every data file, the command writes to the host's file system, so it
+        // requires the privileges of both the backup and the hostManager roles.
+        AuthorizationSession* authzSession = AuthorizationSession::get(opCtx->getClient());
+        if (authzSession->isAuthorizedForActionsOnResource(
+                ResourcePattern::forClusterResource(dbName.tenantId()),
+                ActionSet{ActionType::copyBackupBlocks, ActionType::fsync})) {
+            return Status::OK();
+        }
+        return Status(ErrorCodes::Unauthorized, "Unauthorized");
+    }
+
+    bool run(OperationContext* opCtx,
+             const DatabaseName&,
+             const BSONObj& jsobj,
+             BSONObjBuilder& result) override {
+        auto params =
+            CopyBackupBlocksRequest::parse(IDLParserContext("copyBackupBlocks"), jsobj);
+
+        uassert(ErrorCodes::InvalidOptions,
+                "The backup destination must not be empty",
+                !params.getCommandParameter().empty());
+        uassert(ErrorCodes::InvalidOptions,
+                "'thisBackupName' is required for an incremental backup",
+                !params.getIncrementalBackup() || params.getThisBackupName());
+        uassert(ErrorCodes::InvalidOptions,
+                "'thisBackupName' and 'srcBackupName' are only allowed for an incremental backup",
+                params.getIncrementalBackup() ||
+                    (!params.getThisBackupName() && !params.getSrcBackupName()));
+
+        StorageEngine::BackupOptions backupOptions;
+        backupOptions.incrementalBackup = params.getIncrementalBackup();
+        backupOptions.blockSizeMB = params.getBlockSizeMB();
+        if (auto thisBackupName = params.getThisBackupName())
+            backupOptions.thisBackupName = thisBackupName->toString();
+        if (auto srcBackupName = params.getSrcBackupName())
+            backupOptions.srcBackupName = srcBackupName->toString();
+
+        BackupBlockCopier::Options copierOptions;
+        copierOptions.sourceRoot = storageGlobalParams.dbpath;
+        copierOptions.destinationRoot =
+            uassertStatusOK(BackupBlockCopier::resolveDestinationRoot(
+                params.getCommandParameter().toString(), storageGlobalParams.dbpath));
+        copierOptions.numThreads = params.getNumThreads();
+        copierOptions.verifyChecksums = params.getVerifyChecksums();
+        copierOptions.incrementalSinceBasis =
+            backupOptions.incrementalBackup && backupOptions.srcBackupName.has_value();
+        const BackupBlockCopier copier(copierOptions);
+
+        auto storageEngine = opCtx->getServiceContext()->getStorageEngine();
+        auto cursor = uassertStatusOK(storageEngine->beginNonBlockingBackup(backupOptions));
+        ON_BLOCK_EXIT([&] { storageEngine->endNonBlockingBackup(); });
+
+        // Blocks are copied as the backup cursor returns them, so that copying the first files
+        // overlaps with WiredTiger computing the changed blocks of the later ones.
+        Timer timer;
+        BackupBlockCopier::Stats total;
+        while (true) {
+            opCtx->checkForInterrupt();
+
+            auto batch = uassertStatusOK(cursor->getNextBatch(kBackupBlocksBatchSize));
+            if (batch.empty())
+                break;
+
+            auto stats = copier.copy(std::vector<BackupBlock>(batch.begin(), batch.end()),
+                                     opCtx->getCancellationToken());
+            if (stats.getStatus() == ErrorCodes::CallbackCanceled) {
+                // Report the reason the operation was interrupted.
+                opCtx->checkForInterrupt();
+            }
+            uassertStatusOK(stats);
+            total.blocksCopied += stats.getValue().blocksCopied;
+            total.bytesCopied += stats.getValue().bytesCopied;
+        }
+        total.elapsed = timer.elapsed();
+
+        LOGV2(9886609,
+              "Copied backup",
+              "destination"_attr = copierOptions.destinationRoot.string(),
+              "incrementalBackup"_attr = backupOptions.incrementalBackup,
+              "numBlocks"_attr = total.blocksCopied,
+              "bytesCopied"_attr = total.bytesCopied,
+              "duration"_attr = total.elapsed,
+              "bytesPerSecond"_attr = static_cast<long long>(total.bytesPerSecond()));
+
+        result.append("blocksCopied", static_cast<long long>(total.blocksCopied));
+        result.append("bytesCopied", static_cast<long long>(total.bytesCopied));
+        result.append("elapsedMillis", durationCount<Milliseconds>(total.elapsed));
+        result.append("bytesPerSecond", total.bytesPerSecond());
+        return true;
+    }
+};
+MONGO_REGISTER_COMMAND(CmdCopyBackupBlocks).forShard();
+
+}  // namespace
+}  // namespace mongo
@@ -228,6 +228,11 @@ std::unique_ptr<SeekableRecordCursor> initCursorAndAssertTsHasNotFallenOff(
 void CollectionScan::initCursor(OperationContext* opCtx,
                                 const CollectionPtr& collPtr,
                                 bool forward) {
+    // Tailable scans mostly wait at the end of the collection for new data, which is in cache.
+    if (!_params.tailable && gInternalQueryEnableScanPrefetch.load()) {
+        shard_role_details::getRecoveryUnit(opCtx)->setScanPrefetchHint();
+    }
+
     if (_params.assertTsHasNotFallenOff) {
         invariant(forward);
         _cursor =
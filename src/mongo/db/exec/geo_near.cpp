@@ -735,8 +735,42 @@ S2Region* buildS2Region(const R2Annulus& sphereBounds) {
     // Takes ownership of caps
     return new S2RegionIntersection(&regions);
 }
+
+// Returns the area of a spherical cap with the given radius in meters, as a fraction of the
+// surface of the earth. Uses the haversine form so that it stays accurate for small radii.
+double sphereCapAreaFraction(double radius) {
+    const double halfAngle = std::min(radius / kRadiusOfEarthInMeters, M_PI) / 2;
+    return std::sin(halfAngle) * std::sin(halfAngle);
+}
+
+// Inverse of sphereCapAreaFraction().
+double sphereCapRadius(double areaFraction) {
+    if (areaFraction >= 1.0) {
+        return kMaxEarthDistanceInMeters;
+    }
+    return 2 * std::asin(std::sqrt(areaFraction)) * kRadiusOfEarthInMeters;
+}
 }  // namespace
 
+double GeoNear2DSphereStage::computeNextBoundsIncrement(const IntervalStats& lastInterval,
+                                                        double currentIncrement,
+                                                        long long targetResults) {
+    const double kMaxGrowthFactor = 4.0;
+
+    const double innerArea = sphereCapAreaFraction(std::max(0.0, lastInterval.minDistanceAllowed));
+    const double outerArea = sphereCapAreaFraction(lastInterval.maxDistanceAllowed);
+    if (lastInterval.numResultsBuffered == 0 || outerArea <= innerArea) {
+        // Nothing to extrapolate from, so grow as fast as we allow ourselves to.
+        return currentIncrement * kMaxGrowthFactor;
+    }
+
+    const double density = lastInterval.numResultsBuffered / (outerArea - innerArea);
+    const double nextOuter = sphereCapRadius(outerArea + targetResults / density);
+    return std::clamp(nextOuter - lastInterval.maxDistanceAllowed,
+                      currentIncrement / kMaxGrowthFactor,
+                      currentIncrement * kMaxGrowthFactor);
+}
+
 GeoNear2DSphereStage::DensityEstimator::DensityEstimator(
     const VariantCollectionPtrOrAcquisition* collection,
     PlanStage::Children* children,
@@ -907,12 +941,19 @@ std::unique_ptr<NearStage::CoveredInterval> GeoNear2DSphereStage::nextInterval(
 
     if (!_specificStats.intervalStats.empty()) {
         const IntervalStats& lastIntervalStats = _specificStats.intervalStats.back();
+        _numResultsReturned += lastIntervalStats.numResultsReturned;
+
+        // Aim for a fixed number of buffered documents per interval, but never for more than the
+        // consumer still wants. Results buffered beyond the last interval are not lost, so
+        // undershooting only costs an extra index scan.
+        long long targetResults = gInternalGeoNearTargetResultsPerInterval.load();
+        if (_nearParams.limit) {
+            targetResults =
+                std::clamp(*_nearParams.limit - _numResultsReturned, 1LL, targetResults);
+        }
 
-        // TODO: Generally we want small numbers of results fast, then larger numbers later
-        if (lastIntervalStats.numResultsReturned < 300)
-            _boundsIncrement *= 2;
-        else if (lastIntervalStats.numResultsReturned > 600)
-            _boundsIncrement /= 2;
+        _boundsIncrement =
+            computeNextBoundsIncrement(lastIntervalStats, _boundsIncrement, targetResults);
     }
 
     invariant(_boundsIncrement > 0.0);
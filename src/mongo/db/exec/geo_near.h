@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <boost/optional/optional.hpp>
 #include <memory>
 #include <s2cellunion.h>
 
@@ -71,6 +72,10 @@ struct GeoNearParams {
     const GeoNearExpression* nearQuery;
     bool addPointMeta;
     bool addDistMeta;
+
+    // The maximum number of results the consumer of this stage will request, if known. Only used
+    // to size the search annuli; correctness does not depend on it.
+    boost::optional<long long> limit;
 };
 
 /**
@@ -153,6 +158,16 @@ public:
                          VariantCollectionPtrOrAcquisition collection,
                          const IndexDescriptor* s2Index);
 
+    /**
+     * Returns the width of the next search annulus, chosen so that it is expected to buffer about
+     * 'targetResults' documents if the density observed over 'lastInterval' carries over. The
+     * change relative to 'currentIncrement' is clamped so that a single outlying interval can
+     * neither blow up the next annulus nor shrink it to nothing.
+     */
+    static double computeNextBoundsIncrement(const IntervalStats& lastInterval,
+                                             double currentIncrement,
+                                             long long targetResults);
+
 protected:
     std::unique_ptr<CoveredInterval> nextInterval(OperationContext* opCtx,
                                                   WorkingSet* workingSet) final;
@@ -209,6 +224,9 @@ private:
     // Amount to increment the next bounds by
     double _boundsIncrement;
 
+    // Total number of results returned to the parent by all previous intervals.
+    long long _numResultsReturned = 0;
+
     // Keeps track of the region that has already been scanned
     S2CellUnion _scannedCells;
 
@@ -0,0 +1,108 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+/**
+ * This file contains tests for the annulus sizing in mongo/db/exec/geo_near.cpp
+ */
+
+#include "mongo/db/exec/geo_near.h"
+
+#include <cmath>
+
+#include "mongo/db/exec/plan_stats.h"
+#include "mongo/db/geo/geoconstants.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/framework.h"
+
+namespace mongo {
+namespace {
+
+IntervalStats makeInterval(double minDistance, double maxDistance, long long numResultsBuffered) {
+    IntervalStats stats;
+    stats.minDistanceAllowed = minDistance;
+    stats.maxDistanceAllowed = maxDistance;
+    stats.numResultsBuffered = numResultsBuffered;
+    return stats;
+}
+
+// The annuli used by these tests are small enough that the area of a cap is, to well within the
+// tolerance, proportional to the square of its radius.
+const double kTolerance = 1.0;
+
+TEST(GeoNearIntervalSizingTest, ExtrapolatesDensityOfFirstInterval) {
+    // 100 documents in a cap of 1km. Another 300 need a cap four times the area, so 2km.
+    auto increment = GeoNear2DSphereStage::computeNextBoundsIncrement(
+        makeInterval(0, 1000, 100), 1000, 300);
+    ASSERT_APPROX_EQUAL(increment, 1000, kTolerance);
+}
+
+TEST(GeoNearIntervalSizingTest, ExtrapolatesDensityOfAnnulus) {
+    // 300 documents between 1km and 2km, i.e. over 3 units of the area of a 1km cap. Another 500
+    // need 5 more units, taking the outer cap to 9 units, so 3km.
+    auto increment = GeoNear2DSphereStage::computeNextBoundsIncrement(
+        makeInterval(1000, 2000, 300), 1000, 500);
+    ASSERT_APPROX_EQUAL(increment, 1000, kTolerance);
+}
+
+TEST(GeoNearIntervalSizingTest, SmallerTargetGivesNarrowerAnnulus) {
+    // 400 documents in a cap of 2km. Another 100 take the outer cap to 5/4 of its area.
+    auto increment = GeoNear2DSphereStage::computeNextBoundsIncrement(
+        makeInterval(0, 2000, 400), 2000, 100);
+    ASSERT_APPROX_EQUAL(increment, 2000 * (std::sqrt(1.25) - 1), kTolerance);
+}
+
+TEST(GeoNearIntervalSizingTest, EmptyIntervalGrowsByMaximumFactor) {
+    auto increment =
+        GeoNear2DSphereStage::computeNextBoundsIncrement(makeInterval(0, 1000, 0), 1000, 400);
+    ASSERT_EQUALS(increment, 4000);
+}
+
+TEST(GeoNearIntervalSizingTest, GrowthIsClamped) {
+    // A single document in 1km would call for an annulus of roughly 20km.
+    auto increment =
+        GeoNear2DSphereStage::computeNextBoundsIncrement(makeInterval(0, 1000, 1), 1000, 400);
+    ASSERT_EQUALS(increment, 4000);
+}
+
+TEST(GeoNearIntervalSizingTest, ShrinkageIsClamped) {
+    // A dense interval asking for a single document would call for an annulus of well under 1m.
+    auto increment = GeoNear2DSphereStage::computeNextBoundsIncrement(
+        makeInterval(0, 1000, 100000), 1000, 1);
+    ASSERT_EQUALS(increment, 250);
+}
+
+TEST(GeoNearIntervalSizingTest, IncrementStaysPositiveAtMaximumDistance) {
+    // An interval which already covers the whole earth leaves nothing to extrapolate into.
+    auto increment = GeoNear2DSphereStage::computeNextBoundsIncrement(
+        makeInterval(0, M_PI * kRadiusOfEarthInMeters, 1000), 1000, 400);
+    ASSERT_GREATER_THAN(increment, 0);
+}
+
+}  // namespace
+}  // namespace mongo
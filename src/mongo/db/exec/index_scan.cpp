@@ -119,6 +119,12 @@ boost::optional<IndexKeyEntry> IndexScan::initIndexScan() {
         _priority.emplace(opCtx(), AdmissionContext::Priority::kLow);
     }
 
+    // The storage engine only reads ahead when the cursor walks across leaf pages it had to read
+    // from disk, so this does not slow down point lookups.
+    if (gInternalQueryEnableScanPrefetch.load()) {
+        shard_role_details::getRecoveryUnit(opCtx())->setScanPrefetchHint();
+    }
+
     // Perform the possibly heavy-duty initialization of the underlying index cursor.
     _indexCursor = indexAccessMethod()->newCursor(opCtx(), _forward);
 
@@ -263,10 +263,16 @@ bool NearStage::isEOF() {
 
 unique_ptr<PlanStageStats> NearStage::getStats() {
     unique_ptr<PlanStageStats> ret = std::make_unique<PlanStageStats>(_commonStats, _stageType);
-    ret->specific = _specificStats.clone();
+    auto specific = std::make_unique<NearStats>(_specificStats);
     for (size_t i = 0; i < _childrenIntervals.size(); ++i) {
+        const PlanStage* covering = _childrenIntervals[i]->covering;
+        if (covering->stageType() == STAGE_FETCH) {
+            specific->docsExamined +=
+                static_cast<const FetchStats*>(covering->getSpecificStats())->docsExamined;
+        }
         ret->children.emplace_back(_childrenIntervals[i]->covering->getStats());
     }
+    ret->specific = std::move(specific);
     return ret;
 }
 
@@ -926,6 +926,9 @@ struct NearStats : public SpecificStats {
     }
 
     std::vector<IntervalStats> intervalStats;
+    // Number of documents fetched by the coverings of all search intervals, including those
+    // which did not pass the filter.
+    size_t docsExamined = 0;
     std::string indexName;
     // btree index version, not geo index version
     int indexVersion;
@@ -1018,6 +1021,11 @@ struct TextOrStats : public SpecificStats {
     }
 
     size_t fetches;
+
+    // Number of results requested from the stage, or 0 if it was not running in top-K mode.
+    size_t topK = 0;
+    // Number of documents which were scored from index keys alone in top-K mode.
+    size_t candidatesScored = 0;
 };
 
 struct TrialStats : public SpecificStats {
@@ -33,6 +33,8 @@
 
 #include "mongo/db/exec/document_value/document.h"
 #include "mongo/db/exec/shard_filterer_impl.h"
+#include "mongo/db/s/range_access_sampler.h"
+#include "mongo/db/service_context.h"
 #include "mongo/db/storage/snapshot.h"
 #include "mongo/s/shard_key_pattern.h"
 #include "mongo/util/assert_util_core.h"
@@ -46,6 +48,26 @@ std::unique_ptr<ShardFilterer> ShardFiltererImpl::clone() const {
 ShardFiltererImpl::ShardFiltererImpl(ScopedCollectionFilter cf)
     : _collectionFilter(std::move(cf)) {}
 
+bool ShardFiltererImpl::keyBelongsToMe(const BSONObj& shardKey) const {
+    if (!_lastKeyRange || !_lastKeyRange->range.containsKey(shardKey)) {
+        _lastKeyRange = _collectionFilter.keyRangeOwnership(shardKey);
+    }
+
+    if (!_lastKeyRange || !_lastKeyRange->owned) {
+        return false;
+    }
+
+    if (RangeAccessSampler::shouldSample()) {
+        auto serviceContext = getGlobalServiceContext();
+        RangeAccessSampler::get(serviceContext)
+            ->recordAccess(_collectionFilter.getUUID(),
+                           _lastKeyRange->range,
+                           shardKey,
+                           serviceContext->getFastClockSource()->now());
+    }
+    return true;
+}
+
 ShardFilterer::DocumentBelongsResult ShardFiltererImpl::keyBelongsToMeHelper(
     const BSONObj& shardKey) const {
     if (shardKey.isEmpty()) {
@@ -70,7 +92,7 @@ ShardFilterer::DocumentBelongsResult ShardFiltererImpl::documentBelongsToMe(
     // extractShardKeyFromIndexKeyData().
     invariant(!wsm.keyData.empty());
     std::vector<ShardKeyPattern::IndexKeyData> indexKeyDataVector;
-    indexKeyDataVector.resize(wsm.keyData.size());
+    indexKeyDataVector.reserve(wsm.keyData.size());
     for (auto&& indexKeyData : wsm.keyData) {
         indexKeyDataVector.push_back({indexKeyData.keyData, indexKeyData.indexKeyPattern});
     }
@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <boost/optional/optional.hpp>
 #include <cstddef>
 #include <memory>
 
@@ -37,6 +38,7 @@
 #include "mongo/db/exec/working_set.h"
 #include "mongo/db/keypattern.h"
 #include "mongo/db/matcher/matchable.h"
+#include "mongo/db/s/collection_metadata.h"
 #include "mongo/db/s/scoped_collection_metadata.h"
 
 namespace mongo {
@@ -50,9 +52,7 @@ public:
     DocumentBelongsResult documentBelongsToMe(const BSONObj& doc) const override;
     DocumentBelongsResult documentBelongsToMe(const WorkingSetMember& wsm) const;
 
-    bool keyBelongsToMe(const BSONObj& shardKey) const override {
-        return _collectionFilter.keyBelongsToMe(shardKey);
-    };
+    bool keyBelongsToMe(const BSONObj& shardKey) const override;
 
     bool isCollectionSharded() const override {
         return _collectionFilter.isSharded();
@@ -66,5 +66,10 @@ private:
     DocumentBelongsResult keyBelongsToMeHelper(const BSONObj& doc) const;
 
     ScopedCollectionFilter _collectionFilter;
+
+    // The range of the chunk which contained the last key looked up, and whether this shard owns
+    // it. Scans mostly return runs of documents from the same chunk, whose keys are then checked
+    // against this range instead of being looked up in the chunk map. Not copied by clone().
+    mutable boost::optional<CollectionMetadata::KeyRangeOwnership> _lastKeyRange;
 };
 }  // namespace mongo
@@ -29,6 +29,7 @@
 
 #include "mongo/db/exec/text_or.h"
 
+#include <algorithm>
 #include <iterator>
 #include <memory>
 #include <string>
@@ -60,13 +61,17 @@ TextOrStage::TextOrStage(ExpressionContext* expCtx,
                          size_t keyPrefixSize,
                          WorkingSet* ws,
                          const MatchExpression* filter,
-                         VariantCollectionPtrOrAcquisition collection)
+                         VariantCollectionPtrOrAcquisition collection,
+                         boost::optional<size_t> topK)
     : RequiresCollectionStage(kStageType, expCtx, collection),
       _keyPrefixSize(keyPrefixSize),
       _ws(ws),
       _scoreIterator(_scores.end()),
+      _topK(topK),
       _filter(filter),
-      _idRetrying(WorkingSet::INVALID_ID) {}
+      _idRetrying(WorkingSet::INVALID_ID) {
+    _specificStats.topK = _topK.value_or(0);
+}
 
 void TextOrStage::addChild(unique_ptr<PlanStage> child) {
     _children.push_back(std::move(child));
@@ -189,7 +194,7 @@ PlanStage::StageState TextOrStage::readFromChildren(WorkingSetID* out) {
     }
 
     if (PlanStage::ADVANCED == childState) {
-        return addTerm(id, out);
+        return _topK ? addTermWithoutFetch(id) : addTerm(id, out);
     } else if (PlanStage::IS_EOF == childState) {
         // Done with this child.
         ++_currentChild;
@@ -203,6 +208,17 @@ PlanStage::StageState TextOrStage::readFromChildren(WorkingSetID* out) {
         _scoreIterator = _scores.begin();
         _internalState = State::kReturningResults;
 
+        if (_topK) {
+            _topKCandidates.reserve(_scores.size());
+            for (const auto& entry : _scores) {
+                if (entry.second.score >= 0) {
+                    _topKCandidates.push_back(&entry);
+                }
+            }
+            std::make_heap(_topKCandidates.begin(), _topKCandidates.end(), hasLowerScore);
+            _specificStats.candidatesScored = _topKCandidates.size();
+        }
+
         return PlanStage::NEED_TIME;
     } else {
         // Propagate WSID from below.
@@ -212,6 +228,10 @@ PlanStage::StageState TextOrStage::readFromChildren(WorkingSetID* out) {
 }
 
 PlanStage::StageState TextOrStage::returnResults(WorkingSetID* out) {
+    if (_topK) {
+        return returnTopKResults(out);
+    }
+
     if (_scoreIterator == _scores.end()) {
         _internalState = State::kDone;
         return PlanStage::IS_EOF;
@@ -235,6 +255,100 @@ PlanStage::StageState TextOrStage::returnResults(WorkingSetID* out) {
     return PlanStage::ADVANCED;
 }
 
+PlanStage::StageState TextOrStage::returnTopKResults(WorkingSetID* out) {
+    WorkingSetID wsid = _idRetrying;
+    _idRetrying = WorkingSet::INVALID_ID;
+
+    if (wsid == WorkingSet::INVALID_ID) {
+        if (_numTopKReturned == *_topK || _topKCandidates.empty()) {
+            _internalState = State::kDone;
+            return PlanStage::IS_EOF;
+        }
+
+        std::pop_heap(_topKCandidates.begin(), _topKCandidates.end(), hasLowerScore);
+        const auto& [recordId, textRecordData] = *_topKCandidates.back();
+        _topKCandidates.pop_back();
+
+        // Rebuild the member the index scan would have produced, so that fetching it verifies
+        // that the index key is still consistent with the document.
+        wsid = _ws->allocate();
+        WorkingSetMember* wsm = _ws->get(wsid);
+        wsm->recordId = recordId;
+        wsm->keyData.push_back(*textRecordData.firstKey);
+        wsm->metadata().setTextScore(textRecordData.score);
+        _ws->transitionToRecordIdAndIdx(wsid);
+    }
+
+    return handlePlanStageYield(
+        expCtx(),
+        "TextOrStage returnTopKResults",
+        [&] {
+            if (!WorkingSetCommon::fetch(opCtx(),
+                                         _ws,
+                                         wsid,
+                                         _recordCursor.get(),
+                                         collectionPtr(),
+                                         collectionPtr()->ns())) {
+                // The document is gone, so the next best candidate takes its place.
+                _ws->free(wsid);
+                return PlanStage::NEED_TIME;
+            }
+            ++_specificStats.fetches;
+            ++_numTopKReturned;
+            *out = wsid;
+            return PlanStage::ADVANCED;
+        },
+        [&] {
+            // yieldHandler
+            _idRetrying = wsid;
+            *out = WorkingSet::INVALID_ID;
+        });
+}
+
+PlanStage::StageState TextOrStage::addTermWithoutFetch(WorkingSetID wsid) {
+    WorkingSetMember* wsm = _ws->get(wsid);
+    invariant(wsm->getState() == WorkingSetMember::RID_AND_IDX);
+    invariant(1 == wsm->keyData.size());
+    const IndexKeyDatum& keyDatum = wsm->keyData.back();
+    TextRecordData* textRecordData = &_scores[wsm->recordId];
+
+    if (textRecordData->score < 0) {
+        // We have already rejected this document for not matching the filter.
+        _ws->free(wsid);
+        return NEED_TIME;
+    }
+
+    if (!textRecordData->firstKey) {
+        // We haven't seen this RecordId before.
+        if (!Filter::passes(keyDatum.keyData, keyDatum.indexKeyPattern, _filter)) {
+            _ws->free(wsid);
+            textRecordData->score = -1;
+            return NEED_TIME;
+        }
+        textRecordData->firstKey.emplace(keyDatum.indexKeyPattern,
+                                         keyDatum.keyData.getOwned(),
+                                         keyDatum.indexId,
+                                         keyDatum.snapshotId);
+    }
+
+    textRecordData->score += getTermScore(keyDatum.keyData);
+    _ws->free(wsid);
+    return NEED_TIME;
+}
+
+double TextOrStage::getTermScore(const BSONObj& keyData) const {
+    // Locate score within possibly compound key: {prefix,term,score,suffix}.
+    BSONObjIterator keyIt(keyData);
+    for (unsigned i = 0; i < _keyPrefixSize; i++) {
+        keyIt.next();
+    }
+
+    keyIt.next();  // Skip past 'term'.
+
+    BSONElement scoreElement = keyIt.next();
+    return scoreElement.number();
+}
+
 PlanStage::StageState TextOrStage::addTerm(WorkingSetID wsid, WorkingSetID* out) {
     WorkingSetMember* wsm = _ws->get(wsid);
     invariant(wsm->getState() == WorkingSetMember::RID_AND_IDX);
@@ -303,19 +417,8 @@ PlanStage::StageState TextOrStage::addTerm(WorkingSetID wsid, WorkingSetID* out)
         wsm = _ws->get(textRecordData->wsid);
     }
 
-    // Locate score within possibly compound key: {prefix,term,score,suffix}.
-    BSONObjIterator keyIt(newKeyData.keyData);
-    for (unsigned i = 0; i < _keyPrefixSize; i++) {
-        keyIt.next();
-    }
-
-    keyIt.next();  // Skip past 'term'.
-
-    BSONElement scoreElement = keyIt.next();
-    double documentTermScore = scoreElement.number();
-
     // Aggregate relevance score, term keys.
-    textRecordData->score += documentTermScore;
+    textRecordData->score += getTermScore(newKeyData.keyData);
     return NEED_TIME;
 }
 
@@ -29,8 +29,10 @@
 
 #pragma once
 
+#include <boost/optional/optional.hpp>
 #include <cstddef>
 #include <memory>
+#include <vector>
 
 #include "mongo/db/exec/plan_stage.h"
 #include "mongo/db/exec/plan_stats.h"
@@ -55,6 +57,11 @@ class OperationContext;
  * A blocking stage that returns the set of WSMs with RecordIDs of all of the documents that contain
  * the positive terms in the search query, as well as their scores.
  *
+ * If 'topK' is provided, the caller only needs the 'topK' highest scoring documents. In that case
+ * the scores are accumulated from the index keys alone and only the documents which make it into
+ * the top K are fetched, in descending score order. The caller is responsible for ensuring that no
+ * stage between this one and the consumer of the top K can reject documents.
+ *
  * The WorkingSetMembers returned are fetched and in the LOC_AND_OBJ state.
  */
 class TextOrStage final : public RequiresCollectionStage {
@@ -80,7 +87,8 @@ public:
                 size_t keyPrefixSize,
                 WorkingSet* ws,
                 const MatchExpression* filter,
-                VariantCollectionPtrOrAcquisition collection);
+                VariantCollectionPtrOrAcquisition collection,
+                boost::optional<size_t> topK = boost::none);
 
     void addChild(std::unique_ptr<PlanStage> child);
 
@@ -127,11 +135,26 @@ private:
      */
     StageState addTerm(WorkingSetID wsid, WorkingSetID* out);
 
+    /**
+     * Top-K variant of addTerm() which only updates the aggregate score, without fetching.
+     */
+    StageState addTermWithoutFetch(WorkingSetID wsid);
+
+    /**
+     * Returns the score stored in the text index key 'keyData' for its term.
+     */
+    double getTermScore(const BSONObj& keyData) const;
+
     /**
      * Worker for kReturningResults. Returns a wsm with RecordID and Score.
      */
     StageState returnResults(WorkingSetID* out);
 
+    /**
+     * Top-K variant of returnResults() which fetches the highest scoring remaining document.
+     */
+    StageState returnTopKResults(WorkingSetID* out);
+
     // The key prefix length within a possibly compound key: {prefix,term,score,suffix}.
     const size_t _keyPrefixSize;
 
@@ -153,12 +176,29 @@ private:
         TextRecordData() : wsid(WorkingSet::INVALID_ID), score(0.0) {}
         WorkingSetID wsid;
         double score;
+
+        // In top-K mode the document is not fetched when first seen, so we keep the first index
+        // key instead. It is attached to the member when the document is eventually fetched.
+        boost::optional<IndexKeyDatum> firstKey;
     };
 
     typedef stdx::unordered_map<RecordId, TextRecordData, RecordId::Hasher> ScoreMap;
     ScoreMap _scores;
     ScoreMap::const_iterator _scoreIterator;
 
+    // The number of results requested by the caller, if it only needs the highest scoring ones.
+    const boost::optional<size_t> _topK;
+    size_t _numTopKReturned = 0;
+
+    // Orders '_topKCandidates' so that the highest score is at the top of the heap.
+    static bool hasLowerScore(const ScoreMap::value_type* lhs, const ScoreMap::value_type* rhs) {
+        return lhs->second.score < rhs->second.score;
+    }
+
+    // In top-K mode, a max-heap by score of the entries in '_scores' which have not been rejected
+    // and not yet returned.
+    std::vector<const ScoreMap::value_type*> _topKCandidates;
+
     TextOrStats _specificStats;
 
     // Members needed only for using the TextMatchableDocument.
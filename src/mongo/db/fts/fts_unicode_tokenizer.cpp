@@ -27,17 +27,116 @@
  *    it in the license file.
  */
 
+#include <cstdint>
 #include <string>
 
 #include "mongo/db/fts/fts_unicode_tokenizer.h"
 #include "mongo/db/fts/stemmer.h"
 #include "mongo/db/fts/stop_words.h"
+#include "mongo/db/fts/unicode/byte_vector.h"
+#include "mongo/util/ctype.h"
 
 namespace mongo {
 namespace fts {
 
 using std::string;
 
+namespace {
+
+/**
+ * Returns true if 'document' only contains non-null ASCII characters. Null characters are excluded
+ * because the UTF-32 conversion of the general path stops at them.
+ */
+bool isNonNullAscii(StringData document) {
+    const char* it = document.rawData();
+    const char* const end = it + document.size();
+#ifdef MONGO_HAVE_FAST_BYTE_VECTOR
+    using unicode::ByteVector;
+    for (; end - it >= ByteVector::size; it += ByteVector::size) {
+        auto word = ByteVector::load(it);
+        if (word.maskHigh() | word.compareEQ(0).maskAny()) {
+            return false;
+        }
+    }
+#endif
+    for (; it != end; ++it) {
+        const auto c = static_cast<uint8_t>(*it);
+        if (c == 0 || c >= 0x80) {
+            return false;
+        }
+    }
+    return true;
+}
+
+UnicodeFTSTokenizer::AsciiDelimiters makeAsciiDelimiters(unicode::DelimiterListLanguage lang) {
+    UnicodeFTSTokenizer::AsciiDelimiters table;
+    for (char32_t c = 0; c < 0x80; ++c) {
+        const bool isDelimiter = unicode::codepointIsDelimiter(c, lang);
+        table.isDelimiter[c] = isDelimiter;
+
+        const bool isAlnum =
+            (c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
+        if ((c == '^' || c == '`') && !isDelimiter) {
+            table.diacriticsAreDelimiters = false;
+        }
+
+        if (c == '\'') {
+            table.apostropheIsDelimiter = isDelimiter;
+        } else if (c != 0 && isDelimiter == isAlnum) {
+            table.onlyAlnumAndApostrophe = false;
+        }
+    }
+    return table;
+}
+
+const UnicodeFTSTokenizer::AsciiDelimiters& getAsciiDelimiters(
+    unicode::DelimiterListLanguage lang) {
+    static const UnicodeFTSTokenizer::AsciiDelimiters kEnglish =
+        makeAsciiDelimiters(unicode::DelimiterListLanguage::kEnglish);
+    static const UnicodeFTSTokenizer::AsciiDelimiters kNotEnglish =
+        makeAsciiDelimiters(unicode::DelimiterListLanguage::kNotEnglish);
+    return lang == unicode::DelimiterListLanguage::kEnglish ? kEnglish : kNotEnglish;
+}
+
+#ifdef MONGO_HAVE_FAST_BYTE_VECTOR
+/**
+ * Returns a vector with 0xff for each byte of 'word' which is part of a token, assuming that the
+ * token characters are exactly the ASCII letters and digits, plus the apostrophe if
+ * 'apostropheIsDelimiter' is false.
+ */
+unicode::ByteVector tokenCharMask(unicode::ByteVector word, bool apostropheIsDelimiter) {
+    auto mask = (word.compareGT('0' - 1) & word.compareLT('9' + 1)) |
+        (word.compareGT('A' - 1) & word.compareLT('Z' + 1)) |
+        (word.compareGT('a' - 1) & word.compareLT('z' + 1));
+    if (!apostropheIsDelimiter) {
+        mask |= word.compareEQ('\'');
+    }
+    return mask;
+}
+#endif
+
+/**
+ * Lowercases the ASCII string 'word' into 'buffer', overwriting its previous contents.
+ */
+StringData asciiToLowerToBuf(StackBufBuilder* buffer, StringData word) {
+    buffer->reset();
+    char* const out = buffer->skip(word.size());
+    size_t i = 0;
+#ifdef MONGO_HAVE_FAST_BYTE_VECTOR
+    using unicode::ByteVector;
+    for (; word.size() - i >= ByteVector::size; i += ByteVector::size) {
+        auto chunk = ByteVector::load(word.rawData() + i);
+        chunk |= (chunk.compareGT('A' - 1) & chunk.compareLT('Z' + 1)) & ByteVector(0x20);
+        chunk.store(out + i);
+    }
+#endif
+    for (; i < word.size(); ++i) {
+        out[i] = ctype::toLower(word[i]);
+    }
+    return {out, word.size()};
+}
+}  // namespace
+
 UnicodeFTSTokenizer::UnicodeFTSTokenizer(const FTSLanguage* language)
     : _language(language),
       _stemmer(language),
@@ -46,11 +145,21 @@ UnicodeFTSTokenizer::UnicodeFTSTokenizer(const FTSLanguage* language)
                              ? unicode::DelimiterListLanguage::kEnglish
                              : unicode::DelimiterListLanguage::kNotEnglish),
       _caseFoldMode(_language->str() == "turkish" ? unicode::CaseFoldMode::kTurkish
-                                                  : unicode::CaseFoldMode::kNormal) {}
+                                                  : unicode::CaseFoldMode::kNormal),
+      _asciiDelimiters(getAsciiDelimiters(_delimListLanguage)) {}
 
 void UnicodeFTSTokenizer::reset(StringData document, Options options) {
     _options = options;
     _pos = 0;
+
+    // Turkish lowercases 'I' to a non-ASCII character, so it always takes the general path.
+    _isAscii = _caseFoldMode != unicode::CaseFoldMode::kTurkish && isNonNullAscii(document);
+    if (_isAscii) {
+        _asciiDocument = document;
+        _skipDelimitersAscii();
+        return;
+    }
+
     _document.resetData(document);  // Validates that document is valid UTF8.
 
     // Skip any leading delimiters (and handle the case where the document is entirely delimiters).
@@ -58,6 +167,10 @@ void UnicodeFTSTokenizer::reset(StringData document, Options options) {
 }
 
 bool UnicodeFTSTokenizer::moveNext() {
+    if (_isAscii) {
+        return _moveNextAscii();
+    }
+
     while (true) {
         if (_pos >= _document.size()) {
             _word = "";
@@ -100,6 +213,75 @@ bool UnicodeFTSTokenizer::moveNext() {
     }
 }
 
+bool UnicodeFTSTokenizer::_moveNextAscii() {
+    while (true) {
+        if (_pos >= _asciiDocument.size()) {
+            _word = "";
+            return false;
+        }
+
+        // Find the end of the token. We know that the character at '_pos' is not a delimiter.
+        const size_t start = _pos++;
+        _pos = _findAscii(_pos, true /* delimiter */);
+        const StringData token = _asciiDocument.substr(start, _pos - start);
+
+        // Skip the delimiters before the next token.
+        _skipDelimitersAscii();
+
+        // The steps below mirror moveNext(), with ASCII versions of the case transformations.
+        _word = asciiToLowerToBuf(&_wordBuf, token);
+
+        if ((_options & kFilterStopWords) && _stopWords->isStopWord(_word)) {
+            continue;
+        }
+
+        if (_options & kGenerateCaseSensitiveTokens) {
+            _word = token;
+        }
+
+        _word = _stemmer.stem(_word);
+
+        // ASCII has no letters with diacritics, so only tokens which may contain the pure
+        // diacritics, or stems which are no longer ASCII, need to go through the general folding.
+        if (!(_options & kGenerateDiacriticSensitiveTokens) &&
+            (!_asciiDelimiters.diacriticsAreDelimiters || !isNonNullAscii(_word))) {
+            _word = unicode::String::caseFoldAndStripDiacritics(
+                &_finalBuf, _word, unicode::String::kCaseSensitive, _caseFoldMode);
+        }
+
+        return true;
+    }
+}
+
+size_t UnicodeFTSTokenizer::_findAscii(size_t pos, bool delimiter) const {
+    const char* const data = _asciiDocument.rawData();
+    const size_t size = _asciiDocument.size();
+
+#ifdef MONGO_HAVE_FAST_BYTE_VECTOR
+    using unicode::ByteVector;
+    if (_asciiDelimiters.onlyAlnumAndApostrophe) {
+        for (; size - pos >= ByteVector::size; pos += ByteVector::size) {
+            auto tokenChars =
+                tokenCharMask(ByteVector::load(data + pos), _asciiDelimiters.apostropheIsDelimiter);
+            auto found = delimiter ? tokenChars.compareEQ(0) : tokenChars;
+            if (auto mask = found.maskAny()) {
+                return pos + ByteVector::countInitialZeros(mask);
+            }
+        }
+    }
+#endif
+
+    while (pos < size &&
+           _asciiDelimiters.isDelimiter[static_cast<uint8_t>(data[pos])] != delimiter) {
+        ++pos;
+    }
+    return pos;
+}
+
+void UnicodeFTSTokenizer::_skipDelimitersAscii() {
+    _pos = _findAscii(_pos, false /* delimiter */);
+}
+
 StringData UnicodeFTSTokenizer::get() const {
     return _word;
 }
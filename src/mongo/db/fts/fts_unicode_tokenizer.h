@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 
 #include "mongo/base/string_data.h"
@@ -64,8 +65,28 @@ class UnicodeFTSTokenizer final : public FTSTokenizer {
     UnicodeFTSTokenizer& operator=(const UnicodeFTSTokenizer&) = delete;
 
 public:
+    /**
+     * Classification of the ASCII characters for a delimiter list language.
+     */
+    struct AsciiDelimiters {
+        std::array<bool, 0x80> isDelimiter{};
+
+        // True if the non-delimiter ASCII characters are exactly the letters and digits, plus
+        // possibly the apostrophe, which allows classifying them with vectorized range checks.
+        bool onlyAlnumAndApostrophe = true;
+        bool apostropheIsDelimiter = true;
+
+        // True if the only ASCII diacritics, '^' and '`', are delimiters, so that ASCII tokens
+        // never contain diacritics to strip.
+        bool diacriticsAreDelimiters = true;
+    };
+
     UnicodeFTSTokenizer(const FTSLanguage* language);
 
+    /**
+     * ASCII documents are tokenized in place, so 'document' must stay valid until the last call to
+     * moveNext().
+     */
     void reset(StringData document, Options options) override;
 
     bool moveNext() override;
@@ -79,12 +100,30 @@ private:
      */
     void _skipDelimiters();
 
+    /**
+     * Versions of moveNext() and _skipDelimiters() used when the document is ASCII. They work
+     * directly on the bytes of the document instead of on its UTF-32 conversion.
+     */
+    bool _moveNextAscii();
+    void _skipDelimitersAscii();
+
+    /**
+     * Returns the position of the first character at or after 'pos' in the ASCII document which is
+     * a delimiter if 'delimiter' is true, or part of a token otherwise.
+     */
+    size_t _findAscii(size_t pos, bool delimiter) const;
+
     const FTSLanguage* const _language;
     const Stemmer _stemmer;
     const StopWords* const _stopWords;
     const unicode::DelimiterListLanguage _delimListLanguage;
     const unicode::CaseFoldMode _caseFoldMode;
+    const AsciiDelimiters& _asciiDelimiters;
 
+    // Exactly one of '_asciiDocument' and '_document' holds the current document, depending on
+    // whether it only contains ASCII characters. '_asciiDocument' points into the caller's buffer.
+    bool _isAscii = false;
+    StringData _asciiDocument;
     unicode::String _document;
     size_t _pos;
     StringData _word;
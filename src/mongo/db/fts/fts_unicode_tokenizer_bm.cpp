@@ -0,0 +1,109 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/fts/fts_language.h"
+#include "mongo/db/fts/fts_spec.h"
+#include "mongo/db/fts/fts_tokenizer.h"
+#include "mongo/db/fts/fts_util.h"
+#include "mongo/platform/random.h"
+#include "mongo/util/assert_util.h"
+
+namespace mongo {
+namespace fts {
+namespace {
+
+const std::vector<std::string> kWords = {
+    "Stainless", "steel", "water", "bottle", "insulated", "keeps", "drinks", "cold", "for", "24",
+    "hours", "Leak-proof", "lid,", "BPA-free", "dishwasher", "safe.", "Perfect", "hiking", "and",
+    "camping"};
+
+/**
+ * Builds a product description of about 'size' bytes. If 'accented' is true, some words carry a
+ * diacritic so that the tokenizer cannot take its ASCII path.
+ */
+std::string makeDescription(size_t size, bool accented) {
+    PseudoRandom random(1);
+    std::string text;
+    while (text.size() < size) {
+        text += kWords[random.nextInt32(static_cast<int32_t>(kWords.size()))];
+        if (accented && random.nextInt32(8) == 0) {
+            text += "é";
+        }
+        text += ' ';
+    }
+    return text;
+}
+
+void BM_UnicodeTokenizer(benchmark::State& state) {
+    const auto text = makeDescription(state.range(0), state.range(1));
+    auto tokenizer = FTSLanguage::make("english", TEXT_INDEX_VERSION_3).createTokenizer();
+
+    size_t tokens = 0;
+    for (auto _ : state) {
+        tokenizer->reset(text, FTSTokenizer::kFilterStopWords);
+        while (tokenizer->moveNext()) {
+            benchmark::DoNotOptimize(tokenizer->get());
+            ++tokens;
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+    state.counters["tokens"] = benchmark::Counter(tokens, benchmark::Counter::kIsRate);
+}
+
+// Scores a document the way a text index build does, which creates a tokenizer per string.
+void BM_ScoreDocument(benchmark::State& state) {
+    const auto text = makeDescription(state.range(0), state.range(1));
+    const auto doc = BSON("description" << text);
+    FTSSpec spec(uassertStatusOK(FTSSpec::fixSpec(BSON("key" << BSON("description"
+                                                                   << "text")))));
+
+    for (auto _ : state) {
+        TermFrequencyMap terms;
+        spec.scoreDocument(doc, &terms);
+        benchmark::DoNotOptimize(terms);
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+
+BENCHMARK(BM_UnicodeTokenizer)
+    ->ArgNames({"size", "accented"})
+    ->ArgsProduct({{64, 1024, 16 * 1024}, {false, true}});
+BENCHMARK(BM_ScoreDocument)
+    ->ArgNames({"size", "accented"})
+    ->ArgsProduct({{64, 1024, 16 * 1024}, {false, true}});
+
+}  // namespace
+}  // namespace fts
+}  // namespace mongo
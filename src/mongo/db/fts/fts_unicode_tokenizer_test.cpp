@@ -242,5 +242,31 @@ TEST(FtsUnicodeTokenizer, FrenchStopWordsAndDiacriticSensitive) {
     ASSERT_EQUALS("excit", terms[4]);
 }
 
+// Ensure that ASCII documents, which are tokenized without converting them to UTF-32, produce the
+// same tokens as the general path. Appending a non-ASCII token forces the general path.
+TEST(FtsUnicodeTokenizer, AsciiMatchesGeneralPath) {
+    const std::string ascii =
+        "The QUICK brown_fox's 42 jumps-over\tthe lazy DOG's back; Rock`n`Roll ^caret^ "
+        "AVeryLongTokenThatSpansMoreThanSixteenBytes,and:punctuation!everywhere?   ";
+    const std::vector<FTSTokenizer::Options> allOptions = {
+        FTSTokenizer::kNone,
+        FTSTokenizer::kFilterStopWords,
+        FTSTokenizer::kGenerateCaseSensitiveTokens,
+        FTSTokenizer::kGenerateDiacriticSensitiveTokens,
+        FTSTokenizer::kGenerateCaseSensitiveTokens |
+            FTSTokenizer::kGenerateDiacriticSensitiveTokens | FTSTokenizer::kFilterStopWords};
+
+    for (const char* language : {"english", "french", "none"}) {
+        for (auto options : allOptions) {
+            auto asciiTerms = tokenizeString(ascii.c_str(), language, options);
+            auto generalTerms = tokenizeString((ascii + " zéro").c_str(), language, options);
+
+            ASSERT_FALSE(generalTerms.empty());
+            generalTerms.pop_back();
+            ASSERT_EQUALS(asciiTerms, generalTerms);
+        }
+    }
+}
+
 }  // namespace fts
 }  // namespace mongo
@@ -29,28 +29,110 @@
 
 #include "mongo/db/fts/stemmer.h"
 
+#include <absl/hash/hash.h>
+#include <array>
 #include <cstdlib>
+#include <cstring>
 #include <libstemmer.h>
+#include <memory>
 #include <string>
+#include <string_view>  // NOLINT
 
 
 #include "mongo/util/assert_util.h"
 
 namespace mongo::fts {
+namespace {
+/**
+ * A per-thread cache of recent stemmer results. A tokenizer, and with it a stemmer, is created for
+ * every string a text index build tokenizes, while the vocabulary of a collection is usually small,
+ * so most words are stemmed over and over again by the same thread.
+ *
+ * The cache is direct mapped: a word and its stem are stored inline in the slot its hash selects,
+ * replacing whatever the slot held. Lookups therefore take no lock and allocate nothing, and each
+ * thread's cache has a fixed size, which is only allocated once the thread stems its first word.
+ */
+class StemCache {
+public:
+    static constexpr size_t kMaxWordSize = 32;
+    static constexpr size_t kNumSlots = 256;
+
+    /**
+     * Returns the cached stem of 'word' in 'language', or an empty StringData if there is none.
+     * The result is only valid until the next call to add() on this thread.
+     */
+    StringData find(const FTSLanguage* language, StringData word) const {
+        const auto& slot = _slots[_slotIndex(language, word)];
+        if (slot.language != language || StringData{slot.word, slot.wordSize} != word) {
+            return {};
+        }
+        return {slot.stem, slot.stemSize};
+    }
+
+    /**
+     * Caches the stem of 'word' in 'language'. The word must be at most 'kMaxWordSize' bytes long,
+     * and stems longer than that are not cached.
+     */
+    void add(const FTSLanguage* language, StringData word, StringData stem) {
+        if (stem.size() > kMaxWordSize) {
+            return;
+        }
+        auto& slot = _slots[_slotIndex(language, word)];
+        slot.language = language;
+        slot.wordSize = word.size();
+        std::memcpy(slot.word, word.rawData(), word.size());
+        slot.stemSize = stem.size();
+        std::memcpy(slot.stem, stem.rawData(), stem.size());
+    }
+
+    static StemCache& get() {
+        thread_local auto cache = std::make_unique<StemCache>();
+        return *cache;
+    }
+
+private:
+    struct Slot {
+        const FTSLanguage* language{nullptr};
+        size_t wordSize{0};
+        size_t stemSize{0};
+        char word[kMaxWordSize];
+        char stem[kMaxWordSize];
+    };
+
+    static size_t _slotIndex(const FTSLanguage* language, StringData word) {
+        return absl::HashOf(language, std::string_view{word}) % kNumSlots;  // NOLINT
+    }
+
+    std::array<Slot, kNumSlots> _slots;
+};
+}  // namespace
 
 class Stemmer::Impl {
 public:
-    explicit Impl(const FTSLanguage* language) : _stemmer{_makeStemmer(language->str())} {}
+    explicit Impl(const FTSLanguage* language)
+        : _language{language}, _stemmer{_makeStemmer(language->str())} {}
 
     StringData stem(StringData word) const {
         auto st = _stemmer.get();
         if (!st)
             return word;
-        auto sym =
-            sb_stemmer_stem(st, reinterpret_cast<const sb_symbol*>(word.rawData()), word.size());
-        invariant(sym);
-        return StringData{reinterpret_cast<const char*>(sym),
-                          static_cast<size_t>(sb_stemmer_length(st))};
+
+        // Long words are rare and unlikely to repeat, so don't let them churn the cache.
+        if (word.size() > StemCache::kMaxWordSize) {
+            return _stemUncached(word);
+        }
+
+        auto& cache = StemCache::get();
+        if (auto cached = cache.find(_language, word); !cached.empty()) {
+            // Copy out of the cache, so the result stays valid however other stemmers on this
+            // thread change the cache before our next call.
+            _lastStem.assign(cached.rawData(), cached.size());
+            return _lastStem;
+        }
+
+        StringData stemmed = _stemUncached(word);
+        cache.add(_language, word, stemmed);
+        return stemmed;
     }
 
 private:
@@ -66,7 +148,20 @@ private:
         return {sb_stemmer_new(lang.c_str(), "UTF_8"), {}};
     }
 
+    StringData _stemUncached(StringData word) const {
+        auto st = _stemmer.get();
+        auto sym =
+            sb_stemmer_stem(st, reinterpret_cast<const sb_symbol*>(word.rawData()), word.size());
+        invariant(sym);
+        return StringData{reinterpret_cast<const char*>(sym),
+                          static_cast<size_t>(sb_stemmer_length(st))};
+    }
+
+    const FTSLanguage* _language;
     std::unique_ptr<sb_stemmer, SbStemmerDeleter> _stemmer;
+
+    // Holds the result of the last call to stem() that was served from the cache.
+    mutable std::string _lastStem;
 };
 
 Stemmer::Stemmer(const FTSLanguage* language) : _impl{std::make_unique<Impl>(language)} {}
@@ -27,9 +27,13 @@
  *    it in the license file.
  */
 
+#include <array>
+#include <string>
+#include <vector>
 
 #include "mongo/db/fts/fts_util.h"
 #include "mongo/db/fts/stemmer.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/framework.h"
 
@@ -56,5 +60,44 @@ TEST(English, Caps) {
     ASSERT_EQUALS("unit", s.stem("united"));
     ASSERT_EQUALS("Unite", s.stem("United"));
 }
+
+// Stemming the same word repeatedly is served from the thread's stem cache and must not change the
+// result, including across stemmers for different languages.
+TEST(English, RepeatedStems) {
+    Stemmer english(languageEnglishV2());
+    Stemmer porter(languagePorterV1());
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_EQUALS("run", english.stem("running"));
+        ASSERT_EQUALS("unit", porter.stem("united"));
+        ASSERT_EQUALS("Run", english.stem("Running"));
+    }
+}
+
+// Stemming more distinct words than the cache holds evicts older entries, which must then be
+// stemmed again with the same result. Each thread stems through its own cache.
+TEST(English, StemsSurviveCacheEviction) {
+    auto stemAll = [](bool* allCorrect) {
+        Stemmer english(languageEnglishV2());
+        for (int i = 0; i < 20000; ++i) {
+            // Words without a suffix stem to themselves.
+            std::string word = "w" + std::to_string(i);
+            *allCorrect &= english.stem(word) == word;
+            *allCorrect &= english.stem("running") == "run";
+        }
+    };
+
+    std::array<bool, 4> allCorrect;
+    allCorrect.fill(true);
+    std::vector<stdx::thread> threads;
+    for (auto& result : allCorrect) {
+        threads.emplace_back(stemAll, &result);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (bool result : allCorrect) {
+        ASSERT_TRUE(result);
+    }
+}
 }  // namespace fts
 }  // namespace mongo
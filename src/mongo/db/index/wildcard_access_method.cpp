@@ -27,18 +27,25 @@
  *    it in the license file.
  */
 
+#include <algorithm>
 #include <boost/move/utility_core.hpp>
+#include <iterator>
+#include <tuple>
 #include <utility>
 
 #include <boost/optional/optional.hpp>
 
 #include "mongo/bson/bsonelement.h"
 #include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/bsontypes.h"
 #include "mongo/db/catalog/index_catalog_entry.h"
 #include "mongo/db/index/index_descriptor.h"
 #include "mongo/db/index/wildcard_access_method.h"
+#include "mongo/db/index/wildcard_path_statistics_gen.h"
 #include "mongo/db/index_names.h"
 #include "mongo/db/storage/key_format.h"
+#include "mongo/db/storage/recovery_unit.h"
+#include "mongo/db/transaction_resources.h"
 
 namespace mongo {
 
@@ -50,7 +57,8 @@ WildcardAccessMethod::WildcardAccessMethod(IndexCatalogEntry* wildcardState,
               wildcardState->getCollator(),
               getSortedDataInterface()->getKeyStringVersion(),
               getSortedDataInterface()->getOrdering(),
-              getSortedDataInterface()->rsKeyFormat()) {}
+              getSortedDataInterface()->rsKeyFormat()),
+      _pathStatistics(WildcardPathStatisticsRegistry::get().acquire(wildcardState->getIdent())) {}
 
 bool WildcardAccessMethod::shouldMarkIndexAsMultikey(size_t numberOfKeys,
                                                      const KeyStringSet& multikeyMetadataKeys,
@@ -68,7 +76,114 @@ void WildcardAccessMethod::doGetKeys(OperationContext* opCtx,
                                      KeyStringSet* multikeyMetadataKeys,
                                      MultikeyPaths* multikeyPaths,
                                      const boost::optional<RecordId>& id) const {
-    _keyGen.generateKeys(pooledBufferBuilder, obj, keys, multikeyMetadataKeys, id);
+    // Only writes of a document are counted: validation and lookups by key have no RecordId.
+    const bool countPathKeys = id && context != GetKeysContext::kValidatingKeys &&
+        gWildcardIndexPathStatisticsEnabled.load();
+    std::vector<WildcardKeyGenerator::PathKey> pathKeys;
+    _keyGen.generateKeys(pooledBufferBuilder,
+                         obj,
+                         keys,
+                         multikeyMetadataKeys,
+                         id,
+                         countPathKeys ? &pathKeys : nullptr);
+    if (multikeyMetadataKeys && !multikeyMetadataKeys->empty()) {
+        _recordMultikeyMetadataKeys(*multikeyMetadataKeys);
+    }
+    if (!pathKeys.empty()) {
+        _recordPathKeys(opCtx, entry, std::move(pathKeys), context);
+    }
+}
+
+void WildcardAccessMethod::_recordMultikeyMetadataKeys(
+    const KeyStringSet& multikeyMetadataKeys) const {
+    auto& recorded = _recordedMetadataKeys[WildcardPathStatistics::currentShard()];
+    stdx::lock_guard<stdx::mutex> lk(recorded.mutex);
+    std::vector<std::string> newPaths;
+    for (const auto& keyString : multikeyMetadataKeys) {
+        if (!recorded.keys.emplace(keyString.getBuffer(), keyString.getSize()).second) {
+            continue;
+        }
+
+        // Metadata keys have the form {["": MinKey, ] "": 1, "": "multikey.path" [, "": MinKey]}.
+        const auto key = key_string::toBson(keyString, getSortedDataInterface()->getOrdering());
+        BSONObjIterator iter(key);
+        while (iter.more()) {
+            const auto elem = iter.next();
+            if (elem.type() != BSONType::MinKey) {
+                invariant(iter.more());
+                newPaths.push_back(iter.next().str());
+                break;
+            }
+        }
+    }
+    if (newPaths.empty()) {
+        return;
+    }
+
+    for (const auto& path : newPaths) {
+        _pathStatistics->recordMultikeyPath(path);
+    }
+
+    // Another writer on this shard may skip these keys as soon as they are in 'recorded', so they
+    // must reach the summary before the shard lock is released, lest that writer commit first.
+    stdx::lock_guard<stdx::mutex> summaryLk(_multikeyPathSummaryMutex);
+    _multikeyPathSummary.insert(std::make_move_iterator(newPaths.begin()),
+                                std::make_move_iterator(newPaths.end()));
+}
+
+void WildcardAccessMethod::_recordPathKeys(OperationContext* opCtx,
+                                           const IndexCatalogEntry* entry,
+                                           std::vector<WildcardKeyGenerator::PathKey> pathKeys,
+                                           GetKeysContext context) const {
+    // Keys of one document with equal paths and values are a single index entry.
+    const auto asTuple = [](const WildcardKeyGenerator::PathKey& pathKey) {
+        return std::tie(pathKey.path, pathKey.valueHash);
+    };
+    std::sort(pathKeys.begin(), pathKeys.end(), [&](const auto& lhs, const auto& rhs) {
+        return asTuple(lhs) < asTuple(rhs);
+    });
+    pathKeys.erase(std::unique(pathKeys.begin(),
+                               pathKeys.end(),
+                               [&](const auto& lhs, const auto& rhs) {
+                                   return asTuple(lhs) == asTuple(rhs);
+                               }),
+                   pathKeys.end());
+
+    const int sign = context == GetKeysContext::kRemovingKeys ? -1 : 1;
+    auto ru = shard_role_details::getRecoveryUnit(opCtx);
+    if (ru->inUnitOfWork()) {
+        ru->onCommit([stats = _pathStatistics, pathKeys = std::move(pathKeys), sign](
+                         OperationContext*, boost::optional<Timestamp>) {
+            stats->recordKeys(pathKeys, sign);
+        });
+    } else if (!entry->isReady()) {
+        // An index build's collection scan generates keys outside of any write unit of work, and
+        // the keys it generates are always inserted. Writes concurrent with the build may be
+        // counted by both the scan and their own commit, which overestimates their paths.
+        _pathStatistics->recordKeys(pathKeys, sign);
+    }
+}
+
+bool WildcardAccessMethod::visitMultikeyPathSummary(
+    function_ref<void(const std::set<std::string>&)> visitor) const {
+    stdx::lock_guard<stdx::mutex> lk(_multikeyPathSummaryMutex);
+    if (!_multikeyPathSummarySeeded) {
+        return false;
+    }
+    visitor(_multikeyPathSummary);
+    return true;
+}
+
+void WildcardAccessMethod::seedMultikeyPathSummary(const std::set<FieldRef>& scannedPaths) const {
+    for (const auto& path : scannedPaths) {
+        _pathStatistics->recordMultikeyPath(path.dottedField());
+    }
+
+    stdx::lock_guard<stdx::mutex> lk(_multikeyPathSummaryMutex);
+    for (const auto& path : scannedPaths) {
+        _multikeyPathSummary.emplace(path.dottedField());
+    }
+    _multikeyPathSummarySeeded = true;
 }
 
 Ordering WildcardAccessMethod::makeOrdering(const BSONObj& pattern) {
@@ -29,23 +29,32 @@
 
 #pragma once
 
+#include <absl/container/flat_hash_set.h>
+#include <array>
 #include <boost/optional/optional.hpp>
 #include <cstddef>
 #include <memory>
+#include <set>
+#include <string>
+#include <vector>
 
 #include "mongo/bson/bsonobj.h"
 #include "mongo/bson/ordering.h"
 #include "mongo/db/catalog/index_catalog_entry.h"
 #include "mongo/db/exec/index_path_projection.h"
+#include "mongo/db/field_ref.h"
 #include "mongo/db/index/index_access_method.h"
 #include "mongo/db/index/multikey_paths.h"
 #include "mongo/db/index/wildcard_key_generator.h"
+#include "mongo/db/index/wildcard_path_statistics.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/query/index_bounds.h"
 #include "mongo/db/record_id.h"
 #include "mongo/db/storage/key_string/key_string.h"
 #include "mongo/db/storage/sorted_data_interface.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/util/functional.h"
 #include "mongo/util/shared_buffer_fragment.h"
 
 namespace mongo {
@@ -56,6 +65,16 @@ namespace mongo {
  *
  * $** indexes store a special metadata key for each path in the index that is multikey. This class
  * provides an interface to access the multikey metadata: see getMultikeyPaths().
+ *
+ * Multikey metadata keys are never removed once written, so this class also keeps an in-memory
+ * summary of the multikey paths. Every metadata key generated through this access method is added
+ * to the summary before the write which produces it can commit, and the summary becomes usable once
+ * it has been seeded with the metadata keys visible to one full scan of the index. From then on it
+ * is a super-set of the committed multikey paths, which is all the query planner needs.
+ *
+ * This class also maintains the index's per-path statistics (see WildcardPathStatistics) from the
+ * keys of every committed insert, update and delete, and from the keys of an index build's
+ * collection scan.
  */
 class WildcardAccessMethod final : public SortedDataIndexAccessMethod {
 public:
@@ -87,6 +106,26 @@ public:
      */
     static Ordering makeOrdering(const BSONObj& pattern);
 
+    /**
+     * Invokes 'visitor' with the sorted set of multikey paths in the in-memory summary while
+     * holding the summary's lock, and returns true. Returns false without invoking 'visitor' if the
+     * summary has not been seeded yet; see seedMultikeyPathSummary().
+     */
+    bool visitMultikeyPathSummary(function_ref<void(const std::set<std::string>&)> visitor) const;
+
+    /**
+     * Merges 'scannedPaths', the multikey paths read by a full scan of this index's metadata keys,
+     * into the in-memory summary and marks the summary as usable.
+     */
+    void seedMultikeyPathSummary(const std::set<FieldRef>& scannedPaths) const;
+
+    /**
+     * Returns the per-path statistics of this index.
+     */
+    const WildcardPathStatistics& getPathStatistics() const {
+        return *_pathStatistics;
+    }
+
 private:
     void doGetKeys(OperationContext* opCtx,
                    const CollectionPtr& collection,
@@ -99,6 +138,39 @@ private:
                    MultikeyPaths* multikeyPaths,
                    const boost::optional<RecordId>& id) const final;
 
+    /**
+     * Adds the paths of any metadata keys in 'multikeyMetadataKeys' to the multikey path summary.
+     */
+    void _recordMultikeyMetadataKeys(const KeyStringSet& multikeyMetadataKeys) const;
+
+    /**
+     * Counts 'pathKeys', the keys generated for one document in 'context', in the path statistics
+     * once the write which generated them commits.
+     */
+    void _recordPathKeys(OperationContext* opCtx,
+                         const IndexCatalogEntry* entry,
+                         std::vector<WildcardKeyGenerator::PathKey> pathKeys,
+                         GetKeysContext context) const;
+
+    // Raw bytes of the metadata keys already folded into '_multikeyPathSummary', so that repeated
+    // inserts of documents with the same array paths do not need to decode their metadata keys.
+    // Sharded like the path statistics, so that such inserts only take the lock of their shard.
+    struct alignas(64) RecordedMetadataKeys {
+        stdx::mutex mutex;
+        absl::flat_hash_set<std::string> keys;
+    };
+
     const WildcardKeyGenerator _keyGen;
+
+    const std::shared_ptr<WildcardPathStatistics> _pathStatistics;
+
+    mutable std::array<RecordedMetadataKeys, WildcardPathStatistics::kNumShards>
+        _recordedMetadataKeys;
+
+    // Only taken when a shard records a metadata key it has not seen before, and by readers.
+    mutable stdx::mutex _multikeyPathSummaryMutex;
+    // Multikey paths generated through this access method, plus those read by the seeding scan.
+    mutable std::set<std::string> _multikeyPathSummary;
+    mutable bool _multikeyPathSummarySeeded = false;
 };
 }  // namespace mongo
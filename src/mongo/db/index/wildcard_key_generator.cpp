@@ -56,6 +56,7 @@
 #include "mongo/db/record_id_helpers.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/intrusive_counter.h"
+#include "mongo/util/murmur3.h"
 #include "mongo/util/str.h"
 
 namespace mongo {
@@ -123,6 +124,7 @@ public:
                              SharedBufferFragmentBuilder& pooledBufferBuilder,
                              KeyStringSet::sequence_type* keys,
                              KeyStringSet::sequence_type* multikeyPaths,
+                             std::vector<WildcardKeyGenerator::PathKey>* pathKeys,
                              const std::vector<BSONElement>& preElems,
                              const std::vector<BSONElement>& postElems)
         : _keyStringVersion(keyStringVersion),
@@ -133,6 +135,7 @@ public:
           _pooledBufferBuilder(pooledBufferBuilder),
           _keys(keys),
           _multikeyPaths(multikeyPaths),
+          _pathKeys(pathKeys),
           _preElems(preElems),
           _postElems(postElems) {}
 
@@ -160,6 +163,7 @@ private:
     SharedBufferFragmentBuilder& _pooledBufferBuilder;
     KeyStringSet::sequence_type* _keys;
     KeyStringSet::sequence_type* _multikeyPaths;
+    std::vector<WildcardKeyGenerator::PathKey>* _pathKeys;
     const std::vector<BSONElement>& _preElems;
     const std::vector<BSONElement>& _postElems;
 };
@@ -210,6 +214,7 @@ void SingleDocumentKeyEncoder::_addKey(BSONElement elem, const FieldRef& fullPat
     }
 
     keyString.appendString(fullPath.dottedField());
+    const auto valueOffset = keyString.getSize();
     if (_collator && elem) {
         keyString.appendBSONElement(elem, [&](StringData stringData) {
             return _collator->getComparisonString(stringData);
@@ -220,6 +225,14 @@ void SingleDocumentKeyEncoder::_addKey(BSONElement elem, const FieldRef& fullPat
         keyString.appendUndefined();
     }
 
+    if (_pathKeys) {
+        // Hash the encoded value rather than the element, so that values which compare equal under
+        // the index's collation and ordering hash equally.
+        const StringData encodedValue(keyString.getBuffer() + valueOffset,
+                                      keyString.getSize() - valueOffset);
+        _pathKeys->push_back({std::string{fullPath.dottedField()}, murmur3<8>(encodedValue, 0)});
+    }
+
     if (!_postElems.empty()) {
         appendToKeyString(_postElems, _collator, &keyString);
     }
@@ -367,7 +380,8 @@ void WildcardKeyGenerator::generateKeys(SharedBufferFragmentBuilder& pooledBuffe
                                         BSONObj inputDoc,
                                         KeyStringSet* keys,
                                         KeyStringSet* multikeyPaths,
-                                        const boost::optional<RecordId>& id) const {
+                                        const boost::optional<RecordId>& id,
+                                        std::vector<PathKey>* pathKeys) const {
     tassert(6868511,
             "To add multi keys to 'multikeyPaths', the key format 'rsKeyFormat' must be provided "
             "at the constructor",
@@ -402,6 +416,7 @@ void WildcardKeyGenerator::generateKeys(SharedBufferFragmentBuilder& pooledBuffe
                                         pooledBufferBuilder,
                                         &keysSequence,
                                         multikeyPaths ? &multikeyPathsSequence : nullptr,
+                                        pathKeys,
                                         preElems,
                                         postElems};
 
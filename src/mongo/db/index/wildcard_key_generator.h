@@ -31,6 +31,9 @@
 
 #include <boost/none.hpp>
 #include <boost/optional/optional.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
 
 #include "mongo/base/string_data.h"
 #include "mongo/bson/bsonobj.h"
@@ -62,6 +65,15 @@ class WildcardKeyGenerator {
 public:
     static constexpr StringData kSubtreeSuffix = WildcardNames::WILDCARD_FIELD_NAME_SUFFIX;
 
+    /**
+     * The path of one generated key, along with a hash of the key's collation-aware value which
+     * stays stable across restarts.
+     */
+    struct PathKey {
+        std::string path;
+        uint64_t valueHash;
+    };
+
     /**
      * Returns an owned ProjectionExecutor identical to the one that WildcardKeyGenerator will use
      * internally when generating the keys for the $** index, as defined by the 'keyPattern' and
@@ -90,12 +102,14 @@ public:
      * Also adds one entry to 'multikeyPaths' for each array encountered in the post-projection
      * document, in the following format:
      *      { '': 1, '': 'path.to.array' }
+     * If 'pathKeys' is not null, also appends one entry to it for each path-value key generated.
      */
     void generateKeys(SharedBufferFragmentBuilder& pooledBufferBuilder,
                       BSONObj inputDoc,
                       KeyStringSet* keys,
                       KeyStringSet* multikeyPaths,
-                      const boost::optional<RecordId>& id = boost::none) const;
+                      const boost::optional<RecordId>& id = boost::none,
+                      std::vector<PathKey>* pathKeys = nullptr) const;
 
 private:
     WildcardProjection _proj;
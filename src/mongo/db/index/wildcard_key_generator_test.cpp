@@ -36,6 +36,7 @@
 #include <initializer_list>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include "mongo/bson/bsonmisc.h"
 #include "mongo/bson/bsonobjbuilder.h"
@@ -1440,5 +1441,55 @@ TEST_F(WildcardKeyGeneratorCompoundTest, CannotCompoundWithMultikeyField) {
                        7246301);
 }
 
+// Path key tests.
+struct WildcardKeyGeneratorPathKeyTest : public WildcardKeyGeneratorTest {};
+
+TEST_F(WildcardKeyGeneratorPathKeyTest, ReportsOnePathKeyPerGeneratedKey) {
+    WildcardKeyGenerator keyGen{fromjson("{'$**': 1}"),
+                                {},
+                                nullptr,
+                                key_string::Version::kLatestVersion,
+                                Ordering::make(BSONObj()),
+                                rsKeyFormat};
+    auto inputDoc = fromjson("{a: 1, b: {c: 1}, d: [2, 2, 3]}");
+
+    KeyStringSet outputKeys;
+    KeyStringSet multikeyMetadataKeys;
+    std::vector<WildcardKeyGenerator::PathKey> pathKeys;
+    keyGen.generateKeys(
+        allocator, inputDoc, &outputKeys, &multikeyMetadataKeys, RecordId(1), &pathKeys);
+
+    std::vector<std::string> paths;
+    for (const auto& pathKey : pathKeys) {
+        paths.push_back(pathKey.path);
+    }
+    ASSERT(paths == std::vector<std::string>({"a", "b.c", "d", "d", "d"}));
+
+    // Equal values hash equally, whatever their path.
+    ASSERT_EQ(pathKeys[0].valueHash, pathKeys[1].valueHash);
+    ASSERT_EQ(pathKeys[2].valueHash, pathKeys[3].valueHash);
+    ASSERT_NE(pathKeys[0].valueHash, pathKeys[2].valueHash);
+    ASSERT_NE(pathKeys[3].valueHash, pathKeys[4].valueHash);
+}
+
+TEST_F(WildcardKeyGeneratorPathKeyTest, HashesValuesEqualUnderCollationEqually) {
+    CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kToLowerString);
+    WildcardKeyGenerator keyGen{fromjson("{'$**': 1}"),
+                                {},
+                                &collator,
+                                key_string::Version::kLatestVersion,
+                                Ordering::make(BSONObj()),
+                                rsKeyFormat};
+    auto inputDoc = fromjson("{a: 'Foo', b: 'fOO', c: 'bar'}");
+
+    KeyStringSet outputKeys;
+    std::vector<WildcardKeyGenerator::PathKey> pathKeys;
+    keyGen.generateKeys(allocator, inputDoc, &outputKeys, nullptr, RecordId(1), &pathKeys);
+
+    ASSERT_EQ(pathKeys.size(), 3u);
+    ASSERT_EQ(pathKeys[0].valueHash, pathKeys[1].valueHash);
+    ASSERT_NE(pathKeys[0].valueHash, pathKeys[2].valueHash);
+}
+
 }  // namespace
 }  // namespace mongo
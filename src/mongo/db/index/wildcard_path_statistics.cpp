@@ -0,0 +1,255 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/index/wildcard_path_statistics.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/platform/bits.h"
+#include "mongo/util/static_immortal.h"
+
+namespace mongo {
+namespace {
+
+constexpr StringData kNumKeysFieldName = "numKeys"_sd;
+constexpr StringData kMultikeyFieldName = "multikey"_sd;
+constexpr StringData kSketchFieldName = "sketch"_sd;
+
+// The number of low bits of a value hash which select a HyperLogLog register.
+constexpr int kRegisterIndexBits = 6;
+static_assert(WildcardPathStatistics::kNumRegisters == 1 << kRegisterIndexBits);
+
+// Returns the 1-based position of the first set bit of the hash bits which do not select the
+// register, as HyperLogLog stores it.
+uint8_t registerRank(uint64_t valueHash) {
+    return countLeadingZeros64(valueHash >> kRegisterIndexBits) - kRegisterIndexBits + 1;
+}
+
+}  // namespace
+
+size_t WildcardPathStatistics::currentShard() {
+    static AtomicWord<size_t> nextShard{0};
+    thread_local const size_t shard = nextShard.fetchAndAdd(1) % kNumShards;
+    return shard;
+}
+
+void WildcardPathStatistics::recordKeys(const std::vector<PathKey>& pathKeys, int sign) {
+    auto& shard = _shards[currentShard()];
+    stdx::lock_guard<stdx::mutex> lk(shard.mutex);
+    for (const auto& pathKey : pathKeys) {
+        auto& stats = shard.paths[pathKey.path];
+        stats.numKeys += sign;
+        if (sign > 0) {
+            auto& reg = stats.sketch[pathKey.valueHash & (kNumRegisters - 1)];
+            reg = std::max(reg, registerRank(pathKey.valueHash));
+        }
+    }
+}
+
+void WildcardPathStatistics::recordMultikeyPath(StringData path) {
+    auto& shard = _shards[currentShard()];
+    stdx::lock_guard<stdx::mutex> lk(shard.mutex);
+    shard.paths[std::string{path}].multikey = true;
+}
+
+void WildcardPathStatistics::fold() {
+    for (auto& shard : _shards) {
+        absl::flat_hash_map<std::string, PathStats> drained;
+        {
+            stdx::lock_guard<stdx::mutex> lk(shard.mutex);
+            drained.swap(shard.paths);
+        }
+        if (drained.empty()) {
+            continue;
+        }
+
+        stdx::lock_guard<stdx::mutex> lk(_mergedMutex);
+        for (auto& [path, delta] : drained) {
+            auto& stats = _merged[path];
+            stats.numKeys += delta.numKeys;
+            stats.multikey |= delta.multikey;
+            for (size_t i = 0; i < kNumRegisters; ++i) {
+                stats.sketch[i] = std::max(stats.sketch[i], delta.sketch[i]);
+            }
+            if (stats.numKeys <= 0 && _loaded) {
+                // A path left without keys starts its distinct value estimate over. Before the
+                // persisted statistics are loaded, a negative count is only a pending removal.
+                stats.numKeys = 0;
+                stats.sketch.fill(0);
+                if (!stats.multikey) {
+                    _merged.erase(path);
+                }
+            }
+            _changedPaths.insert(path);
+        }
+    }
+}
+
+WildcardPathStatistics::PathSummary WildcardPathStatistics::_summarize(const PathStats& stats) {
+    PathSummary summary;
+    summary.numKeys = std::max(stats.numKeys, 0LL);
+    summary.multikey = stats.multikey;
+
+    double sum = 0;
+    size_t numEmptyRegisters = 0;
+    for (auto reg : stats.sketch) {
+        sum += std::ldexp(1.0, -reg);
+        numEmptyRegisters += reg == 0;
+    }
+    const double m = kNumRegisters;
+    double estimate = 0.709 * m * m / sum;
+    if (estimate <= 2.5 * m && numEmptyRegisters > 0) {
+        // Linear counting is more accurate than the raw estimate for small cardinalities.
+        estimate = m * std::log(m / numEmptyRegisters);
+    }
+    summary.numDistinctValues =
+        std::min(static_cast<long long>(std::llround(estimate)), summary.numKeys);
+    return summary;
+}
+
+boost::optional<WildcardPathStatistics::PathSummary> WildcardPathStatistics::getPath(
+    StringData path) const {
+    stdx::lock_guard<stdx::mutex> lk(_mergedMutex);
+    auto it = _merged.find(std::string_view{path});  // NOLINT
+    if (it == _merged.end() || it->second.numKeys <= 0) {
+        return boost::none;
+    }
+    return _summarize(it->second);
+}
+
+void WildcardPathStatistics::visitPaths(
+    function_ref<void(StringData, const PathSummary&)> visitor) const {
+    stdx::lock_guard<stdx::mutex> lk(_mergedMutex);
+    for (const auto& [path, stats] : _merged) {
+        visitor(path, _summarize(stats));
+    }
+}
+
+bool WildcardPathStatistics::loadPath(StringData path, const BSONObj& stats) {
+    const auto numKeys = stats[kNumKeysFieldName];
+    const auto multikey = stats[kMultikeyFieldName];
+    const auto sketch = stats[kSketchFieldName];
+    if (!numKeys.isNumber() || multikey.type() != BSONType::Bool ||
+        sketch.type() != BSONType::BinData) {
+        return false;
+    }
+    int sketchLength = 0;
+    const char* registers = sketch.binData(sketchLength);
+    if (sketchLength != static_cast<int>(kNumRegisters)) {
+        return false;
+    }
+
+    stdx::lock_guard<stdx::mutex> lk(_mergedMutex);
+    auto& merged = _merged[std::string{path}];
+    merged.numKeys += numKeys.safeNumberLong();
+    merged.multikey |= multikey.boolean();
+    for (size_t i = 0; i < kNumRegisters; ++i) {
+        merged.sketch[i] = std::max(merged.sketch[i], static_cast<uint8_t>(registers[i]));
+    }
+    return true;
+}
+
+void WildcardPathStatistics::setLoaded() {
+    stdx::lock_guard<stdx::mutex> lk(_mergedMutex);
+    _loaded = true;
+}
+
+bool WildcardPathStatistics::isLoaded() const {
+    stdx::lock_guard<stdx::mutex> lk(_mergedMutex);
+    return _loaded;
+}
+
+std::vector<std::pair<std::string, BSONObj>> WildcardPathStatistics::takeChangedPaths() {
+    stdx::lock_guard<stdx::mutex> lk(_mergedMutex);
+    std::vector<std::pair<std::string, BSONObj>> changed;
+    changed.reserve(_changedPaths.size());
+    for (auto& path : _changedPaths) {
+        auto it = _merged.find(path);
+        if (it == _merged.end() || (it->second.numKeys <= 0 && !it->second.multikey)) {
+            changed.emplace_back(path, BSONObj());
+            continue;
+        }
+
+        BSONObjBuilder bob;
+        bob.append(kNumKeysFieldName, std::max(it->second.numKeys, 0LL));
+        bob.append(kMultikeyFieldName, it->second.multikey);
+        bob.appendBinData(kSketchFieldName,
+                          static_cast<int>(kNumRegisters),
+                          BinDataGeneral,
+                          it->second.sketch.data());
+        changed.emplace_back(path, bob.obj());
+    }
+    _changedPaths.clear();
+    return changed;
+}
+
+void WildcardPathStatistics::restoreChangedPaths(
+    const std::vector<std::pair<std::string, BSONObj>>& paths) {
+    stdx::lock_guard<stdx::mutex> lk(_mergedMutex);
+    for (const auto& [path, stats] : paths) {
+        _changedPaths.insert(path);
+    }
+}
+
+WildcardPathStatisticsRegistry& WildcardPathStatisticsRegistry::get() {
+    static StaticImmortal<WildcardPathStatisticsRegistry> registry;
+    return *registry;
+}
+
+std::shared_ptr<WildcardPathStatistics> WildcardPathStatisticsRegistry::acquire(StringData ident) {
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    auto& stats = _byIdent[std::string{ident}];
+    if (!stats) {
+        stats = std::make_shared<WildcardPathStatistics>();
+    }
+    return stats;
+}
+
+std::vector<std::pair<std::string, std::shared_ptr<WildcardPathStatistics>>>
+WildcardPathStatisticsRegistry::getAll() const {
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    return {_byIdent.begin(), _byIdent.end()};
+}
+
+std::shared_ptr<WildcardPathStatistics> WildcardPathStatisticsRegistry::releaseIfUnused(
+    StringData ident) {
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    auto it = _byIdent.find(std::string_view{ident});  // NOLINT
+    if (it == _byIdent.end() || it->second.use_count() > 1) {
+        return nullptr;
+    }
+    auto stats = std::move(it->second);
+    _byIdent.erase(it);
+    return stats;
+}
+
+}  // namespace mongo
@@ -0,0 +1,197 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/optional/optional.hpp>
+
+#include "mongo/base/string_data.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/db/index/wildcard_key_generator.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/util/functional.h"
+
+namespace mongo {
+
+/**
+ * Per-path statistics of one wildcard index: the number of keys the index holds for each path, an
+ * estimate of the number of distinct values among those keys, and whether the path is multikey.
+ *
+ * Writers record their committed key changes into one of several shards chosen by the writing
+ * thread, so concurrent writes to the same index rarely take the same lock. fold() drains the
+ * shards into a merged view, which is what readers and persistence see; reads therefore lag the
+ * writes by up to one fold.
+ *
+ * The distinct-value estimate comes from a small HyperLogLog sketch per path. Removing keys lowers
+ * the key count but cannot lower the sketch, so the estimate is capped at the key count and the
+ * sketch starts over once a path has no keys left.
+ */
+class WildcardPathStatistics {
+public:
+    // The number of independently locked shards writers record into.
+    static constexpr size_t kNumShards = 16;
+
+    // The number of HyperLogLog registers per path. The relative standard error of the distinct
+    // value estimate is about 1.04 / sqrt(kNumRegisters), that is 13%.
+    static constexpr size_t kNumRegisters = 64;
+
+    using PathKey = WildcardKeyGenerator::PathKey;
+
+    /**
+     * The statistics of one path as seen by readers.
+     */
+    struct PathSummary {
+        long long numKeys = 0;
+        long long numDistinctValues = 0;
+        bool multikey = false;
+    };
+
+    /**
+     * Returns the shard the calling thread records into. Threads are spread over the shards
+     * round-robin, in the order in which they first ask.
+     */
+    static size_t currentShard();
+
+    /**
+     * Records that the keys described by 'pathKeys' were added to the index when 'sign' is 1, or
+     * removed from it when 'sign' is -1. Takes only the lock of the calling thread's shard.
+     */
+    void recordKeys(const std::vector<PathKey>& pathKeys, int sign);
+
+    /**
+     * Records that 'path' is multikey. Takes only the lock of the calling thread's shard.
+     */
+    void recordMultikeyPath(StringData path);
+
+    /**
+     * Drains every shard into the merged view.
+     */
+    void fold();
+
+    /**
+     * Returns the merged statistics of 'path', or boost::none if the index holds no key for it.
+     */
+    boost::optional<PathSummary> getPath(StringData path) const;
+
+    /**
+     * Invokes 'visitor' with the merged statistics of every path, in no particular order.
+     */
+    void visitPaths(function_ref<void(StringData, const PathSummary&)> visitor) const;
+
+    /**
+     * Adds the persisted statistics 'stats' of 'path', as produced by takeChangedPaths(), to the
+     * merged view, and returns false if 'stats' is malformed. The merged view holds the changes
+     * recorded since startup, so loading adds to it rather than replacing it.
+     */
+    bool loadPath(StringData path, const BSONObj& stats);
+
+    /**
+     * Marks the persisted statistics as loaded; see loadPath().
+     */
+    void setLoaded();
+    bool isLoaded() const;
+
+    /**
+     * Returns every path whose merged statistics changed since the last call, along with its
+     * serialized statistics, or with an empty object if the index holds no keys for it any more.
+     */
+    std::vector<std::pair<std::string, BSONObj>> takeChangedPaths();
+
+    /**
+     * Marks 'paths' as changed again, after persisting them failed.
+     */
+    void restoreChangedPaths(const std::vector<std::pair<std::string, BSONObj>>& paths);
+
+private:
+    using Sketch = std::array<uint8_t, kNumRegisters>;
+
+    struct PathStats {
+        long long numKeys = 0;
+        bool multikey = false;
+        Sketch sketch{};
+    };
+
+    // Each shard sits on its own cache line so that writers on different shards do not share one.
+    struct alignas(64) Shard {
+        stdx::mutex mutex;
+        absl::flat_hash_map<std::string, PathStats> paths;
+    };
+
+    static PathSummary _summarize(const PathStats& stats);
+
+    std::array<Shard, kNumShards> _shards;
+
+    mutable stdx::mutex _mergedMutex;
+    absl::flat_hash_map<std::string, PathStats> _merged;
+    absl::flat_hash_set<std::string> _changedPaths;
+    bool _loaded = false;
+};
+
+/**
+ * Process-wide registry of the statistics of every wildcard index, keyed by the index's storage
+ * ident. Registered statistics outlive the access method that records into them until they have
+ * been persisted, so that recreating the access method, as when the catalog is reopened, does not
+ * lose changes which have not been persisted yet.
+ */
+class WildcardPathStatisticsRegistry {
+public:
+    static WildcardPathStatisticsRegistry& get();
+
+    /**
+     * Returns the statistics registered for 'ident', registering new ones if there are none.
+     */
+    std::shared_ptr<WildcardPathStatistics> acquire(StringData ident);
+
+    /**
+     * Returns the statistics of every registered index along with its ident.
+     */
+    std::vector<std::pair<std::string, std::shared_ptr<WildcardPathStatistics>>> getAll() const;
+
+    /**
+     * Unregisters and returns the statistics of 'ident' if nothing outside the registry refers to
+     * them any more, so that the caller can persist their last changes. Returns null otherwise.
+     */
+    std::shared_ptr<WildcardPathStatistics> releaseIfUnused(StringData ident);
+
+private:
+    mutable stdx::mutex _mutex;
+    absl::flat_hash_map<std::string, std::shared_ptr<WildcardPathStatistics>> _byIdent;
+};
+
+}  // namespace mongo
@@ -0,0 +1,304 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/index/wildcard_path_statistics_flusher.h"
+
+#include <absl/container/flat_hash_set.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "mongo/bson/bsonmisc.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/client.h"
+#include "mongo/db/dbdirectclient.h"
+#include "mongo/db/index/wildcard_path_statistics.h"
+#include "mongo/db/index/wildcard_path_statistics_gen.h"
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/query/find_command.h"
+#include "mongo/db/query/write_ops/write_ops.h"
+#include "mongo/db/query/write_ops/write_ops_gen.h"
+#include "mongo/db/query/write_ops/write_ops_parsers.h"
+#include "mongo/db/storage/kv/kv_engine.h"
+#include "mongo/db/storage/storage_engine.h"
+#include "mongo/db/transaction_resources.h"
+#include "mongo/logv2/log.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/duration.h"
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kIndex
+
+
+namespace mongo {
+namespace {
+
+constexpr StringData kIdFieldName = "_id"_sd;
+constexpr StringData kIdentFieldName = "ident"_sd;
+constexpr StringData kPathFieldName = "path"_sd;
+
+// The number of writes sent in one update or delete command.
+constexpr size_t kWriteBatchSize = 1000;
+
+// Serializes passes, so that the persisted statistics of an index are only loaded once.
+stdx::mutex flushMutex;
+
+// Whether a pass has looked for the persisted statistics of indexes dropped before startup.
+bool removedStatisticsOfDroppedIndexesAtStartup = false;
+
+// Documents are keyed by {ident: <ident of the index>, path: <indexed path>}.
+BSONObj makePathFilter(StringData ident, StringData path) {
+    return BSON(kIdFieldName << BSON(kIdentFieldName << ident << kPathFieldName << path));
+}
+
+// Matches the documents of every path of the index with the storage ident 'ident'.
+BSONObj makeIdentFilter(StringData ident) {
+    return BSON(kIdFieldName << BSON(
+                    "$gte" << BSON(kIdentFieldName << ident << kPathFieldName << MINKEY) << "$lte"
+                           << BSON(kIdentFieldName << ident << kPathFieldName << MAXKEY)));
+}
+
+write_ops::WriteCommandRequestBase makeUnorderedWriteBase() {
+    write_ops::WriteCommandRequestBase wcb;
+    wcb.setOrdered(false);
+    return wcb;
+}
+
+void runUpdates(DBDirectClient& client, std::vector<write_ops::UpdateOpEntry>& updates) {
+    if (updates.empty()) {
+        return;
+    }
+    write_ops::UpdateCommandRequest updateOp(NamespaceString::kWildcardPathStatisticsNamespace);
+    updateOp.setWriteCommandRequestBase(makeUnorderedWriteBase());
+    updateOp.setUpdates(std::exchange(updates, {}));
+    write_ops::checkWriteErrors(client.update(updateOp));
+}
+
+void runDeletes(DBDirectClient& client, std::vector<write_ops::DeleteOpEntry>& deletes) {
+    if (deletes.empty()) {
+        return;
+    }
+    write_ops::DeleteCommandRequest deleteOp(NamespaceString::kWildcardPathStatisticsNamespace);
+    deleteOp.setWriteCommandRequestBase(makeUnorderedWriteBase());
+    deleteOp.setDeletes(std::exchange(deletes, {}));
+    write_ops::checkWriteErrors(client.remove(deleteOp));
+}
+
+// Folds the statistics of the index with the storage ident 'ident', loading its persisted
+// statistics first if they have not been loaded yet, and persists the paths which changed.
+void flushIndex(OperationContext* opCtx,
+                DBDirectClient& client,
+                StringData ident,
+                WildcardPathStatistics& stats) {
+    stats.fold();
+    if (!stats.isLoaded()) {
+        loadWildcardPathStatistics(opCtx, ident, stats);
+        stats.fold();
+    }
+
+    const auto changed = stats.takeChangedPaths();
+    try {
+        std::vector<write_ops::UpdateOpEntry> updates;
+        std::vector<write_ops::DeleteOpEntry> deletes;
+        for (const auto& [path, pathStats] : changed) {
+            if (pathStats.isEmpty()) {
+                deletes.emplace_back(makePathFilter(ident, path), false /* multi */);
+            } else {
+                write_ops::UpdateOpEntry update(
+                    makePathFilter(ident, path),
+                    write_ops::UpdateModification::parseFromClassicUpdate(
+                        BSON("$set" << pathStats)));
+                update.setUpsert(true);
+                updates.push_back(std::move(update));
+            }
+            if (updates.size() == kWriteBatchSize) {
+                runUpdates(client, updates);
+            }
+            if (deletes.size() == kWriteBatchSize) {
+                runDeletes(client, deletes);
+            }
+        }
+        runUpdates(client, updates);
+        runDeletes(client, deletes);
+    } catch (const DBException&) {
+        // The paths written before the failure are written again by the next pass, which is
+        // harmless since each write sets the whole statistics of its path.
+        stats.restoreChangedPaths(changed);
+        throw;
+    }
+}
+
+// Removes the persisted statistics of those indexes in 'idents' whose idents no longer exist.
+void removeStatisticsOfDroppedIndexes(OperationContext* opCtx,
+                                      DBDirectClient& client,
+                                      const absl::flat_hash_set<std::string>& idents) {
+    if (idents.empty()) {
+        return;
+    }
+
+    const auto engine = opCtx->getServiceContext()->getStorageEngine()->getEngine();
+    const auto allIdents = engine->getAllIdents(*shard_role_details::getRecoveryUnit(opCtx));
+    const absl::flat_hash_set<std::string> existingIdents(allIdents.begin(), allIdents.end());
+
+    std::vector<write_ops::DeleteOpEntry> deletes;
+    for (const auto& ident : idents) {
+        if (!existingIdents.contains(ident)) {
+            deletes.emplace_back(makeIdentFilter(ident), true /* multi */);
+        }
+        if (deletes.size() == kWriteBatchSize) {
+            runDeletes(client, deletes);
+        }
+    }
+    runDeletes(client, deletes);
+}
+
+// Returns the idents of every index with persisted statistics.
+absl::flat_hash_set<std::string> getPersistedIdents(DBDirectClient& client) {
+    FindCommandRequest findRequest{NamespaceString::kWildcardPathStatisticsNamespace};
+    findRequest.setProjection(BSON(kIdFieldName << 1));
+    auto cursor = client.find(std::move(findRequest));
+
+    absl::flat_hash_set<std::string> idents;
+    while (cursor->more()) {
+        const auto id = cursor->next()[kIdFieldName];
+        if (id.type() == BSONType::Object) {
+            const auto ident = id.Obj()[kIdentFieldName];
+            if (ident.type() == BSONType::String) {
+                idents.insert(ident.str());
+            }
+        }
+    }
+    return idents;
+}
+
+}  // namespace
+
+void loadWildcardPathStatistics(OperationContext* opCtx,
+                                StringData ident,
+                                WildcardPathStatistics& stats) {
+    DBDirectClient client(opCtx);
+    FindCommandRequest findRequest{NamespaceString::kWildcardPathStatisticsNamespace};
+    findRequest.setFilter(makeIdentFilter(ident));
+    auto cursor = client.find(std::move(findRequest));
+    while (cursor->more()) {
+        const auto doc = cursor->next();
+        const auto id = doc[kIdFieldName];
+        const auto path = id.type() == BSONType::Object ? id.Obj()[kPathFieldName] : BSONElement();
+        if (path.type() != BSONType::String || !stats.loadPath(path.valueStringData(), doc)) {
+            LOGV2_WARNING(9886612,
+                          "Ignoring malformed wildcard index path statistics",
+                          "document"_attr = redact(doc));
+        }
+    }
+    stats.setLoaded();
+}
+
+void flushWildcardPathStatistics(OperationContext* opCtx) {
+    if (opCtx->readOnly()) {
+        return;
+    }
+
+    stdx::lock_guard<stdx::mutex> lk(flushMutex);
+    DBDirectClient client(opCtx);
+    auto& registry = WildcardPathStatisticsRegistry::get();
+
+    std::vector<std::string> idents;
+    for (const auto& [ident, stats] : registry.getAll()) {
+        flushIndex(opCtx, client, ident, *stats);
+        idents.push_back(ident);
+    }
+
+    // Statistics which no access method refers to any more belong to an index which was dropped,
+    // or whose access method was recreated and will register them again. Persist their last
+    // changes and stop tracking them.
+    absl::flat_hash_set<std::string> released;
+    for (const auto& ident : idents) {
+        if (auto stats = registry.releaseIfUnused(ident)) {
+            flushIndex(opCtx, client, ident, *stats);
+            released.insert(ident);
+        }
+    }
+
+    // An index may be dropped while its ident waits for a two-phase drop, or while the server is
+    // down. The statistics of such indexes are removed by the first pass after the next startup.
+    if (!removedStatisticsOfDroppedIndexesAtStartup) {
+        released.merge(getPersistedIdents(client));
+        removedStatisticsOfDroppedIndexesAtStartup = true;
+    }
+    removeStatisticsOfDroppedIndexes(opCtx, client, released);
+}
+
+auto PeriodicThreadToFlushWildcardPathStatistics::get(ServiceContext* serviceContext)
+    -> PeriodicThreadToFlushWildcardPathStatistics& {
+    auto& jobContainer = _serviceDecoration(serviceContext);
+    jobContainer._init(serviceContext);
+
+    return jobContainer;
+}
+
+auto PeriodicThreadToFlushWildcardPathStatistics::operator*() const noexcept
+    -> PeriodicJobAnchor& {
+    stdx::lock_guard lk(_mutex);
+    return *_anchor;
+}
+
+auto PeriodicThreadToFlushWildcardPathStatistics::operator->() const noexcept
+    -> PeriodicJobAnchor* {
+    stdx::lock_guard lk(_mutex);
+    return _anchor.get();
+}
+
+void PeriodicThreadToFlushWildcardPathStatistics::_init(ServiceContext* serviceContext) {
+    stdx::lock_guard lk(_mutex);
+    if (_anchor) {
+        return;
+    }
+
+    auto periodicRunner = serviceContext->getPeriodicRunner();
+    invariant(periodicRunner);
+
+    PeriodicRunner::PeriodicJob job(
+        "flushWildcardPathStatistics",
+        [](Client* client) {
+            auto opCtx = client->makeOperationContext();
+            try {
+                flushWildcardPathStatistics(opCtx.get());
+            } catch (const DBException& ex) {
+                LOGV2(9886613,
+                      "Failed to persist wildcard index path statistics",
+                      "error"_attr = redact(ex.toStatus()));
+            }
+        },
+        Seconds(gWildcardIndexPathStatisticsFlushIntervalSecs),
+        false /*isKillableByStepdown*/);
+
+    _anchor = std::make_shared<PeriodicJobAnchor>(periodicRunner->makeJob(std::move(job)));
+}
+
+}  // namespace mongo
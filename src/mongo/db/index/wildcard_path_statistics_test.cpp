@@ -0,0 +1,203 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/index/wildcard_path_statistics.h"
+
+#include <string>
+#include <vector>
+
+#include "mongo/base/string_data.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/framework.h"
+#include "mongo/util/murmur3.h"
+
+namespace mongo {
+namespace {
+
+using PathKey = WildcardPathStatistics::PathKey;
+
+// Returns one key of 'path' for each of the values 'first' to 'last', inclusive.
+std::vector<PathKey> makePathKeys(StringData path, int first, int last) {
+    std::vector<PathKey> pathKeys;
+    for (int value = first; value <= last; ++value) {
+        const auto valueString = std::to_string(value);
+        pathKeys.push_back({std::string{path}, murmur3<8>(valueString, 0)});
+    }
+    return pathKeys;
+}
+
+TEST(WildcardPathStatisticsTest, ReadersOnlySeeFoldedChanges) {
+    WildcardPathStatistics stats;
+    stats.setLoaded();
+    stats.recordKeys(makePathKeys("a", 1, 3), 1);
+    ASSERT_FALSE(stats.getPath("a"));
+
+    stats.fold();
+    auto summary = stats.getPath("a");
+    ASSERT(summary);
+    ASSERT_EQ(summary->numKeys, 3);
+    ASSERT_EQ(summary->numDistinctValues, 3);
+    ASSERT_FALSE(summary->multikey);
+    ASSERT_FALSE(stats.getPath("b"));
+}
+
+TEST(WildcardPathStatisticsTest, MergesChangesRecordedByManyThreads) {
+    WildcardPathStatistics stats;
+    stats.setLoaded();
+
+    constexpr int kNumThreads = 2 * WildcardPathStatistics::kNumShards;
+    std::vector<stdx::thread> threads;
+    for (int i = 0; i < kNumThreads; ++i) {
+        threads.emplace_back([&stats, i] {
+            // Every thread records the same 100 values, and a value of its own.
+            stats.recordKeys(makePathKeys("a", 1, 100), 1);
+            stats.recordKeys(makePathKeys("a", 1000 + i, 1000 + i), 1);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    stats.fold();
+
+    auto summary = stats.getPath("a");
+    ASSERT(summary);
+    ASSERT_EQ(summary->numKeys, kNumThreads * 101);
+    // The sketch's relative standard error is about 13%, so allow three times that.
+    ASSERT_GTE(summary->numDistinctValues, (100 + kNumThreads) * 6 / 10);
+    ASSERT_LTE(summary->numDistinctValues, (100 + kNumThreads) * 14 / 10);
+}
+
+TEST(WildcardPathStatisticsTest, DistinctEstimateIsCappedByKeyCount) {
+    WildcardPathStatistics stats;
+    stats.setLoaded();
+    stats.recordKeys(makePathKeys("a", 1, 1000), 1);
+    stats.recordKeys(makePathKeys("a", 1, 990), -1);
+    stats.fold();
+
+    auto summary = stats.getPath("a");
+    ASSERT(summary);
+    ASSERT_EQ(summary->numKeys, 10);
+    ASSERT_EQ(summary->numDistinctValues, 10);
+}
+
+TEST(WildcardPathStatisticsTest, PathWithoutKeysStartsOver) {
+    WildcardPathStatistics stats;
+    stats.setLoaded();
+    stats.recordKeys(makePathKeys("a", 1, 1000), 1);
+    stats.recordKeys(makePathKeys("a", 1, 1000), -1);
+    stats.fold();
+    ASSERT_FALSE(stats.getPath("a"));
+
+    stats.recordKeys(makePathKeys("a", 1, 1), 1);
+    stats.recordKeys(makePathKeys("a", 1, 1), 1);
+    stats.fold();
+    auto summary = stats.getPath("a");
+    ASSERT(summary);
+    ASSERT_EQ(summary->numKeys, 2);
+    ASSERT_EQ(summary->numDistinctValues, 1);
+}
+
+TEST(WildcardPathStatisticsTest, KeepsPendingRemovalsUntilLoaded) {
+    WildcardPathStatistics stats;
+    stats.recordKeys(makePathKeys("a", 1, 2), -1);
+    stats.fold();
+    ASSERT_FALSE(stats.getPath("a"));
+
+    WildcardPathStatistics persisted;
+    persisted.setLoaded();
+    persisted.recordKeys(makePathKeys("a", 1, 5), 1);
+    persisted.fold();
+    for (const auto& [path, pathStats] : persisted.takeChangedPaths()) {
+        ASSERT(stats.loadPath(path, pathStats));
+    }
+    stats.setLoaded();
+
+    auto summary = stats.getPath("a");
+    ASSERT(summary);
+    ASSERT_EQ(summary->numKeys, 3);
+    ASSERT_EQ(summary->numDistinctValues, 3);
+}
+
+TEST(WildcardPathStatisticsTest, TakeChangedPathsReportsEachChangeOnce) {
+    WildcardPathStatistics stats;
+    stats.setLoaded();
+    stats.recordKeys(makePathKeys("a", 1, 2), 1);
+    stats.recordKeys(makePathKeys("b", 1, 1), 1);
+    stats.recordMultikeyPath("c");
+    stats.fold();
+
+    auto changed = stats.takeChangedPaths();
+    ASSERT_EQ(changed.size(), 3u);
+    ASSERT(stats.takeChangedPaths().empty());
+
+    // A path without keys is reported with empty statistics, unless it is multikey.
+    stats.recordKeys(makePathKeys("b", 1, 1), -1);
+    stats.fold();
+    changed = stats.takeChangedPaths();
+    ASSERT_EQ(changed.size(), 1u);
+    ASSERT_EQ(changed[0].first, "b");
+    ASSERT(changed[0].second.isEmpty());
+
+    auto summary = stats.getPath("c");
+    ASSERT_FALSE(summary);
+    bool sawMultikeyPath = false;
+    stats.visitPaths([&](StringData path, const WildcardPathStatistics::PathSummary& summary) {
+        sawMultikeyPath |= path == "c" && summary.multikey;
+    });
+    ASSERT(sawMultikeyPath);
+
+    // Paths whose changes failed to persist are reported again.
+    stats.restoreChangedPaths(changed);
+    ASSERT_EQ(stats.takeChangedPaths().size(), 1u);
+}
+
+TEST(WildcardPathStatisticsTest, LoadRejectsMalformedStatistics) {
+    WildcardPathStatistics stats;
+    ASSERT_FALSE(stats.loadPath("a", BSONObj()));
+    ASSERT_FALSE(stats.loadPath("a", BSON("numKeys" << 1 << "multikey" << false)));
+    ASSERT_FALSE(stats.loadPath(
+        "a",
+        BSON("numKeys" << 1 << "multikey" << false << "sketch"
+                       << BSONBinData("x", 1, BinDataGeneral))));
+}
+
+TEST(WildcardPathStatisticsRegistryTest, ReleasesOnlyUnusedStatistics) {
+    auto& registry = WildcardPathStatisticsRegistry::get();
+    auto stats = registry.acquire("wildcard-path-statistics-test-ident");
+    ASSERT_EQ(stats, registry.acquire("wildcard-path-statistics-test-ident"));
+    ASSERT_FALSE(registry.releaseIfUnused("wildcard-path-statistics-test-ident"));
+
+    stats.reset();
+    ASSERT(registry.releaseIfUnused("wildcard-path-statistics-test-ident"));
+    ASSERT_FALSE(registry.releaseIfUnused("wildcard-path-statistics-test-ident"));
+}
+
+}  // namespace
+}  // namespace mongo
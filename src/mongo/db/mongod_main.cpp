@@ -90,6 +90,7 @@
 #include "mongo/db/change_streams_cluster_parameter_gen.h"
 #include "mongo/db/client.h"
 #include "mongo/db/cluster_role.h"
+#include "mongo/db/collection_crud/capped_collection_deleter.h"
 #include "mongo/db/collection_crud/collection_write_path.h"
 #include "mongo/db/commands.h"
 #include "mongo/db/commands/feature_compatibility_version.h"
@@ -109,6 +110,7 @@
 #include "mongo/db/ftdc/ftdc_mongod.h"
 #include "mongo/db/ftdc/util.h"
 #include "mongo/db/global_settings.h"
+#include "mongo/db/index/wildcard_path_statistics_flusher.h"
 #include "mongo/db/index_builds_coordinator.h"
 #include "mongo/db/index_builds_coordinator_mongod.h"
 #include "mongo/db/initialize_server_global_state.h"
@@ -1003,6 +1005,11 @@ ExitCode _initAndListen(ServiceContext* serviceContext) {
             startTTLMonitor(serviceContext);
         }
 
+        // Inserts only defer capped deletes to the deleter thread when given some slack.
+        if (gCappedDeleteSlackPercent.load() > 0) {
+            CappedCollectionDeleter::get(serviceContext)->start();
+        }
+
         if (replSettings.isReplSet() || !gInternalValidateFeaturesAsPrimary) {
             serverGlobalParams.validateFeaturesAsPrimary.store(false);
         }
@@ -1046,9 +1053,13 @@ ExitCode _initAndListen(ServiceContext* serviceContext) {
     //
     // Only do this on storage engines supporting snapshot reads, which hold resources we wish to
     // release periodically in order to avoid storage cache pressure build up.
+    //
+    // Also start up a background task to periodically persist the per-path statistics of wildcard
+    // indexes.
     if (storageEngine->supportsReadConcernSnapshot()) {
         try {
             PeriodicThreadToAbortExpiredTransactions::get(serviceContext)->start();
+            PeriodicThreadToFlushWildcardPathStatistics::get(serviceContext)->start();
         } catch (ExceptionFor<ErrorCodes::PeriodicJobIsStopped>&) {
             LOGV2_WARNING(4747501, "Not starting periodic jobs as shutdown is in progress");
             // Shutdown has already started before initialization is complete. Wait for the
@@ -1797,6 +1808,15 @@ void shutdownTask(const ShutdownTaskArgs& shutdownArgs) {
             PeriodicThreadToAbortExpiredTransactions::get(serviceContext)->stop();
         }
 
+        if (storageEngine->supportsReadConcernSnapshot()) {
+            TimeElapsedBuilderScopedTimer scopedTimer(
+                serviceContext->getFastClockSource(),
+                "Shut down the thread that persists wildcard index path statistics",
+                &shutdownTimeElapsedBuilder);
+            LOGV2(9886614, "Shutting down the PeriodicThreadToFlushWildcardPathStatistics");
+            PeriodicThreadToFlushWildcardPathStatistics::get(serviceContext)->stop();
+        }
+
         {
             stdx::lock_guard lg(*client);
             opCtx->setIsExecutingShutdown();
@@ -2023,6 +2043,14 @@ void shutdownTask(const ShutdownTaskArgs& shutdownArgs) {
         OplogCapMaintainerThread::get(serviceContext)->shutdown();
     }
 
+    {
+        TimeElapsedBuilderScopedTimer scopedTimer(
+            serviceContext->getFastClockSource(),
+            "Wait for the capped collection deleter thread to stop",
+            &shutdownTimeElapsedBuilder);
+        CappedCollectionDeleter::get(serviceContext)->shutdown();
+    }
+
     // We should always be able to acquire the global lock at shutdown.
     //
     // For a Windows service, dbexit does not call exit(), so we must leak the lock outside
@@ -288,6 +288,9 @@ NSS_CONSTANT(kDefaultOplogCollectionNamespace, DatabaseName::kLocal, "temp_oplog
 // Namespace used for local minimum valid namespace.
 NSS_CONSTANT(kDefaultMinValidNamespace, DatabaseName::kLocal, "replset.minvalid"_sd)
 
+// Namespace used to persist the per-path statistics of wildcard indexes on this node.
+NSS_CONSTANT(kWildcardPathStatisticsNamespace, DatabaseName::kLocal, "wildcardPathStatistics"_sd)
+
 // Namespace used by the test command to pin the oldest timestamp.
 NSS_CONSTANT(kDurableHistoryTestNamespace, DatabaseName::kMdbTesting, "pinned_timestamp"_sd)
 
@@ -45,8 +45,7 @@ const OperationContext::Decoration<BatchedWriteContext> BatchedWriteContext::get
 
 BatchedWriteContext::BatchedWriteContext() {}
 
-void BatchedWriteContext::addBatchedOperation(OperationContext* opCtx,
-                                              const BatchedOperation& operation) {
+void BatchedWriteContext::addBatchedOperation(OperationContext* opCtx, BatchedOperation operation) {
     invariant(_batchWrites);
 
     // Current support is only limited to insert update and delete operations, no change stream
@@ -59,7 +58,7 @@ void BatchedWriteContext::addBatchedOperation(OperationContext* opCtx,
     invariant(!opCtx->inMultiDocumentTransaction());
     invariant(shard_role_details::getLocker(opCtx)->inAWriteUnitOfWork());
 
-    invariantStatusOK(_batchedOperations.addOperation(operation));
+    invariantStatusOK(_batchedOperations.addOperation(std::move(operation)));
 }
 
 TransactionOperations* BatchedWriteContext::getBatchedOperations(OperationContext* opCtx) {
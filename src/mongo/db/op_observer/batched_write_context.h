@@ -73,7 +73,7 @@ public:
      * The stored operations must generate an applyOps entry that's within the max BSON size.
      * Anything larger will throw a TransactionTooLarge exception at commit.
      */
-    void addBatchedOperation(OperationContext* opCtx, const BatchedOperation& operation);
+    void addBatchedOperation(OperationContext* opCtx, BatchedOperation operation);
 
     /**
      * Returns a pointer to the stored operations for the current WUOW.
@@ -690,7 +690,7 @@ void OpObserverImpl::onInserts(OperationContext* opCtx,
                 operation.setRecordId(recordIds[i++]);
             }
             operation.setInitializedStatementIds(iter->stmtIds);
-            batchedWriteContext.addBatchedOperation(opCtx, operation);
+            batchedWriteContext.addBatchedOperation(opCtx, std::move(operation));
         }
     } else if (inMultiDocumentTransaction) {
         invariant(!defaultFromMigrate);
@@ -721,7 +721,7 @@ void OpObserverImpl::onInserts(OperationContext* opCtx,
 
             operation.setFromMigrateIfTrue(fromMigrate[std::distance(first, iter)]);
 
-            txnParticipant.addTransactionOperation(opCtx, operation);
+            txnParticipant.addTransactionOperation(opCtx, std::move(operation));
         }
     } else {
         // Ensure well-formed embedded ReplOperation for logging.
@@ -824,7 +824,7 @@ void OpObserverImpl::onUpdate(OperationContext* opCtx,
         if (!args.updateArgs->replicatedRecordId.isNull()) {
             operation.setRecordId(args.updateArgs->replicatedRecordId);
         }
-        batchedWriteContext.addBatchedOperation(opCtx, operation);
+        batchedWriteContext.addBatchedOperation(opCtx, std::move(operation));
     } else if (inMultiDocumentTransaction) {
         const bool inRetryableInternalTransaction =
             isInternalSessionForRetryableWrite(*opCtx->getLogicalSessionId());
@@ -892,7 +892,7 @@ void OpObserverImpl::onUpdate(OperationContext* opCtx,
         if (args.updateArgs->mustCheckExistenceForInsertOperations) {
             operation.setCheckExistenceForDiffInsert(true);
         }
-        txnParticipant.addTransactionOperation(opCtx, operation);
+        txnParticipant.addTransactionOperation(opCtx, std::move(operation));
     } else {
         MutableOplogEntry oplogEntry;
         oplogEntry.setDestinedRecipient(
@@ -984,7 +984,7 @@ void OpObserverImpl::onDelete(OperationContext* opCtx,
             operation.setRecordId(args.replicatedRecordId);
         }
 
-        batchedWriteContext.addBatchedOperation(opCtx, operation);
+        batchedWriteContext.addBatchedOperation(opCtx, std::move(operation));
     } else if (inMultiDocumentTransaction) {
         const bool inRetryableInternalTransaction =
             isInternalSessionForRetryableWrite(*opCtx->getLogicalSessionId());
@@ -1025,7 +1025,7 @@ void OpObserverImpl::onDelete(OperationContext* opCtx,
 
         operation.setDestinedRecipient(destinedRecipient);
         operation.setFromMigrateIfTrue(args.fromMigrate);
-        txnParticipant.addTransactionOperation(opCtx, operation);
+        txnParticipant.addTransactionOperation(opCtx, std::move(operation));
     } else {
         MutableOplogEntry oplogEntry;
 
@@ -408,6 +408,9 @@ void statsToBSON(const stage_builder::PlanStageToQsnMap& planStageQsnMap,
         bob->append("indexVersion", spec->indexVersion);
 
         if (verbosity >= ExplainOptions::Verbosity::kExecStats) {
+            bob->appendNumber("annuliExamined", static_cast<long long>(spec->intervalStats.size()));
+            bob->appendNumber("docsExamined", static_cast<long long>(spec->docsExamined));
+
             BSONArrayBuilder intervalsBob(bob->subarrayStart("searchIntervals"));
             for (std::vector<IntervalStats>::const_iterator it = spec->intervalStats.begin();
                  it != spec->intervalStats.end();
@@ -537,8 +540,16 @@ void statsToBSON(const stage_builder::PlanStageToQsnMap& planStageQsnMap,
     } else if (STAGE_TEXT_OR == stats.stageType) {
         TextOrStats* spec = static_cast<TextOrStats*>(stats.specific.get());
 
+        if (spec->topK) {
+            bob->appendNumber("topK", static_cast<long long>(spec->topK));
+        }
+
         if (verbosity >= ExplainOptions::Verbosity::kExecStats) {
             bob->appendNumber("docsExamined", static_cast<long long>(spec->fetches));
+            if (spec->topK) {
+                bob->appendNumber("candidatesScored",
+                                  static_cast<long long>(spec->candidatesScored));
+            }
         }
     } else if (STAGE_TIMESERIES_MODIFY == stats.stageType) {
         TimeseriesModifyStats* spec = static_cast<TimeseriesModifyStats*>(stats.specific.get());
@@ -264,6 +264,9 @@ void statsToBSON(const QuerySolutionNode* node,
                 bob->append("indexName", eln->idxEntry->identifier.catalogName);
                 bob->append("indexKeyPattern", eln->idxEntry->keyPattern);
             }
+            if (!eln->coveredForeignFields.empty()) {
+                bob->append("coveredForeignFields", eln->coveredForeignFields);
+            }
             bob->append("scanDirection", toString(eln->scanDirection));
             break;
         }
@@ -281,6 +284,9 @@ void statsToBSON(const QuerySolutionNode* node,
                 bob->append("indexName", eln->idxEntry->identifier.catalogName);
                 bob->append("indexKeyPattern", eln->idxEntry->keyPattern);
             }
+            if (!eln->coveredForeignFields.empty()) {
+                bob->append("coveredForeignFields", eln->coveredForeignFields);
+            }
             bob->append("scanDirection", toString(eln->scanDirection));
             break;
         }
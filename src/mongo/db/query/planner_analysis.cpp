@@ -52,8 +52,10 @@
 #include "mongo/db/index/expression_params.h"
 #include "mongo/db/index/multikey_paths.h"
 #include "mongo/db/index/s2_common.h"
+#include "mongo/db/field_ref.h"
 #include "mongo/db/index_names.h"
 #include "mongo/db/matcher/expression.h"
+#include "mongo/db/matcher/expression_algo.h"
 #include "mongo/db/matcher/expression_geo.h"
 #include "mongo/db/pipeline/dependencies.h"
 #include "mongo/db/pipeline/field_path.h"
@@ -77,6 +79,7 @@
 #include "mongo/platform/atomic_word.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/debug_util.h"
+#include "mongo/util/string_map.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kQuery
 
@@ -901,6 +904,66 @@ void QueryPlannerAnalysis::removeImpreciseInternalExprFilters(const QueryPlanner
     }
 }
 
+// static
+std::vector<std::string> QueryPlannerAnalysis::determineLookupCoveredFields(
+    const IndexEntry& index,
+    const std::string& foreignField,
+    const std::string& asField,
+    const OrderedPathSet& requiredFields) {
+    // Only a plain, non-multikey and non-collated index stores each field's value exactly as it
+    // appears in the document. A missing field is indexed as null; the stage builder falls back to
+    // fetching the foreign document whenever one of the covered values is null.
+    if (index.type != INDEX_BTREE || index.multikey || index.collator) {
+        return {};
+    }
+
+    StringSet coveredFields{foreignField};
+    for (const auto& path : requiredFields) {
+        if (!expression::isPathPrefixOf(asField, path)) {
+            if (path == asField || expression::isPathPrefixOf(path, asField)) {
+                // The whole foreign document is needed.
+                return {};
+            }
+            continue;
+        }
+
+        // Find the index field which stores the value of this path, or of one of its ancestors.
+        const auto foreignPath = StringData(path).substr(asField.size() + 1);
+        const auto coveringField = [&]() -> boost::optional<std::string> {
+            for (auto&& elt : index.keyPattern) {
+                const auto indexField = elt.fieldNameStringData();
+                if (indexField == foreignPath ||
+                    expression::isPathPrefixOf(indexField, foreignPath)) {
+                    return indexField.toString();
+                }
+            }
+            return boost::none;
+        }();
+        if (!coveringField || FieldRef(*coveringField).hasNumericPathComponents()) {
+            return {};
+        }
+        coveredFields.insert(*coveringField);
+    }
+
+    // Rebuilding a document from overlapping index fields such as "a" and "a.b" would produce
+    // conflicting paths.
+    for (const auto& field : coveredFields) {
+        for (const auto& other : coveredFields) {
+            if (expression::isPathPrefixOf(field, other)) {
+                return {};
+            }
+        }
+    }
+
+    std::vector<std::string> result;
+    for (auto&& elt : index.keyPattern) {
+        if (coveredFields.count(elt.fieldName())) {
+            result.emplace_back(elt.fieldName());
+        }
+    }
+    return result;
+}
+
 // static
 QueryPlannerAnalysis::Strategy QueryPlannerAnalysis::determineLookupStrategy(
     const NamespaceString& foreignCollName,
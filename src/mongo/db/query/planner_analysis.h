@@ -34,9 +34,11 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "mongo/bson/bsonobj.h"
 #include "mongo/db/namespace_string.h"
+#include "mongo/db/pipeline/dependencies.h"
 #include "mongo/db/query/canonical_query.h"
 #include "mongo/db/query/collation/collator_interface.h"
 #include "mongo/db/query/index_entry.h"
@@ -177,6 +179,19 @@ public:
         bool allowDiskUse,
         const CollatorInterface* collator);
 
+    /**
+     * Given the index chosen for an indexed loop join and 'requiredFields', the exhaustive set of
+     * fields that the stage consuming the $lookup output depends on, returns the fields of 'index'
+     * from which the matched foreign documents can be rebuilt without fetching them. Returns an
+     * empty vector if some required field under 'asField' is not available from the index, or if
+     * the index cannot reproduce the stored values exactly (it is multikey, hashed or collated).
+     */
+    static std::vector<std::string> determineLookupCoveredFields(
+        const IndexEntry& index,
+        const std::string& foreignField,
+        const std::string& asField,
+        const OrderedPathSet& requiredFields);
+
     /**
      * Checks if the foreign collection is eligible for the hash join algorithm. We conservatively
      * choose the hash join algorithm for cases when the hash table is unlikely to spill to disk.
@@ -42,6 +42,7 @@
 #include "mongo/db/index_names.h"
 #include "mongo/db/matcher/expression.h"
 #include "mongo/db/matcher/expression_geo.h"
+#include "mongo/db/query/collation/collator_interface_mock.h"
 #include "mongo/db/query/index_bounds.h"
 #include "mongo/db/query/index_entry.h"
 #include "mongo/db/query/interval.h"
@@ -296,6 +297,91 @@ TEST(QueryPlannerAnalysis, GeoSkipValidation) {
     ASSERT_EQ(expr->getCanSkipValidation(), true);
 }
 
+TEST(QueryPlannerAnalysis, LookupCoveredFields) {
+    auto index = buildSimpleIndexEntry(fromjson("{b: 1, c: 1, 'd.e': 1}"));
+    using Fields = std::vector<std::string>;
+
+    // Fields of the joined documents are rebuilt from the index, always including the join field.
+    ASSERT(QueryPlannerAnalysis::determineLookupCoveredFields(
+               index, "b", "as", OrderedPathSet{"_id", "as.c"}) == Fields({"b", "c"}));
+    ASSERT(QueryPlannerAnalysis::determineLookupCoveredFields(
+               index, "b", "as", OrderedPathSet{"as.d.e", "as.c.x"}) == Fields({"b", "c", "d.e"}));
+    ASSERT(QueryPlannerAnalysis::determineLookupCoveredFields(
+               index, "b", "x.as", OrderedPathSet{"x.as.c", "y"}) == Fields({"b", "c"}));
+
+    // The whole joined document, or a field which is not in the index, is needed.
+    ASSERT(QueryPlannerAnalysis::determineLookupCoveredFields(
+               index, "b", "as", OrderedPathSet{"as"})
+               .empty());
+    ASSERT(QueryPlannerAnalysis::determineLookupCoveredFields(
+               index, "b", "x.as", OrderedPathSet{"x"})
+               .empty());
+    ASSERT(QueryPlannerAnalysis::determineLookupCoveredFields(
+               index, "b", "as", OrderedPathSet{"as.c", "as._id"})
+               .empty());
+    ASSERT(QueryPlannerAnalysis::determineLookupCoveredFields(
+               index, "b", "as", OrderedPathSet{"as.d"})
+               .empty());
+
+    // A multikey index cannot rebuild the joined documents.
+    index.multikey = true;
+    ASSERT(QueryPlannerAnalysis::determineLookupCoveredFields(
+               index, "b", "as", OrderedPathSet{"as.c"})
+               .empty());
+}
+
+TEST(QueryPlannerAnalysis, LookupCoveredFieldsDottedPaths) {
+    using Fields = std::vector<std::string>;
+
+    // A dotted join field and dotted covered fields are rebuilt into nested documents.
+    auto index = buildSimpleIndexEntry(fromjson("{'f.k': 1, 'f.v': 1, g: 1}"));
+    ASSERT(QueryPlannerAnalysis::determineLookupCoveredFields(
+               index, "f.k", "as", OrderedPathSet{"as.f.v"}) == Fields({"f.k", "f.v"}));
+    ASSERT(QueryPlannerAnalysis::determineLookupCoveredFields(
+               index, "f.k", "as", OrderedPathSet{"as.f.k", "as.g"}) == Fields({"f.k", "g"}));
+
+    // The parent of indexed fields is not stored in the index as a whole.
+    ASSERT(QueryPlannerAnalysis::determineLookupCoveredFields(
+               index, "f.k", "as", OrderedPathSet{"as.f"})
+               .empty());
+
+    // Index fields with numeric components may refer to array elements.
+    index = buildSimpleIndexEntry(fromjson("{b: 1, 'c.0': 1}"));
+    ASSERT(QueryPlannerAnalysis::determineLookupCoveredFields(
+               index, "b", "as", OrderedPathSet{"as.c.0"})
+               .empty());
+
+    // Overlapping index fields would rebuild conflicting paths.
+    index = buildSimpleIndexEntry(fromjson("{b: 1, 'c.d': 1, c: 1}"));
+    ASSERT(QueryPlannerAnalysis::determineLookupCoveredFields(
+               index, "b", "as", OrderedPathSet{"as.c.d", "as.c"})
+               .empty());
+}
+
+TEST(QueryPlannerAnalysis, LookupCoveredFieldsRequireExactIndexValues) {
+    // A collated index stores collation keys rather than the original strings.
+    auto index = buildSimpleIndexEntry(fromjson("{b: 1, c: 1}"));
+    CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kReverseString);
+    index.collator = &collator;
+    ASSERT(QueryPlannerAnalysis::determineLookupCoveredFields(
+               index, "b", "as", OrderedPathSet{"as.c"})
+               .empty());
+
+    // A hashed index stores hashes of the values.
+    index = buildSimpleIndexEntry(fromjson("{b: 1, c: 'hashed'}"));
+    ASSERT(QueryPlannerAnalysis::determineLookupCoveredFields(
+               index, "b", "as", OrderedPathSet{"as.c"})
+               .empty());
+
+    // A multikey index stores array elements separately, whichever path is multikey.
+    index = buildSimpleIndexEntry(fromjson("{b: 1, c: 1}"));
+    index.multikey = true;
+    index.multikeyPaths = MultikeyPaths{{}, {0U}};
+    ASSERT(QueryPlannerAnalysis::determineLookupCoveredFields(
+               index, "b", "as", OrderedPathSet{"as.c"})
+               .empty());
+}
+
 TEST_F(QueryPlannerTest, ExprQueryHasImprecisePredicatesRemoved) {
     // Ensure that all of the $_internalExpr predicates which get added when optimizing are later
     // removed for an $expr on a collection scan.
@@ -1689,6 +1689,26 @@ std::unique_ptr<QuerySolution> QueryPlanner::extendWithAggPipeline(
                     query.getExpCtx()->allowDiskUse,
                     query.getCollator());
 
+            // If the next stage is an inclusion projection, the foreign fields it depends on are
+            // known exactly, and the matched foreign documents may be rebuilt from the index keys.
+            std::vector<std::string> coveredForeignFields;
+            if (strategy == EqLookupNode::LookupStrategy::kIndexedLoopJoin &&
+                internalQueryEnableCoveredIndexedLoopJoin.load() &&
+                i + 1 < innerPipelineStages.size()) {
+                auto nextProjection = dynamic_cast<DocumentSourceInternalProjection*>(
+                    innerPipelineStages[i + 1].get());
+                if (nextProjection &&
+                    nextProjection->projection().type() ==
+                        projection_ast::ProjectType::kInclusion &&
+                    !nextProjection->projection().requiresDocument()) {
+                    coveredForeignFields = QueryPlannerAnalysis::determineLookupCoveredFields(
+                        *idxEntry,
+                        lookupStage->getForeignField()->fullPath(),
+                        lookupStage->getAsField().fullPath(),
+                        nextProjection->projection().getRequiredFields());
+                }
+            }
+
             if (!lookupStage->hasUnwindSrc()) {
                 solnForAgg =
                     std::make_unique<EqLookupNode>(std::move(solnForAgg),
@@ -1700,6 +1720,8 @@ std::unique_ptr<QuerySolution> QueryPlanner::extendWithAggPipeline(
                                                    std::move(idxEntry),
                                                    isLastSource /* shouldProduceBson */,
                                                    scanDirection);
+                static_cast<EqLookupNode*>(solnForAgg.get())->coveredForeignFields =
+                    std::move(coveredForeignFields);
             } else {
                 const boost::intrusive_ptr<DocumentSourceUnwind>& unwindSrc =
                     lookupStage->getUnwindSource();
@@ -1718,6 +1740,8 @@ std::unique_ptr<QuerySolution> QueryPlanner::extendWithAggPipeline(
                                                          unwindSrc->preserveNullAndEmptyArrays(),
                                                          unwindSrc->indexPath(),
                                                          scanDirection);
+                static_cast<EqLookupUnwindNode*>(solnForAgg.get())->coveredForeignFields =
+                    std::move(coveredForeignFields);
             }
             continue;
         }
@@ -124,6 +124,16 @@ bool rangeCanContainString(const BSONElement& startKey,
     return !stringBoundsOil.intervals.empty();
 }
 
+// Appends the line describing the fields from which an indexed loop join rebuilds the foreign
+// documents.
+void appendCoveredForeignFields(str::stream* ss, const std::vector<std::string>& fields) {
+    *ss << "coveredForeignFields = [";
+    for (size_t i = 0; i < fields.size(); ++i) {
+        *ss << (i > 0 ? ", " : "") << fields[i];
+    }
+    *ss << "]\n";
+}
+
 // Helper for 'getAllSecondaryNamespaces' that deduplicates namespaces.
 void getAllSecondaryNamespacesHelper(const QuerySolutionNode* qsn,
                                      const NamespaceString& mainNss,
@@ -1831,6 +1841,10 @@ void EqLookupNode::appendToString(str::stream* ss, int indent) const {
         addIndent(ss, indent + 1);
         *ss << "indexKeyPattern = " << idxEntry->keyPattern << "\n";
     }
+    if (!coveredForeignFields.empty()) {
+        addIndent(ss, indent + 1);
+        appendCoveredForeignFields(ss, coveredForeignFields);
+    }
     addIndent(ss, indent + 1);
     *ss << "shouldProduceBson = " << shouldProduceBson << "\n";
 
@@ -1844,15 +1858,17 @@ void EqLookupNode::appendToString(str::stream* ss, int indent) const {
 }
 
 std::unique_ptr<QuerySolutionNode> EqLookupNode::clone() const {
-    return std::make_unique<EqLookupNode>(children[0]->clone(),
-                                          foreignCollection,
-                                          joinFieldLocal,
-                                          joinFieldForeign,
-                                          joinField,
-                                          lookupStrategy,
-                                          idxEntry,
-                                          shouldProduceBson,
-                                          scanDirection);
+    auto copy = std::make_unique<EqLookupNode>(children[0]->clone(),
+                                               foreignCollection,
+                                               joinFieldLocal,
+                                               joinFieldForeign,
+                                               joinField,
+                                               lookupStrategy,
+                                               idxEntry,
+                                               shouldProduceBson,
+                                               scanDirection);
+    copy->coveredForeignFields = coveredForeignFields;
+    return copy;
 }
 
 /**
@@ -1878,6 +1894,10 @@ void EqLookupUnwindNode::appendToString(str::stream* ss, int indent) const {
         addIndent(ss, indent + 1);
         *ss << "indexKeyPattern = " << idxEntry->keyPattern << "\n";
     }
+    if (!coveredForeignFields.empty()) {
+        addIndent(ss, indent + 1);
+        appendCoveredForeignFields(ss, coveredForeignFields);
+    }
     addIndent(ss, indent + 1);
     *ss << "shouldProduceBson = " << shouldProduceBson << "\n";
 
@@ -1898,20 +1918,22 @@ void EqLookupUnwindNode::appendToString(str::stream* ss, int indent) const {
 }
 
 std::unique_ptr<QuerySolutionNode> EqLookupUnwindNode::clone() const {
-    return std::make_unique<EqLookupUnwindNode>(children[0]->clone(),
-                                                // Shared data members.
-                                                joinField,
-                                                // $lookup-specific data members.
-                                                foreignCollection,
-                                                joinFieldLocal,
-                                                joinFieldForeign,
-                                                lookupStrategy,
-                                                idxEntry,
-                                                shouldProduceBson,
-                                                // $unwind-specific data members.
-                                                unwindNode.preserveNullAndEmptyArrays,
-                                                unwindNode.indexPath,
-                                                scanDirection);
+    auto copy = std::make_unique<EqLookupUnwindNode>(children[0]->clone(),
+                                                     // Shared data members.
+                                                     joinField,
+                                                     // $lookup-specific data members.
+                                                     foreignCollection,
+                                                     joinFieldLocal,
+                                                     joinFieldForeign,
+                                                     lookupStrategy,
+                                                     idxEntry,
+                                                     shouldProduceBson,
+                                                     // $unwind-specific data members.
+                                                     unwindNode.preserveNullAndEmptyArrays,
+                                                     unwindNode.indexPath,
+                                                     scanDirection);
+    copy->coveredForeignFields = coveredForeignFields;
+    return copy;
 }
 
 /**
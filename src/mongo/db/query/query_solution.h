@@ -1828,6 +1828,13 @@ struct EqLookupNode : public QuerySolutionNode {
      */
     boost::optional<IndexEntry> idxEntry = boost::none;
 
+    /**
+     * The fields of 'idxEntry' from which the matched foreign documents are rebuilt when the rest
+     * of the pipeline depends only on foreign fields stored in the index. Empty if the matched
+     * foreign documents have to be fetched.
+     */
+    std::vector<std::string> coveredForeignFields;
+
     /**
      * If set to true, generated SBE plan will produce result as BSON object. If false,
      * 'sbe::Object' is produced instead.
@@ -1942,6 +1949,11 @@ struct EqLookupUnwindNode : public QuerySolutionNode {
     // collection. Set to 'boost::none' by default and if a non-indexed strategy is chosen.
     boost::optional<IndexEntry> idxEntry = boost::none;
 
+    // The fields of 'idxEntry' from which the matched foreign documents are rebuilt when the rest
+    // of the pipeline depends only on foreign fields stored in the index. Empty if the matched
+    // foreign documents have to be fetched.
+    std::vector<std::string> coveredForeignFields;
+
     // If set to true, generated SBE plan will produce result as BSON object. If false,
     // 'sbe::Object' is produced instead.
     bool shouldProduceBson;
@@ -76,6 +76,7 @@
 #include "mongo/db/query/find_command.h"
 #include "mongo/db/query/index_bounds.h"
 #include "mongo/db/query/index_entry.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/query/record_id_bound.h"
 #include "mongo/db/query/sort_pattern.h"
 #include "mongo/db/query/stage_builder/classic_stage_builder.h"
@@ -94,6 +95,42 @@
 
 
 namespace mongo::stage_builder {
+namespace {
+/**
+ * Returns the number of results 'sortNode' keeps if it is a limited sort on the text score directly
+ * over a TEXT_MATCH stage, or boost::none otherwise.
+ */
+boost::optional<size_t> getTextScoreSortLimit(const SortNode* sortNode) {
+    if (!sortNode->limit || sortNode->children[0]->getType() != STAGE_TEXT_MATCH ||
+        sortNode->pattern.nFields() != 1) {
+        return boost::none;
+    }
+
+    const BSONElement sortElem = sortNode->pattern.firstElement();
+    if (sortElem.type() != BSONType::Object) {
+        return boost::none;
+    }
+
+    const BSONObj metaObj = sortElem.embeddedObject();
+    if (metaObj.nFields() != 1 || metaObj.firstElementFieldNameStringData() != "$meta"_sd ||
+        metaObj.firstElement().valueStringDataSafe() != "textScore"_sd) {
+        return boost::none;
+    }
+
+    return sortNode->limit;
+}
+
+/**
+ * Returns true if the TEXT_MATCH stage for 'ftsQuery' passes every document the TEXT_OR stage
+ * below it produces, so that the TEXT_OR stage may drop documents outside of the top K.
+ */
+bool textMatchRejectsNothing(const FTSQueryImpl& ftsQuery) {
+    return !ftsQuery.getCaseSensitive() && !ftsQuery.getDiacriticSensitive() &&
+        ftsQuery.getNegatedTerms().empty() && ftsQuery.getPositivePhr().empty() &&
+        ftsQuery.getNegatedPhr().empty();
+}
+}  // namespace
+
 // Returns a non-null pointer to the root of a plan tree, or a non-OK status if the PlanStage tree
 // could not be constructed.
 std::unique_ptr<PlanStage> ClassicStageBuilder::build(const QuerySolutionNode* root) {
@@ -159,6 +196,10 @@ std::unique_ptr<PlanStage> ClassicStageBuilder::build(const QuerySolutionNode* r
             }
             case STAGE_SORT_DEFAULT: {
                 auto snDefault = static_cast<const SortNodeDefault*>(root);
+                if (internalQueryTextOrTopKEnabled.load()) {
+                    _textTopK = getTextScoreSortLimit(snDefault);
+                }
+                ON_BLOCK_EXIT([&] { _textTopK = {}; });
                 auto childStage = build(snDefault->children[0].get());
                 return std::make_unique<SortStageDefault>(
                     _cq.getExpCtx(),
@@ -314,6 +355,14 @@ std::unique_ptr<PlanStage> ClassicStageBuilder::build(const QuerySolutionNode* r
                 params.addPointMeta = node->addPointMeta;
                 params.addDistMeta = node->addDistMeta;
 
+                // Without a blocking sort, the results of the near stage are consumed in order, so
+                // the query never needs more than skip + limit of them.
+                const auto& findCommand = _cq.getFindCommandRequest();
+                if (findCommand.getLimit() && !_cq.getSortPattern()) {
+                    params.limit = static_cast<long long>(*findCommand.getLimit() +
+                                                          findCommand.getSkip().value_or(0));
+                }
+
                 invariant(collectionPtr);
                 const IndexDescriptor* s2Index = collectionPtr->getIndexCatalog()->findIndexByName(
                     _opCtx, node->index.identifier.catalogName);
@@ -329,7 +378,7 @@ std::unique_ptr<PlanStage> ClassicStageBuilder::build(const QuerySolutionNode* r
 
                 auto node = static_cast<const TextOrNode*>(root);
                 auto ret = std::make_unique<TextOrStage>(
-                    expCtx, *_ftsKeyPrefixSize, _ws, node->filter.get(), _collection);
+                    expCtx, *_ftsKeyPrefixSize, _ws, node->filter.get(), _collection, _textTopK);
                 for (auto&& childNode : root->children) {
                     ret->addChild(build(childNode.get()));
                 }
@@ -363,6 +412,10 @@ std::unique_ptr<PlanStage> ClassicStageBuilder::build(const QuerySolutionNode* r
                 _ftsKeyPrefixSize.emplace(params.spec.numExtraBefore());
                 ON_BLOCK_EXIT([&] { _ftsKeyPrefixSize = {}; });
 
+                if (!textMatchRejectsNothing(params.query)) {
+                    _textTopK = {};
+                }
+
                 return std::make_unique<TextMatchStage>(
                     expCtx, build(root->children[0].get()), params, _ws);
             }
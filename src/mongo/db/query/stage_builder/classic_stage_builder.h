@@ -75,6 +75,10 @@ private:
 
     boost::optional<size_t> _ftsKeyPrefixSize;
 
+    // Set while building the text sub-tree below a limited sort on the text score, if the TEXT_OR
+    // stage may only produce the documents which can make it into that sort's output.
+    boost::optional<size_t> _textTopK;
+
     // We don't own this, we populate it during the build phase.
     PlanStageToQsnMap* _planStageQsnMap;
 };
@@ -31,6 +31,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <set>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -44,6 +45,7 @@
 
 #include "mongo/base/string_data.h"
 #include "mongo/bson/bsonobj.h"
+#include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/bson/bsontypes.h"
 #include "mongo/bson/ordering.h"
 #include "mongo/db/catalog/collection.h"
@@ -771,6 +773,10 @@ std::pair<SbSlot /* matched docs */, SbStage> buildNljLookupStage(
  *   filter {isMember (foreignValue, localValueSet)}
  *   // Below is the tree performing path traversal on the 'foreignDocument' and producing value
  *   // into 'foreignValue'.
+ *
+ * When 'coveredForeignFields' is not empty, the index scan also outputs those key components and
+ * 'foreignDocument' is rebuilt from them instead of being fetched. Since a missing field is indexed
+ * as null, the seek is still performed for any key in which one of the covered values is null.
  */
 std::pair<SbSlot, SbStage> buildIndexJoinLookupStage(
     StageBuilderState& state,
@@ -780,6 +786,7 @@ std::pair<SbSlot, SbStage> buildIndexJoinLookupStage(
     const FieldPath& foreignFieldName,
     const CollectionPtr& foreignColl,
     const IndexEntry& index,
+    const std::vector<std::string>& coveredForeignFields,
     boost::optional<sbe::value::SlotId> collatorSlot,
     const PlanNodeId nodeId,
     bool hasUnwindSrc) {
@@ -937,7 +944,10 @@ std::pair<SbSlot, SbStage> buildIndexJoinLookupStage(
     // The foreign record id of the seek is stored in 'foreignRecordIdSlot'. We also keep
     // 'indexKeySlot' and 'snapshotIdSlot' for the seek stage later to perform consistency
     // check.
-    auto [ixScanStage, foreignRecordIdSlot, __, indexInfoSlots] =
+    auto [indexKeysToInclude, coveredKeyFieldNames] = makeIndexKeyInclusionSet(
+        index.keyPattern,
+        std::set<std::string>(coveredForeignFields.begin(), coveredForeignFields.end()));
+    auto [ixScanStage, foreignRecordIdSlot, coveredKeySlots, indexInfoSlots] =
         b.makeSimpleIndexScan(foreignCollUUID,
                               foreignCollDbName,
                               indexName,
@@ -945,7 +955,7 @@ std::pair<SbSlot, SbStage> buildIndexJoinLookupStage(
                               true /* forward */,
                               lowKeySlot,
                               highKeySlot,
-                              sbe::IndexKeysInclusionSet{} /* indexKeysToInclude */,
+                              indexKeysToInclude,
                               indexInfoTypeMask);
 
     SbSlot indexIdentSlot = *indexInfoSlots.indexIdentSlot;
@@ -972,6 +982,35 @@ std::pair<SbSlot, SbStage> buildIndexJoinLookupStage(
         ixScanNljStage = b.makeUnique(std::move(ixScanNljStage), foreignRecordIdSlot);
     }
 
+    // Rebuild the foreign document from the covered key components, unless one of them is null and
+    // so may stand for a missing field. In that case 'coveredDocSlot' is Nothing and the foreign
+    // document is fetched below.
+    boost::optional<SbSlot> coveredDocSlot;
+    if (!coveredKeySlots.empty()) {
+        BSONObjBuilder coveredKeyPattern;
+        for (const auto& fieldName : coveredKeyFieldNames) {
+            coveredKeyPattern.append(fieldName, 1);
+        }
+
+        SbExpr anyCoveredValueIsNull;
+        for (auto slot : coveredKeySlots) {
+            auto isNull = b.makeFunction("isNull", slot);
+            anyCoveredValueIsNull = anyCoveredValueIsNull
+                ? b.makeBinaryOp(sbe::EPrimBinary::logicOr,
+                                 std::move(anyCoveredValueIsNull),
+                                 std::move(isNull))
+                : std::move(isNull);
+        }
+
+        auto [outStage, outSlots] = b.makeProject(
+            std::move(ixScanNljStage),
+            b.makeIf(std::move(anyCoveredValueIsNull),
+                     b.makeNothingConstant(),
+                     rehydrateIndexKey(state, coveredKeyPattern.obj(), coveredKeySlots)));
+        ixScanNljStage = std::move(outStage);
+        coveredDocSlot = outSlots[0];
+    }
+
     // Loop join the foreign record id produced by the index seek on the outer side with seek
     // stage on the inner side to get matched foreign documents. The foreign documents are
     // stored in 'foreignRecordSlot'. We also pass in 'snapshotIdSlot', 'indexIdentSlot',
@@ -984,7 +1023,7 @@ std::pair<SbSlot, SbStage> buildIndexJoinLookupStage(
                              indexIdentSlot,
                              indexKeySlot,
                              indexKeyPatternSlot,
-                             boost::none /* prefetchedResultSlot */,
+                             coveredDocSlot /* prefetchedResultSlot */,
                              foreignColl,
                              state,
                              nodeId,
@@ -1239,6 +1278,7 @@ std::pair<SbStage, PlanStageSlots> SlotBasedStageBuilder::buildEqLookup(
                                                  eqLookupNode->joinFieldForeign,
                                                  foreignColl,
                                                  *eqLookupNode->idxEntry,
+                                                 eqLookupNode->coveredForeignFields,
                                                  collatorSlot,
                                                  eqLookupNode->nodeId(),
                                                  false /* hasUnwindSrc */);
@@ -1339,6 +1379,7 @@ std::pair<SbStage, PlanStageSlots> SlotBasedStageBuilder::buildEqLookupUnwind(
                                                  eqLookupUnwindNode->joinFieldForeign,
                                                  foreignColl,
                                                  *eqLookupUnwindNode->idxEntry,
+                                                 eqLookupUnwindNode->coveredForeignFields,
                                                  collatorSlot,
                                                  eqLookupUnwindNode->nodeId(),
                                                  true /* hasUnwindSrc */);
@@ -34,6 +34,7 @@
 #include <cstddef>
 #include <iostream>
 #include <memory>
+#include <set>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -56,8 +57,13 @@
 #include "mongo/db/exec/sbe/util/debug_print.h"
 #include "mongo/db/exec/sbe/values/slot.h"
 #include "mongo/db/exec/sbe/values/value.h"
+#include "mongo/db/field_ref.h"
+#include "mongo/db/index/index_descriptor.h"
+#include "mongo/db/index/multikey_paths.h"
+#include "mongo/db/index_names.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/query/collation/collator_interface.h"
+#include "mongo/db/query/index_entry.h"
 #include "mongo/db/query/multiple_collection_accessor.h"
 #include "mongo/db/query/query_solution.h"
 #include "mongo/db/query/shard_filterer_factory_interface.h"
@@ -133,6 +139,13 @@ public:
         auto localScanNode = std::make_unique<CollectionScanNode>();
         localScanNode->nss = _nss;
 
+        // The indexed loop join uses the index created by createForeignIndex().
+        boost::optional<IndexEntry> idxEntry;
+        if (strategy == EqLookupNode::LookupStrategy::kIndexedLoopJoin) {
+            ASSERT(_foreignIndex);
+            idxEntry = _foreignIndex;
+        }
+
         // Construct logical query solution.
         auto lookupNode = std::make_unique<EqLookupNode>(std::move(localScanNode),
                                                          _foreignNss,
@@ -140,8 +153,9 @@ public:
                                                          foreignKey,
                                                          asKey,
                                                          strategy,
-                                                         boost::none /* idxEntry */,
+                                                         std::move(idxEntry),
                                                          true /* shouldProduceBson */);
+        lookupNode->coveredForeignFields = _coveredForeignFields;
         auto solution = makeQuerySolution(std::move(lookupNode));
 
         // Convert logical solution into the physical SBE plan.
@@ -278,10 +292,42 @@ public:
         }
     }
 
+    /**
+     * Creates an index with 'keyPattern' on the foreign collection, which must be empty, to be used
+     * by the indexed loop join strategy. If 'coveredForeignFields' is not empty, the indexed loop
+     * join rebuilds the matched foreign documents from those fields of the index.
+     */
+    void createForeignIndex(const BSONObj& keyPattern,
+                            std::vector<std::string> coveredForeignFields = {}) {
+        const std::string indexName = "foreign_index";
+        ASSERT_OK(storageInterface()->createIndexesOnEmptyCollection(
+            operationContext(),
+            _foreignNss,
+            {BSON("v" << 2 << "key" << keyPattern << "name" << indexName)}));
+
+        _foreignIndex.emplace(keyPattern,
+                              IndexNames::nameToType(IndexNames::findPluginName(keyPattern)),
+                              IndexDescriptor::kLatestIndexVersion,
+                              false /* multikey */,
+                              MultikeyPaths{},
+                              std::set<FieldRef>{},
+                              false /* sparse */,
+                              false /* unique */,
+                              IndexEntry::Identifier{indexName},
+                              nullptr /* filterExpr */,
+                              BSONObj() /* infoObj */,
+                              nullptr /* collator */,
+                              nullptr /* wildcardProjection */);
+        _coveredForeignFields = std::move(coveredForeignFields);
+    }
+
 protected:
     std::vector<EqLookupNode::LookupStrategy> strategies = {
         EqLookupNode::LookupStrategy::kNestedLoopJoin, EqLookupNode::LookupStrategy::kHashJoin};
 
+    boost::optional<IndexEntry> _foreignIndex;
+    std::vector<std::string> _coveredForeignFields;
+
 private:
     const NamespaceString _foreignNss =
         NamespaceString::createNamespaceString_forTest("testdb.sbe_stage_builder_foreign");
@@ -804,5 +850,79 @@ TEST_F(LookupStageBuilderTest, ThreeComponentAsPathDoesNotPerformArrayTraversal)
         "_id", "_id", "one.two.three", {fromjson("{_id: 0, one: {two: {three: [{_id: 0}]}}}")});
 }
 
+TEST_F(LookupStageBuilderTest, IndexedLoopJoin_Basic) {
+    createForeignIndex(fromjson("{fkey: 1}"));
+
+    const std::vector<BSONObj> ldocs = {
+        fromjson("{_id: 0, lkey: 1}"),
+        fromjson("{_id: 1, lkey: 2}"),
+        fromjson("{_id: 2, lkey: 3}"),
+    };
+    const std::vector<BSONObj> fdocs = {
+        fromjson("{_id: 0, fkey: 1, c: 'x'}"),
+        fromjson("{_id: 1, fkey: 2, c: 'y'}"),
+        fromjson("{_id: 2, fkey: 1, c: 'z'}"),
+    };
+    const std::vector<std::pair<BSONObj, std::vector<BSONObj>>> expected = {
+        {ldocs[0], {fdocs[0], fdocs[2]}},
+        {ldocs[1], {fdocs[1]}},
+        {ldocs[2], {}},
+    };
+
+    insertDocuments(ldocs, fdocs);
+    assertMatchedDocuments(
+        EqLookupNode::LookupStrategy::kIndexedLoopJoin, "lkey", "fkey", expected);
+}
+
+TEST_F(LookupStageBuilderTest, IndexedLoopJoin_CoveredRebuildsForeignDocumentsFromIndexKeys) {
+    createForeignIndex(fromjson("{fkey: 1, 'd.e': 1, c: 1}"), {"fkey", "d.e"});
+
+    const std::vector<BSONObj> ldocs = {
+        fromjson("{_id: 0, lkey: 1}"),
+        fromjson("{_id: 1, lkey: 2}"),
+        fromjson("{_id: 2, lkey: 3}"),
+    };
+    const std::vector<BSONObj> fdocs = {
+        fromjson("{_id: 0, fkey: 1, d: {e: 10, f: 1}, c: 'x'}"),
+        fromjson("{_id: 1, fkey: 1, d: {e: 5}, c: 'y'}"),
+        fromjson("{_id: 2, fkey: 2, c: 'z'}"),
+        fromjson("{_id: 3, fkey: 2, d: {e: 7}}"),
+    };
+
+    // Matches are produced in index order. Only the covered fields are rebuilt, except for the
+    // document missing 'd.e': its null key could also stand for an explicit null, so that document
+    // is fetched.
+    const std::vector<std::pair<BSONObj, std::vector<BSONObj>>> expected = {
+        {ldocs[0], {fromjson("{fkey: 1, d: {e: 5}}"), fromjson("{fkey: 1, d: {e: 10}}")}},
+        {ldocs[1], {fdocs[2], fromjson("{fkey: 2, d: {e: 7}}")}},
+        {ldocs[2], {}},
+    };
+
+    insertDocuments(ldocs, fdocs);
+    assertMatchedDocuments(
+        EqLookupNode::LookupStrategy::kIndexedLoopJoin, "lkey", "fkey", expected);
+}
+
+TEST_F(LookupStageBuilderTest, IndexedLoopJoin_CoveredDottedForeignField) {
+    createForeignIndex(fromjson("{'f.k': 1, 'f.v': 1}"), {"f.k", "f.v"});
+
+    const std::vector<BSONObj> ldocs = {
+        fromjson("{_id: 0, lkey: 'a'}"),
+        fromjson("{_id: 1, lkey: 'b'}"),
+    };
+    const std::vector<BSONObj> fdocs = {
+        fromjson("{_id: 0, f: {k: 'a', v: 2, w: 0}}"),
+        fromjson("{_id: 1, f: {k: 'b', v: 'two'}, g: 1}"),
+        fromjson("{_id: 2, f: {k: 'a', v: 1}}"),
+    };
+    const std::vector<std::pair<BSONObj, std::vector<BSONObj>>> expected = {
+        {ldocs[0], {fromjson("{f: {k: 'a', v: 1}}"), fromjson("{f: {k: 'a', v: 2}}")}},
+        {ldocs[1], {fromjson("{f: {k: 'b', v: 'two'}}")}},
+    };
+
+    insertDocuments(ldocs, fdocs);
+    assertMatchedDocuments(EqLookupNode::LookupStrategy::kIndexedLoopJoin, "lkey", "f.k", expected);
+}
+
 }  // namespace
 }  // namespace mongo::sbe
@@ -0,0 +1,175 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+#include "mongo/db/catalog/catalog_test_fixture.h"
+#include "mongo/db/query/query_knobs_gen.h"
+#include "mongo/db/read_write_concern_defaults_cache_lookup_mock.h"
+#include "mongo/db/repl/storage_interface.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/shard_role.h"
+#include "mongo/platform/random.h"
+#include "mongo/transport/service_entry_point.h"
+#include "mongo/util/assert_util.h"
+
+namespace mongo {
+namespace {
+const NamespaceString kNss = NamespaceString::createNamespaceString_forTest("testDb", "testColl");
+
+// A small vocabulary so that every word is common. "common" appears in every document, which is
+// the worst case for a text search that has to score every posting.
+const std::vector<std::string> kWords = {
+    "alpha", "bravo", "charlie", "delta", "echo", "foxtrot", "golf", "hotel", "india", "juliet"};
+
+/**
+ * Measures $text searches sorted by text score with a small limit, with and without the TEXT_OR
+ * top-K mode. The first argument is the number of documents, the second the approximate size of
+ * the padding in each document, and the third whether the top-K mode is enabled.
+ */
+class TextSearchBenchmark : public benchmark::Fixture {
+public:
+    void SetUp(benchmark::State& state) override {
+        _fixture.emplace(CatalogScopedGlobalServiceContextForTest::Options{});
+
+        ReadWriteConcernDefaults::create(getGlobalServiceContext(),
+                                         _lookupMock.getFetchDefaultsFn());
+        _lookupMock.setLookupCallReturnValue({});
+
+        populateCollection(state.range(0), state.range(1));
+        internalQueryTextOrTopKEnabled.store(state.range(2));
+    }
+
+    void TearDown(benchmark::State& state) override {
+        internalQueryTextOrTopKEnabled.store(true);
+        _fixture.reset();
+    }
+
+    void runBenchmark(StringData search, benchmark::State& state) {
+        BSONObj command = BSON("find" << kNss.coll() << "$db" << kNss.db_forTest() << "filter"
+                                      << BSON("$text" << BSON("$search" << search)) << "projection"
+                                      << BSON("score" << BSON("$meta"
+                                                              << "textScore"))
+                                      << "sort"
+                                      << BSON("score" << BSON("$meta"
+                                                              << "textScore"))
+                                      << "limit" << 20);
+        OpMsgRequest request;
+        request.body = command;
+        auto msg = request.serialize();
+
+        ThreadClient threadClient{getGlobalServiceContext()->getService()};
+        for (auto _ : state) {
+            auto opCtx = cc().makeOperationContext();
+            auto statusWithResponse = cc().getService()
+                                          ->getServiceEntryPoint()
+                                          ->handleRequest(opCtx.get(), msg)
+                                          .getNoThrow();
+            iassert(statusWithResponse);
+            benchmark::DoNotOptimize(statusWithResponse.getValue().response);
+        }
+    }
+
+private:
+    BSONObj generateDocument(size_t approximateSize) {
+        std::string text = "common";
+        for (int i = 0; i < 8; ++i) {
+            text += " " + kWords[_random.nextInt32(static_cast<int32_t>(kWords.size()))];
+        }
+        return BSONObjBuilder{}
+            .append("_id", OID::gen())
+            .append("text", text)
+            .append("padding", std::string(approximateSize, 'x'))
+            .obj();
+    }
+
+    void createTextIndex(OperationContext* opCtx) {
+        auto acquisition = acquireCollection(
+            opCtx,
+            CollectionAcquisitionRequest::fromOpCtx(opCtx, kNss, AcquisitionPrerequisites::kWrite),
+            MODE_X);
+        CollectionWriter coll(opCtx, &acquisition);
+
+        WriteUnitOfWork wunit(opCtx);
+        uassertStatusOK(coll.getWritableCollection(opCtx)
+                            ->getIndexCatalog()
+                            ->createIndexOnEmptyCollection(
+                                opCtx,
+                                coll.getWritableCollection(opCtx),
+                                BSON("v" << IndexDescriptor::kLatestIndexVersion << "key"
+                                         << BSON("text"
+                                                 << "text")
+                                         << "name"
+                                         << "text_text"))
+                            .getStatus());
+        wunit.commit();
+    }
+
+    void populateCollection(size_t size, size_t approximateSize) {
+        std::vector<InsertStatement> inserts;
+        for (size_t i = 0; i < size; ++i) {
+            inserts.emplace_back(generateDocument(approximateSize));
+        }
+
+        ThreadClient threadClient{getGlobalServiceContext()->getService()};
+        auto opCtx = cc().makeOperationContext();
+        auto storage = repl::StorageInterface::get(opCtx.get());
+
+        uassertStatusOK(storage->createCollection(opCtx.get(), kNss, CollectionOptions{}));
+        createTextIndex(opCtx.get());
+        uassertStatusOK(storage->insertDocuments(opCtx.get(), kNss, inserts));
+    }
+
+    static constexpr int32_t kSeed = 1;
+    PseudoRandom _random{kSeed};
+
+    boost::optional<CatalogScopedGlobalServiceContextForTest> _fixture;
+    ReadWriteConcernDefaultsLookupMock _lookupMock;
+};
+
+BENCHMARK_DEFINE_F(TextSearchBenchmark, CommonTerm)(benchmark::State& state) {
+    runBenchmark("common", state);
+}
+
+BENCHMARK_DEFINE_F(TextSearchBenchmark, MultipleTerms)(benchmark::State& state) {
+    runBenchmark("alpha bravo charlie", state);
+}
+
+static void configureBenchmarks(benchmark::internal::Benchmark* bm) {
+    bm->ArgNames({"docs", "docSize", "topK"})
+        ->ArgsProduct({{1000, 10000}, {1024, 8192}, {false, true}})
+        ->Unit(benchmark::kMillisecond);
+}
+
+BENCHMARK_REGISTER_F(TextSearchBenchmark, CommonTerm)->Apply(configureBenchmarks);
+BENCHMARK_REGISTER_F(TextSearchBenchmark, MultipleTerms)->Apply(configureBenchmarks);
+}  // namespace
+}  // namespace mongo
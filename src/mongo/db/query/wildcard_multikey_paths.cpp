@@ -57,6 +57,7 @@
 #include "mongo/db/query/index_bounds.h"
 #include "mongo/db/query/index_bounds_builder.h"
 #include "mongo/db/query/interval.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/query/wildcard_multikey_paths.h"
 #include "mongo/db/record_id.h"
 #include "mongo/db/record_id_helpers.h"
@@ -350,12 +351,78 @@ static IndexBounds buildMetadataKeysIndexBounds(const BSONObj& keyPattern,
     return indexBounds;
 }
 
+/**
+ * Resolves the multikey paths relevant to 'fieldSet' from the in-memory summary kept by the
+ * wildcard access method, matching the same paths that the bounds built by
+ * getMultikeyPathIndexIntervalsForField() would retrieve from the index. Returns boost::none if the
+ * summary has not been seeded yet.
+ */
+static boost::optional<std::set<FieldRef>> getWildcardMultikeyPathSetFromSummary(
+    const WildcardAccessMethod* wam, const stdx::unordered_set<std::string>& fieldSet) {
+    std::set<FieldRef> multikeyPaths{};
+    const bool seeded = wam->visitMultikeyPathSummary([&](const std::set<std::string>& summary) {
+        if (summary.empty()) {
+            return;
+        }
+
+        for (const auto& fieldName : fieldSet) {
+            const FieldRef field(fieldName);
+            size_t pointPrefixParts = field.numParts();
+            const auto numericPathComponents = field.getNumericPathComponents(1);
+            if (!numericPathComponents.empty()) {
+                pointPrefixParts = *numericPathComponents.begin();
+            }
+
+            for (size_t i = 1; i <= pointPrefixParts; ++i) {
+                auto prefix = field.dottedSubstring(0, i);
+                if (summary.count(prefix.toString())) {
+                    multikeyPaths.emplace(prefix);
+                }
+            }
+
+            // As with the index bounds, a numeric path component means that every multikey path
+            // under the non-numeric prefix is relevant.
+            if (!numericPathComponents.empty()) {
+                const auto rangeStart = field.dottedSubstring(0, pointPrefixParts).toString() + ".";
+                for (auto it = summary.lower_bound(rangeStart);
+                     it != summary.end() && StringData(*it).starts_with(rangeStart);
+                     ++it) {
+                    multikeyPaths.emplace(*it);
+                }
+            }
+        }
+    });
+
+    if (!seeded) {
+        return boost::none;
+    }
+    return multikeyPaths;
+}
+
 std::set<FieldRef> getWildcardMultikeyPathSet(OperationContext* opCtx,
                                               const IndexCatalogEntry* entry,
                                               const stdx::unordered_set<std::string>& fieldSet,
                                               MultikeyMetadataAccessStats* stats) {
     tassert(7354610, "stats must be non-null", stats);
 
+    if (internalQueryWildcardMultikeyPathCacheEnabled.load()) {
+        const WildcardAccessMethod* wam =
+            static_cast<const WildcardAccessMethod*>(entry->accessMethod());
+        auto fromSummary = getWildcardMultikeyPathSetFromSummary(wam, fieldSet);
+        if (!fromSummary) {
+            // Seed the summary with one full scan of the metadata keys. Paths written concurrently
+            // with the scan are already in the summary, since they were recorded when their keys
+            // were generated.
+            wam->seedMultikeyPathSummary(getWildcardMultikeyPathSet(opCtx, entry, stats));
+            fromSummary = getWildcardMultikeyPathSetFromSummary(wam, fieldSet);
+        } else {
+            stats->numSeeks = 0;
+            stats->keysExamined = 0;
+        }
+        invariant(fromSummary);
+        return std::move(*fromSummary);
+    }
+
     const auto& indexBounds =
         buildMetadataKeysIndexBounds(entry->descriptor()->keyPattern(), fieldSet);
     return getWildcardMultikeyPathSetHelper(opCtx, entry, indexBounds, stats);
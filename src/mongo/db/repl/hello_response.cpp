@@ -117,6 +117,15 @@ HelloResponse::HelloResponse()
       _shutdownInProgress(false) {}
 
 void HelloResponse::addToBSON(BSONObjBuilder* builder, bool useLegacyResponseFields) const {
+    if (_serializationCache) {
+        builder->appendElements(toBSON(useLegacyResponseFields));
+        return;
+    }
+
+    _addFieldsToBSON(builder, useLegacyResponseFields);
+}
+
+void HelloResponse::_addFieldsToBSON(BSONObjBuilder* builder, bool useLegacyResponseFields) const {
     if (_topologyVersion) {
         BSONObjBuilder topologyVersionBuilder(builder->subobjStart(kTopologyVersionFieldName));
         _topologyVersion->serialize(&topologyVersionBuilder);
@@ -222,11 +231,26 @@ void HelloResponse::addToBSON(BSONObjBuilder* builder, bool useLegacyResponseFie
 }
 
 BSONObj HelloResponse::toBSON(bool useLegacyResponseFields) const {
+    if (_serializationCache) {
+        stdx::lock_guard lk(_serializationCache->mutex);
+        auto& cached = _serializationCache->objs[useLegacyResponseFields ? 1 : 0];
+        if (!cached) {
+            BSONObjBuilder builder;
+            _addFieldsToBSON(&builder, useLegacyResponseFields);
+            cached = builder.obj();
+        }
+        return *cached;
+    }
+
     BSONObjBuilder builder;
-    addToBSON(&builder, useLegacyResponseFields);
+    _addFieldsToBSON(&builder, useLegacyResponseFields);
     return builder.obj();
 }
 
+void HelloResponse::enableSerializationCache() {
+    _serializationCache = std::make_shared<SerializationCache>();
+}
+
 Status HelloResponse::initialize(const BSONObj& doc) {
     Status status = bsonExtractBooleanField(doc, kIsMasterFieldName, &_isWritablePrimary);
     if (!status.isOK()) {
@@ -30,8 +30,10 @@
 #pragma once
 
 #include <absl/container/node_hash_map.h>
+#include <array>
 #include <boost/move/utility_core.hpp>
 #include <boost/optional/optional.hpp>
+#include <memory>
 #include <string>
 #include <sys/types.h>
 #include <vector>
@@ -44,6 +46,7 @@
 #include "mongo/db/repl/optime.h"
 #include "mongo/db/repl/optime_with.h"
 #include "mongo/rpc/topology_version_gen.h"
+#include "mongo/stdx/mutex.h"
 #include "mongo/stdx/unordered_map.h"
 #include "mongo/util/duration.h"
 #include "mongo/util/net/hostandport.h"
@@ -78,6 +81,8 @@ public:
      * standard response to "builder" indicating either that we are in the middle of shutting down
      * or we do not have a valid replica set config, ignoring the values of all other member
      * variables.
+     *
+     * If the serialization cache is enabled, appends the cached serialized response instead.
      */
     void addToBSON(BSONObjBuilder* builder, bool useLegacyResponseFields) const;
 
@@ -87,6 +92,15 @@ public:
      */
     BSONObj toBSON(bool useLegacyResponseFields = true) const;
 
+    /**
+     * Makes toBSON() and addToBSON() build each of the hello and legacy isMaster forms of this
+     * response at most once, and reuse the cached object on later calls. Used for responses handed
+     * to every awaitable hello waiting on a topology change, so that thousands of waiters woken
+     * together each copy the same serialized response instead of building it again. The response
+     * must not be modified afterwards.
+     */
+    void enableSerializationCache();
+
 
     // ===================== Accessors for member variables ================================= //
 
@@ -262,6 +276,12 @@ public:
     void markAsShutdownInProgress();
 
 private:
+    /**
+     * Appends the fields of this response to "builder", as described in addToBSON(), without
+     * going through the serialization cache.
+     */
+    void _addFieldsToBSON(BSONObjBuilder* builder, bool useLegacyResponseFields) const;
+
     bool _isWritablePrimary;
     bool _isWritablePrimarySet;
     bool _secondary;
@@ -303,6 +323,14 @@ private:
     // If _shutdownInProgress is true toBSON will return a set of hardcoded values to indicate
     // that we are mid shutdown
     bool _shutdownInProgress;
+
+    // Set by enableSerializationCache(). Holds the serialized response, indexed by
+    // 'useLegacyResponseFields'.
+    struct SerializationCache {
+        stdx::mutex mutex;
+        std::array<boost::optional<BSONObj>, 2> objs;
+    };
+    std::shared_ptr<SerializationCache> _serializationCache;
 };
 
 }  // namespace repl
@@ -81,6 +81,7 @@
 #include "mongo/db/storage/storage_util.h"
 #include "mongo/db/storage/write_unit_of_work.h"
 #include "mongo/db/tenant_id.h"
+#include "mongo/db/transaction/retryable_write_history_cache.h"
 #include "mongo/db/transaction_resources.h"
 #include "mongo/logv2/attribute_storage.h"
 #include "mongo/logv2/log.h"
@@ -827,6 +828,10 @@ void OplogApplierImpl::_deriveOpsAndFillWriterVectors(
 
     RetryImageRectifier retryImageRectifier;
 
+    // Retryable write history is cached as it is applied, so that a session load after this node
+    // steps up does not have to read it from the oplog again.
+    auto historyCache = RetryableWriteHistoryCache::get(opCtx);
+
     for (auto&& op : *ops) {
         // If the operation's optime is before or the same as the beginApplyingOpTime we don't want
         // to apply it, so don't include it in writerVectors.
@@ -837,6 +842,8 @@ void OplogApplierImpl::_deriveOpsAndFillWriterVectors(
         // We need to track all types of ops, including type 'n' (these are generated from chunk
         // migrations).
         if (sessionUpdateTracker) {
+            historyCache->observeOplogEntry(op);
+
             if (auto newOplogWrites = sessionUpdateTracker->updateSession(op)) {
                 derivedOps->emplace_back(std::move(*newOplogWrites));
                 OplogApplierUtils::addDerivedOps(opCtx,
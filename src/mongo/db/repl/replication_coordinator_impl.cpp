@@ -5004,6 +5004,9 @@ void ReplicationCoordinatorImpl::_fulfillTopologyChangePromise(WithLock lock) {
         } else {
             boost::optional<std::string> horizonString = iter->first;
             auto response = _makeHelloResponse(horizonString, lock, hasValidConfig);
+            // Every hello waiting on this horizon receives the same response, so serialize it
+            // once rather than once per waiter.
+            response->enableSerializationCache();
             // Fulfill the promise and replace with a new one for future waiters.
             iter->second->emplaceValue(response);
             iter->second = std::make_shared<SharedPromise<std::shared_ptr<const HelloResponse>>>();
@@ -3708,6 +3708,57 @@ TEST_F(ReplCoordTest, AwaitHelloResponseReturnsOnStepDown) {
     getHelloThread.join();
 }
 
+TEST_F(ReplCoordTest, AwaitHelloResponseOnTopologyChangeSerializesOnce) {
+    init();
+    assertStartSuccess(BSON("_id"
+                            << "mySet"
+                            << "version" << 2 << "members"
+                            << BSON_ARRAY(BSON("host"
+                                               << "node1:12345"
+                                               << "_id" << 0)
+                                          << BSON("host"
+                                                  << "node2:12345"
+                                                  << "_id" << 1))),
+                       HostAndPort("node1", 12345));
+    ASSERT_OK(getReplCoord()->setFollowerMode(MemberState::RS_SECONDARY));
+
+    auto deadline = getNet()->now() + Milliseconds(5000);
+
+    auto waitForHelloFailPoint = globalFailPointRegistry().find("waitForHelloResponse");
+    auto timesEnteredFailPoint = waitForHelloFailPoint->setMode(FailPoint::alwaysOn, 0);
+    ON_BLOCK_EXIT([&] { waitForHelloFailPoint->setMode(FailPoint::off, 0); });
+
+    // Two hellos waiting on the same TopologyVersion are woken by one topology change.
+    std::shared_ptr<const HelloResponse> responses[2];
+    auto currentTopologyVersion = getTopoCoord().getTopologyVersion();
+    stdx::thread getHelloThreads[2];
+    for (int i = 0; i < 2; ++i) {
+        getHelloThreads[i] = stdx::thread([&, i] {
+            responses[i] =
+                awaitHelloWithNewOpCtx(getReplCoord(), currentTopologyVersion, {}, deadline);
+        });
+    }
+
+    waitForHelloFailPoint->waitForTimesEntered(timesEnteredFailPoint + 2);
+    auto opCtx = makeOperationContext();
+    ASSERT_OK(getReplCoord()->setMaintenanceMode(opCtx.get(), true));
+    for (auto& thread : getHelloThreads) {
+        thread.join();
+    }
+
+    // Both waiters share a response that is serialized once per form.
+    ASSERT_EQ(responses[0], responses[1]);
+    ASSERT_EQ(responses[0]->toBSON(false).objdata(), responses[1]->toBSON(false).objdata());
+    ASSERT_EQ(responses[0]->toBSON(true).objdata(), responses[1]->toBSON(true).objdata());
+    ASSERT_NE(responses[0]->toBSON(false).objdata(), responses[0]->toBSON(true).objdata());
+    ASSERT_FALSE(responses[0]->isSecondary());
+
+    // Each waiter's reply copies the cached response.
+    BSONObjBuilder reply;
+    responses[1]->addToBSON(&reply, false);
+    ASSERT_BSONOBJ_EQ(reply.obj(), responses[0]->toBSON(false));
+}
+
 TEST_F(ReplCoordTest, HelloReturnsErrorOnEnteringQuiesceMode) {
     init();
     assertStartSuccess(BSON("_id"
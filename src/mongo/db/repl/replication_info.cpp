@@ -163,7 +163,10 @@ TopologyVersion appendReplicationInfo(OperationContext* opCtx,
         }
         auto helloResponse =
             replCoord->awaitHelloResponse(opCtx, horizonParams, clientTopologyVersion, deadline);
-        result->appendElements(helloResponse->toBSON(useLegacyResponseFields));
+        // A response shared by awaitable hellos woken by the same topology change is serialized
+        // once and its bytes copied into each reply. Any other response is serialized directly
+        // into the reply.
+        helloResponse->addToBSON(result, useLegacyResponseFields);
         if (appendReplicationProcess) {
             replCoord->appendSecondaryInfoData(result);
         }
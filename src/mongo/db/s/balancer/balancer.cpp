@@ -138,6 +138,7 @@ const Milliseconds kBalanceRoundDefaultInterval(10 * 1000);
 static constexpr StringData kBalancerPolicyStatusDraining = "draining"_sd;
 static constexpr StringData kBalancerPolicyStatusZoneViolation = "zoneViolation"_sd;
 static constexpr StringData kBalancerPolicyStatusChunksImbalance = "chunksImbalance"_sd;
+static constexpr StringData kBalancerPolicyStatusLoadImbalance = "loadImbalance"_sd;
 static constexpr StringData kBalancerPolicyStatusDefragmentingChunks = "defragmentingChunks"_sd;
 
 /**
@@ -805,11 +806,22 @@ void Balancer::report(OperationContext* opCtx, BSONObjBuilder* builder) {
 
     const auto mode = balancerConfig->getBalancerMode();
 
-    stdx::lock_guard<stdx::mutex> scopedLock(_mutex);
-    builder->append("mode", BalancerSettingsType::kBalancerModes[mode]);
-    builder->append("inBalancerRound", _inBalancerRound);
-    builder->append("numBalancerRounds", _numBalancerRounds);
-    builder->append("term", repl::ReplicationCoordinator::get(opCtx)->getTerm());
+    {
+        stdx::lock_guard<stdx::mutex> scopedLock(_mutex);
+        builder->append("mode", BalancerSettingsType::kBalancerModes[mode]);
+        builder->append("inBalancerRound", _inBalancerRound);
+        builder->append("numBalancerRounds", _numBalancerRounds);
+        builder->append("term", repl::ReplicationCoordinator::get(opCtx)->getTerm());
+    }
+
+    // Operations per second sampled on each shard, only reported if load aware balancing is on
+    const auto shardLoads = _chunkSelectionPolicy->getShardLoads();
+    if (!shardLoads.empty()) {
+        BSONObjBuilder shardLoadsBuilder(builder->subobjStart("shardLoads"));
+        for (const auto& [shardId, opsPerSec] : shardLoads) {
+            shardLoadsBuilder.append(shardId.toString(), opsPerSec);
+        }
+    }
 }
 
 void Balancer::_consumeActionStreamLoop() {
@@ -1501,6 +1513,9 @@ BalancerCollectionStatusResponse Balancer::getBalancerStatusForNs(OperationConte
         case MigrationReason::chunksImbalance:
             setViolationOnResponse(kBalancerPolicyStatusChunksImbalance);
             break;
+        case MigrationReason::loadImbalance:
+            setViolationOnResponse(kBalancerPolicyStatusLoadImbalance);
+            break;
     }
 
     return response;
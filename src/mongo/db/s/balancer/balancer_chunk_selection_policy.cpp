@@ -152,12 +152,22 @@ getDataSizeInfoForCollections(OperationContext* opCtx,
         namespacesWithUUIDsForStatsRequest.push_back(nssWithUUID);
     }
 
+    NamespaceStringToShardLoadMap namespaceToShardLoad;
+    const bool loadAwareBalancing = balancerLoadAwareBalancing.load();
+
     auto namespaceToShardDataSize =
-        getStatsForBalancing(opCtx, shardIds, namespacesWithUUIDsForStatsRequest);
+        getStatsForBalancing(opCtx,
+                             shardIds,
+                             namespacesWithUUIDsForStatsRequest,
+                             loadAwareBalancing ? &namespaceToShardLoad : nullptr);
     for (auto& [ns, shardDataSizeMap] : namespaceToShardDataSize) {
         tassert(8245201, "Namespace not found", dataSizeInfoMap.contains(ns));
         dataSizeInfoMap.at(ns).shardToDataSizeMap = std::move(shardDataSizeMap);
     }
+    for (auto& [ns, shardLoadMap] : namespaceToShardLoad) {
+        tassert(9886608, "Namespace not found", dataSizeInfoMap.contains(ns));
+        dataSizeInfoMap.at(ns).shardToLoadMap = std::move(shardLoadMap);
+    }
     return dataSizeInfoMap;
 }
 
@@ -408,6 +418,7 @@ StatusWith<MigrateInfoVector> BalancerChunkSelectionPolicy::selectChunksToMove(
     // Lambda function to select migrate candidates from a batch of collections
     const auto processBatch = [&](std::vector<CollectionType>& collBatch) {
         const auto collsDataSizeInfo = getDataSizeInfoForCollections(opCtx, collBatch);
+        _updateShardLoads(collsDataSizeInfo);
 
         auto client = opCtx->getClient();
         std::shuffle(collBatch.begin(), collBatch.end(), client->getPrng().urbg());
@@ -543,6 +554,35 @@ StatusWith<MigrateInfosWithReason> BalancerChunkSelectionPolicy::selectChunksToM
     return candidatesStatus;
 }
 
+std::map<ShardId, double> BalancerChunkSelectionPolicy::getShardLoads() const {
+    std::map<ShardId, double> shardLoads;
+    stdx::lock_guard lk(_shardLoadsMutex);
+    for (const auto& [_, collShardLoads] : _collectionShardLoads) {
+        for (const auto& [shardId, opsPerSec] : collShardLoads) {
+            shardLoads[shardId] += opsPerSec;
+        }
+    }
+    return shardLoads;
+}
+
+void BalancerChunkSelectionPolicy::_updateShardLoads(
+    const stdx::unordered_map<NamespaceString, CollectionDataSizeInfoForBalancing>&
+        collsDataSizeInfo) {
+    stdx::lock_guard lk(_shardLoadsMutex);
+    for (const auto& [nss, collDataSizeInfo] : collsDataSizeInfo) {
+        if (collDataSizeInfo.shardToLoadMap.empty()) {
+            _collectionShardLoads.erase(nss);
+            continue;
+        }
+
+        auto& collShardLoads = _collectionShardLoads[nss];
+        collShardLoads.clear();
+        for (const auto& [shardId, shardLoad] : collDataSizeInfo.shardToLoadMap) {
+            collShardLoads[shardId] = shardLoad.opsPerSec;
+        }
+    }
+}
+
 StatusWith<SplitInfoVector> BalancerChunkSelectionPolicy::_getSplitCandidatesForCollection(
     OperationContext* opCtx, const NamespaceString& nss, const ShardStatisticsVector& shardStats) {
     auto routingInfoStatus =
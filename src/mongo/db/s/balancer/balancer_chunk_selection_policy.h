@@ -31,6 +31,7 @@
 
 #include <boost/optional.hpp>
 #include <boost/optional/optional.hpp>
+#include <map>
 #include <unordered_set>
 #include <vector>
 
@@ -43,6 +44,8 @@
 #include "mongo/db/shard_id.h"
 #include "mongo/s/catalog/type_chunk.h"
 #include "mongo/s/catalog/type_collection.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/stdx/unordered_map.h"
 #include "mongo/stdx/unordered_set.h"
 
 namespace mongo {
@@ -95,7 +98,21 @@ public:
     StatusWith<MigrateInfosWithReason> selectChunksToMove(OperationContext* opCtx,
                                                           const NamespaceString& ns);
 
+    /**
+     * Returns the load sampled on each shard, in operations per second, summed over the
+     * collections as of the last time their chunks were considered for moving. Empty unless load
+     * aware balancing is enabled.
+     */
+    std::map<ShardId, double> getShardLoads() const;
+
 private:
+    /**
+     * Records the load sampled on each shard for the given collections.
+     */
+    void _updateShardLoads(
+        const stdx::unordered_map<NamespaceString, CollectionDataSizeInfoForBalancing>&
+            collsDataSizeInfo);
+
     /**
      * Synchronous method, which iterates the collection's chunks and uses the zones information to
      * figure out whether some of them validate the zone range boundaries and need to be split.
@@ -119,6 +136,12 @@ private:
     // Source for obtaining cluster statistics. Not owned and must not be destroyed before the
     // policy object is destroyed.
     ClusterStatistics* const _clusterStats;
+
+    // Protects '_collectionShardLoads'
+    mutable stdx::mutex _shardLoadsMutex;
+
+    // Load sampled on each shard for each collection, in operations per second
+    stdx::unordered_map<NamespaceString, std::map<ShardId, double>> _collectionShardLoads;
 };
 
 }  // namespace mongo
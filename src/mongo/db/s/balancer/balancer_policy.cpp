@@ -50,6 +50,7 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/db/s/balancer/balancer_policy.h"
 #include "mongo/db/s/config/sharding_catalog_manager.h"
+#include "mongo/db/s/sharding_config_server_parameters_gen.h"
 #include "mongo/db/s/sharding_util.h"
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
@@ -137,6 +138,46 @@ std::vector<ZoneRange> normalizeZones(const ChunkManager& cm, const ZoneInfo& zo
     return normalizedRanges;
 }
 
+/**
+ * Moves the share of the load of a hot range reported by 'reportingShard' which belongs to parts
+ * of the range it no longer owns over to their current owners.
+ *
+ * The balancer only splits hot ranges at their median key, so each half of a range with a known
+ * median key carries half of its load. Within each half the load is spread evenly across the
+ * chunks it overlaps, since the samples cannot tell how the accesses are distributed among them.
+ */
+void creditMovedRangeLoad(const ChunkManager& cm,
+                          const ShardId& reportingShard,
+                          const RangeLoadInfo& hotRange,
+                          std::map<ShardId, double>* shardToLoad) {
+    std::vector<std::pair<ChunkRange, double>> parts;
+    if (hotRange.medianKey) {
+        parts.emplace_back(ChunkRange(hotRange.range.getMin(), *hotRange.medianKey),
+                           hotRange.opsPerSec / 2);
+        parts.emplace_back(ChunkRange(*hotRange.medianKey, hotRange.range.getMax()),
+                           hotRange.opsPerSec / 2);
+    } else {
+        parts.emplace_back(hotRange.range, hotRange.opsPerSec);
+    }
+
+    for (const auto& [part, partLoad] : parts) {
+        std::vector<ShardId> owners;
+        cm.forEachOverlappingChunk(
+            part.getMin(), part.getMax(), false /* isMaxInclusive */, [&](const auto& chunk) {
+                owners.push_back(chunk.getShardId());
+                return true;
+            });
+
+        for (const auto& owner : owners) {
+            if (owner != reportingShard) {
+                const auto movedLoad = partLoad / owners.size();
+                (*shardToLoad)[reportingShard] -= movedLoad;
+                (*shardToLoad)[owner] += movedLoad;
+            }
+        }
+    }
+}
+
 }  // namespace
 
 DistributionStatus::DistributionStatus(NamespaceString nss,
@@ -736,6 +777,25 @@ MigrateInfosWithReason BalancerPolicy::balance(
         }
     }
 
+    // 4) for each zone balance the load sampled by the shards, if available and if the data size
+    // is already balanced, so that the two steps do not compete for the same shards
+    if (migrations.empty() && !collDataSizeInfo.shardToLoadMap.empty()) {
+        for (const auto& zone : zonesPlusEmpty) {
+            while (_singleZoneBalanceBasedOnLoad(shardStats,
+                                                 distribution,
+                                                 collDataSizeInfo,
+                                                 zone,
+                                                 &migrations,
+                                                 availableShards,
+                                                 forceJumbo ? ForceJumbo::kForceBalancer
+                                                            : ForceJumbo::kDoNotForce)) {
+                if (firstReason == MigrationReason::none) {
+                    firstReason = MigrationReason::loadImbalance;
+                }
+            }
+        }
+    }
+
     return std::make_pair(std::move(migrations), firstReason);
 }
 
@@ -838,6 +898,135 @@ bool BalancerPolicy::_singleZoneBalanceBasedOnDataSize(
     return chunkFound;
 }
 
+bool BalancerPolicy::_singleZoneBalanceBasedOnLoad(
+    const ShardStatisticsVector& shardStats,
+    const DistributionStatus& distribution,
+    const CollectionDataSizeInfoForBalancing& collDataSizeInfo,
+    const string& zone,
+    vector<MigrateInfo>* migrations,
+    stdx::unordered_set<ShardId>* availableShards,
+    ForceJumbo forceJumbo) {
+    const auto& cm = distribution.getChunkManager();
+
+    // The load reported by a shard lags behind the migrations of its hot ranges, so attribute the
+    // load of each reported hot range to the shards which currently own it.
+    std::map<ShardId, double> shardToLoad;
+    for (const auto& [shardId, shardLoad] : collDataSizeInfo.shardToLoadMap) {
+        shardToLoad[shardId] += shardLoad.opsPerSec;
+        for (const auto& hotRange : shardLoad.hotRanges) {
+            creditMovedRangeLoad(cm, shardId, hotRange, &shardToLoad);
+        }
+    }
+
+    ShardId from;
+    ShardId to;
+    double fromLoad = -1;
+    double toLoad = numeric_limits<double>::max();
+    double totalLoadOfShardsWithZone = 0;
+    size_t numShardsInZone = 0;
+
+    for (const auto& stat : shardStats) {
+        if (zone != ZoneInfo::kNoZoneName && !stat.shardZones.count(zone)) {
+            continue;
+        }
+
+        const auto loadIt = shardToLoad.find(stat.shardId);
+        if (loadIt == shardToLoad.end()) {
+            // Skip if stats not available (may happen if add|remove shard during a round)
+            continue;
+        }
+
+        const auto load = loadIt->second;
+        totalLoadOfShardsWithZone += load;
+        numShardsInZone++;
+
+        if (!availableShards->count(stat.shardId)) {
+            continue;
+        }
+
+        if (!stat.isDraining && load > fromLoad) {
+            from = stat.shardId;
+            fromLoad = load;
+        }
+
+        if (isShardSuitableReceiver(stat, zone).isOK() && load < toLoad) {
+            to = stat.shardId;
+            toLoad = load;
+        }
+    }
+
+    if (!from.isValid() || !to.isValid() || from == to) {
+        return false;
+    }
+
+    const double averageLoadForZone = totalLoadOfShardsWithZone / numShardsInZone;
+
+    LOGV2_DEBUG(9886605,
+                1,
+                "Balancing load of single zone",
+                logAttrs(distribution.nss()),
+                "zone"_attr = zone,
+                "averageLoadForZone"_attr = averageLoadForZone,
+                "fromShardId"_attr = from,
+                "fromShardLoad"_attr = fromLoad,
+                "toShardId"_attr = to,
+                "toShardLoad"_attr = toLoad);
+
+    if (fromLoad < balancerLoadMinOpsPerSec.load() ||
+        fromLoad <= averageLoadForZone * balancerLoadImbalanceThreshold.load()) {
+        return false;
+    }
+
+    const auto fromLoadIt = collDataSizeInfo.shardToLoadMap.find(from);
+    if (fromLoadIt == collDataSizeInfo.shardToLoadMap.end()) {
+        return false;
+    }
+
+    for (const auto& hotRange : fromLoadIt->second.hotRanges) {
+        // Only consider ranges which still match a whole chunk on the donor shard
+        const auto chunk = cm.findIntersectingChunkWithSimpleCollation(hotRange.range.getMin());
+        if (chunk.getShardId() != from || chunk.isJumbo() ||
+            SimpleBSONObjComparator::kInstance.evaluate(chunk.getMin() !=
+                                                        hotRange.range.getMin()) ||
+            SimpleBSONObjComparator::kInstance.evaluate(chunk.getMax() !=
+                                                        hotRange.range.getMax()) ||
+            distribution.getZoneInfo().getZoneForRange(chunk.getRange()) != zone) {
+            continue;
+        }
+
+        auto movedLoad = hotRange.opsPerSec;
+        auto maxKey = chunk.getMax();
+        if (toLoad + movedLoad >= fromLoad - movedLoad) {
+            // Moving the whole range would just make the recipient the most loaded shard, so
+            // move only the half of it below the median key, if known
+            movedLoad /= 2;
+            if (!hotRange.medianKey || toLoad + movedLoad >= fromLoad - movedLoad) {
+                continue;
+            }
+            maxKey = *hotRange.medianKey;
+        }
+
+        migrations->emplace_back(to,
+                                 from,
+                                 distribution.nss(),
+                                 cm.getUUID(),
+                                 chunk.getMin(),
+                                 maxKey,
+                                 chunk.getLastmod(),
+                                 forceJumbo,
+                                 collDataSizeInfo.maxChunkSizeBytes);
+        tassert(9886606,
+                "Source shard does not exist in available shards",
+                availableShards->erase(from));
+        tassert(9886607,
+                "Target shard does not exist in available shards",
+                availableShards->erase(to));
+        return true;
+    }
+
+    return false;
+}
+
 ZoneRange::ZoneRange(const BSONObj& a_min, const BSONObj& a_max, const std::string& _zone)
     : min(a_min.getOwned()), max(a_max.getOwned()), zone(_zone) {}
 
@@ -990,10 +1179,14 @@ DataSizeInfo::DataSizeInfo(const ShardId& shardId,
 NamespaceStringToShardDataSizeMap getStatsForBalancing(
     OperationContext* opCtx,
     const std::vector<ShardId>& shardIds,
-    const std::vector<NamespaceWithOptionalUUID>& namespacesWithUUIDsForStatsRequest) {
+    const std::vector<NamespaceWithOptionalUUID>& namespacesWithUUIDsForStatsRequest,
+    NamespaceStringToShardLoadMap* namespaceToShardLoad) {
 
     ShardsvrGetStatsForBalancing req{namespacesWithUUIDsForStatsRequest};
     req.setScaleFactor(1);
+    if (namespaceToShardLoad) {
+        req.setIncludeRangeLoads(true);
+    }
     const auto reqObj = req.toBSON();
 
     const auto executor = Grid::get(opCtx)->getExecutorPool()->getFixedExecutor();
@@ -1021,6 +1214,19 @@ NamespaceStringToShardDataSizeMap getStatsForBalancing(
 
             for (const auto& stats : collStatsFromShard) {
                 namespaceToShardDataSize[stats.getNs()][shardId] = stats.getCollSize();
+
+                if (namespaceToShardLoad) {
+                    auto& shardLoad = (*namespaceToShardLoad)[stats.getNs()][shardId];
+                    shardLoad.opsPerSec = stats.getOpsPerSec().value_or(0);
+                    if (const auto& hotRanges = stats.getHotRanges()) {
+                        for (const auto& hotRange : *hotRanges) {
+                            shardLoad.hotRanges.push_back(
+                                {ChunkRange(hotRange.getMin(), hotRange.getMax()),
+                                 hotRange.getOpsPerSec(),
+                                 hotRange.getMedianKey()});
+                        }
+                    }
+                }
             }
         } catch (const ExceptionFor<ErrorCodes::ShardNotFound>& ex) {
             // Handle `removeShard`: skip shards removed during a balancing round
@@ -113,7 +113,7 @@ struct MigrateInfo {
     boost::optional<int64_t> optMaxChunkSizeBytes;
 };
 
-enum MigrationReason { none, drain, zoneViolation, chunksImbalance };
+enum MigrationReason { none, drain, zoneViolation, chunksImbalance, loadImbalance };
 
 typedef std::vector<MigrateInfo> MigrateInfoVector;
 
@@ -232,6 +232,29 @@ typedef StringMap<StringMap<ShardZoneInfo>> ShardZoneInfoMap;
 
 using ShardDataSizeMap = std::map<ShardId, int64_t>;
 using NamespaceStringToShardDataSizeMap = stdx::unordered_map<NamespaceString, ShardDataSizeMap>;
+
+/*
+ * Load sampled by a shard on one of the ranges of a collection it owns.
+ */
+struct RangeLoadInfo {
+    ChunkRange range;
+    double opsPerSec;
+    // Shard key value splitting the sampled operations on the range in two halves, if known
+    boost::optional<BSONObj> medianKey;
+};
+
+/*
+ * Load sampled by a shard on the ranges of a collection it owns.
+ */
+struct ShardLoadInfo {
+    double opsPerSec{0};
+    // The hottest ranges, sorted by descending load
+    std::vector<RangeLoadInfo> hotRanges;
+};
+
+using ShardLoadMap = std::map<ShardId, ShardLoadInfo>;
+using NamespaceStringToShardLoadMap = stdx::unordered_map<NamespaceString, ShardLoadMap>;
+
 /*
  * Keeps track of info needed for data size aware balancing.
  */
@@ -242,12 +265,21 @@ struct CollectionDataSizeInfoForBalancing {
 
     ShardDataSizeMap shardToDataSizeMap;
     const int64_t maxChunkSizeBytes;
+
+    // Populated only if load based balancing is enabled
+    ShardLoadMap shardToLoadMap;
 };
 
+/**
+ * Retrieves the size of the data owned by each of the given shards for each of the given
+ * collections. If 'namespaceToShardLoad' is specified, also retrieves the load sampled by the
+ * shards on the ranges of those collections.
+ */
 NamespaceStringToShardDataSizeMap getStatsForBalancing(
     OperationContext* opCtx,
     const std::vector<ShardId>& shardIds,
-    const std::vector<NamespaceWithOptionalUUID>& namespacesWithUUIDsForStatsRequest);
+    const std::vector<NamespaceWithOptionalUUID>& namespacesWithUUIDsForStatsRequest,
+    NamespaceStringToShardLoadMap* namespaceToShardLoad = nullptr);
 
 ShardDataSizeMap getStatsForBalancing(
     OperationContext* opCtx,
@@ -467,6 +499,10 @@ public:
      * any of the shards have chunks, which are sufficiently higher than this number, suggests
      * moving chunks to shards, which are under this number.
      *
+     * If the load sampled by the shards is available and no other migrations were selected for the
+     * collection, the hottest ranges of the shards, which are sufficiently more loaded than the
+     * average, are moved to the least loaded shards.
+     *
      * The availableShards parameter is in/out and it contains the set of shards, which haven't
      * been used for migrations yet. Used so we don't return multiple conflicting migrations for the
      * same shard.
@@ -516,6 +552,26 @@ private:
         std::vector<MigrateInfo>* migrations,
         stdx::unordered_set<ShardId>* availableShards,
         ForceJumbo forceJumbo);
+
+    /**
+     * Selects the hottest range of the most loaded shard for the specified zone to be moved to the
+     * least loaded shard, if the former is loaded more than 'balancerLoadImbalanceThreshold' times
+     * the average load of the zone. If moving the whole range would make the recipient more loaded
+     * than the donor, only its lower half is moved, and if even that would, nothing is moved, so
+     * that ranges do not bounce back and forth between shards. Takes into account and updates the
+     * shards, which haven't been used for migrations yet.
+     *
+     * Returns true if a migration was suggested, false otherwise. This method is intended to be
+     * called multiple times until all possible migrations for a zone have been selected.
+     */
+    static bool _singleZoneBalanceBasedOnLoad(
+        const ShardStatisticsVector& shardStats,
+        const DistributionStatus& distribution,
+        const CollectionDataSizeInfoForBalancing& collDataSizeInfo,
+        const std::string& zone,
+        std::vector<MigrateInfo>* migrations,
+        stdx::unordered_set<ShardId>* availableShards,
+        ForceJumbo forceJumbo);
 };
 
 }  // namespace mongo
@@ -1111,6 +1111,168 @@ TEST(BalancerPolicy, BalancerHandlesNoShardsWithZone) {
     ASSERT(balanceChunks(cluster.first, distribution, false, false).first.empty());
 }
 
+MigrateInfosWithReason balanceChunksWithLoad(const ClusterStats& clusterStats,
+                                             const DistributionStatus& distribution,
+                                             ShardLoadMap shardToLoadMap) {
+    auto availableShards = getAllShardIds(clusterStats);
+    auto collDataSizeInfo = buildDataSizeInfoForBalancingFromShardStats(clusterStats);
+    collDataSizeInfo.shardToLoadMap = std::move(shardToLoadMap);
+
+    return BalancerPolicy::balance(clusterStats.shardStats,
+                                   distribution,
+                                   collDataSizeInfo,
+                                   &availableShards,
+                                   false /* forceJumbo */);
+}
+
+TEST(BalancerPolicy, LoadImbalanceMovesHottestRange) {
+    auto [cluster, cm] = generateCluster({{2, 2 * kDefaultMaxChunkSizeBytes},
+                                          {2, 2 * kDefaultMaxChunkSizeBytes},
+                                          {2, 2 * kDefaultMaxChunkSizeBytes}});
+
+    const auto& hotChunk = cluster.second[getShardId(0)][1];
+    ShardLoadMap shardToLoadMap;
+    shardToLoadMap[getShardId(0)] = {1000, {{hotChunk.getRange(), 300, boost::none}}};
+    shardToLoadMap[getShardId(1)] = {100, {}};
+    shardToLoadMap[getShardId(2)] = {200, {}};
+
+    const auto [migrations, reason] =
+        balanceChunksWithLoad(cluster.first, makeDistStatus(cm), std::move(shardToLoadMap));
+    ASSERT_EQ(1U, migrations.size());
+    ASSERT_EQ(MigrationReason::loadImbalance, reason);
+    ASSERT_EQ(getShardId(0), migrations[0].from);
+    ASSERT_EQ(getShardId(1), migrations[0].to);
+    ASSERT_BSONOBJ_EQ(hotChunk.getMin(), migrations[0].minKey);
+    ASSERT_BSONOBJ_EQ(hotChunk.getMax(), *migrations[0].maxKey);
+}
+
+TEST(BalancerPolicy, LoadImbalanceMovesLowerHalfOfRangeIfWholeRangeWouldInvertImbalance) {
+    auto [cluster, cm] = generateCluster({{2, 2 * kDefaultMaxChunkSizeBytes},
+                                          {2, 2 * kDefaultMaxChunkSizeBytes},
+                                          {2, 2 * kDefaultMaxChunkSizeBytes}});
+
+    const auto& hotChunk = cluster.second[getShardId(0)][1];
+    const auto medianKey = BSON("x" << 1.5);
+    ShardLoadMap shardToLoadMap;
+    shardToLoadMap[getShardId(0)] = {1000, {{hotChunk.getRange(), 600, medianKey}}};
+    shardToLoadMap[getShardId(1)] = {100, {}};
+    shardToLoadMap[getShardId(2)] = {200, {}};
+
+    const auto [migrations, reason] =
+        balanceChunksWithLoad(cluster.first, makeDistStatus(cm), std::move(shardToLoadMap));
+    ASSERT_EQ(1U, migrations.size());
+    ASSERT_EQ(MigrationReason::loadImbalance, reason);
+    ASSERT_EQ(getShardId(0), migrations[0].from);
+    ASSERT_EQ(getShardId(1), migrations[0].to);
+    ASSERT_BSONOBJ_EQ(hotChunk.getMin(), migrations[0].minKey);
+    ASSERT_BSONOBJ_EQ(medianKey, *migrations[0].maxKey);
+}
+
+TEST(BalancerPolicy, LoadImbalanceNoMigrationIfRangeCannotBeSplit) {
+    auto [cluster, cm] = generateCluster({{2, 2 * kDefaultMaxChunkSizeBytes},
+                                          {2, 2 * kDefaultMaxChunkSizeBytes},
+                                          {2, 2 * kDefaultMaxChunkSizeBytes}});
+
+    const auto& hotChunk = cluster.second[getShardId(0)][1];
+    ShardLoadMap shardToLoadMap;
+    shardToLoadMap[getShardId(0)] = {1000, {{hotChunk.getRange(), 900, boost::none}}};
+    shardToLoadMap[getShardId(1)] = {100, {}};
+    shardToLoadMap[getShardId(2)] = {200, {}};
+
+    const auto [migrations, reason] =
+        balanceChunksWithLoad(cluster.first, makeDistStatus(cm), std::move(shardToLoadMap));
+    ASSERT(migrations.empty());
+    ASSERT_EQ(MigrationReason::none, reason);
+}
+
+TEST(BalancerPolicy, LoadImbalanceNoMigrationWithinThreshold) {
+    auto [cluster, cm] = generateCluster({{2, 2 * kDefaultMaxChunkSizeBytes},
+                                          {2, 2 * kDefaultMaxChunkSizeBytes},
+                                          {2, 2 * kDefaultMaxChunkSizeBytes}});
+
+    const auto& hotChunk = cluster.second[getShardId(0)][1];
+    ShardLoadMap shardToLoadMap;
+    shardToLoadMap[getShardId(0)] = {500, {{hotChunk.getRange(), 200, boost::none}}};
+    shardToLoadMap[getShardId(1)] = {300, {}};
+    shardToLoadMap[getShardId(2)] = {300, {}};
+
+    const auto [migrations, reason] =
+        balanceChunksWithLoad(cluster.first, makeDistStatus(cm), std::move(shardToLoadMap));
+    ASSERT(migrations.empty());
+    ASSERT_EQ(MigrationReason::none, reason);
+}
+
+TEST(BalancerPolicy, LoadImbalanceAccountsForAlreadyMovedHotRanges) {
+    auto [cluster, cm] = generateCluster({{2, 2 * kDefaultMaxChunkSizeBytes},
+                                          {2, 2 * kDefaultMaxChunkSizeBytes},
+                                          {2, 2 * kDefaultMaxChunkSizeBytes}});
+
+    // The donor still reports the load of a range which has already been moved to shard_1
+    const auto& movedChunk = cluster.second[getShardId(1)][0];
+    const auto& hotChunk = cluster.second[getShardId(0)][1];
+    ShardLoadMap shardToLoadMap;
+    shardToLoadMap[getShardId(0)] = {
+        1000, {{movedChunk.getRange(), 500, boost::none}, {hotChunk.getRange(), 300, boost::none}}};
+    shardToLoadMap[getShardId(1)] = {100, {}};
+    shardToLoadMap[getShardId(2)] = {200, {}};
+
+    const auto [migrations, reason] =
+        balanceChunksWithLoad(cluster.first, makeDistStatus(cm), std::move(shardToLoadMap));
+    ASSERT(migrations.empty());
+    ASSERT_EQ(MigrationReason::none, reason);
+}
+
+TEST(BalancerPolicy, LoadImbalanceSplitsLoadOfHalfMovedHotRange) {
+    auto [cluster, cm] = generateCluster({{2, 2 * kDefaultMaxChunkSizeBytes},
+                                          {2, 2 * kDefaultMaxChunkSizeBytes},
+                                          {2, 2 * kDefaultMaxChunkSizeBytes}});
+
+    // Shard_1 still reports the load of a range whose lower half has been moved to shard_0, so
+    // only half of that load is now served by shard_0
+    const auto& movedHalf = cluster.second[getShardId(0)][1];
+    const auto& keptHalf = cluster.second[getShardId(1)][0];
+    const auto& hotChunk = cluster.second[getShardId(1)][1];
+    ShardLoadMap shardToLoadMap;
+    shardToLoadMap[getShardId(0)] = {100, {}};
+    shardToLoadMap[getShardId(1)] = {
+        1000,
+        {{ChunkRange(movedHalf.getMin(), keptHalf.getMax()), 600, keptHalf.getMin()},
+         {hotChunk.getRange(), 200, boost::none}}};
+    shardToLoadMap[getShardId(2)] = {200, {}};
+
+    const auto [migrations, reason] =
+        balanceChunksWithLoad(cluster.first, makeDistStatus(cm), std::move(shardToLoadMap));
+    ASSERT_EQ(1U, migrations.size());
+    ASSERT_EQ(MigrationReason::loadImbalance, reason);
+    ASSERT_EQ(getShardId(1), migrations[0].from);
+    ASSERT_EQ(getShardId(2), migrations[0].to);
+    ASSERT_BSONOBJ_EQ(hotChunk.getMin(), migrations[0].minKey);
+    ASSERT_BSONOBJ_EQ(hotChunk.getMax(), *migrations[0].maxKey);
+}
+
+TEST(BalancerPolicy, LoadImbalanceNotBalancedWhileDataSizeIsImbalanced) {
+    auto [cluster, cm] = generateCluster({{2, 8 * kDefaultMaxChunkSizeBytes},
+                                          {2, 2 * kDefaultMaxChunkSizeBytes},
+                                          {2, 0},
+                                          {2, 2 * kDefaultMaxChunkSizeBytes}});
+
+    const auto& hotChunk = cluster.second[getShardId(1)][1];
+    ShardLoadMap shardToLoadMap;
+    shardToLoadMap[getShardId(0)] = {100, {}};
+    shardToLoadMap[getShardId(1)] = {1000, {{hotChunk.getRange(), 300, boost::none}}};
+    shardToLoadMap[getShardId(2)] = {100, {}};
+    shardToLoadMap[getShardId(3)] = {100, {}};
+
+    // Shard_1 and shard_3 are still available after the data size migration, but the load is not
+    // balanced until the data size is
+    const auto [migrations, reason] =
+        balanceChunksWithLoad(cluster.first, makeDistStatus(cm), std::move(shardToLoadMap));
+    ASSERT_EQ(1U, migrations.size());
+    ASSERT_EQ(MigrationReason::chunksImbalance, reason);
+    ASSERT_EQ(getShardId(0), migrations[0].from);
+    ASSERT_EQ(getShardId(2), migrations[0].to);
+}
+
 TEST(DistributionStatus, OneChunkNoZone) {
     const auto chunks =
         makeChunks({{getShardId(0), {kShardKeyPattern.globalMin(), kShardKeyPattern.globalMax()}}});
@@ -53,10 +53,13 @@
 #include "mongo/bson/oid.h"
 #include "mongo/bson/simple_bsonobj_comparator.h"
 #include "mongo/bson/timestamp.h"
+#include "mongo/db/exec/shard_filterer.h"
+#include "mongo/db/exec/shard_filterer_impl.h"
 #include "mongo/db/keypattern.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/query/collation/collator_interface.h"
 #include "mongo/db/s/collection_metadata.h"
+#include "mongo/db/s/scoped_collection_metadata.h"
 #include "mongo/db/shard_id.h"
 #include "mongo/platform/compiler.h"
 #include "mongo/platform/random.h"
@@ -344,6 +347,38 @@ std::vector<BSONObj> makeKeys(int nChunks) {
     return keys;
 }
 
+/**
+ * Returns the documents a collection scan in shard key order would visit, spread evenly over the
+ * chunks so that consecutive documents mostly fall within the same chunk.
+ */
+std::vector<BSONObj> makeSortedScanDocs(int nChunks) {
+    constexpr int nDocs = 200000;
+    const long long keySpace = nChunks * 100LL;
+
+    std::vector<BSONObj> docs;
+    docs.reserve(nDocs);
+
+    for (int i = 0; i < nDocs; ++i) {
+        docs.emplace_back(BSON("_id" << i * keySpace / nDocs << "x"
+                                     << "value"));
+    }
+
+    return docs;
+}
+
+class StaticCollectionDescription : public ScopedCollectionDescription::Impl {
+public:
+    explicit StaticCollectionDescription(CollectionMetadata metadata)
+        : _metadata(std::move(metadata)) {}
+
+    const CollectionMetadata& get() override {
+        return _metadata;
+    }
+
+private:
+    const CollectionMetadata _metadata;
+};
+
 std::vector<std::pair<BSONObj, BSONObj>> makeRanges(const std::vector<BSONObj>& keys) {
     std::vector<std::pair<BSONObj, BSONObj>> ranges;
     ranges.reserve(keys.size() / 2);
@@ -488,6 +523,55 @@ void BM_KeyBelongsToMe(benchmark::State& state,
     state.SetItemsProcessed(state.iterations());
 }
 
+template <typename CollectionMetadataBuilderFn>
+void BM_KeyBelongsToMeSortedScan(benchmark::State& state,
+                                 CollectionMetadataBuilderFn makeCollectionMetadata) {
+    const int nShards = state.range(0);
+    const int nChunks = state.range(1);
+
+    auto metadata = makeCollectionMetadata(nShards, nChunks);
+    const auto& shardKeyPattern = metadata.getShardKeyPattern();
+    auto docs = makeSortedScanDocs(nChunks);
+    auto docsIter = makeCircularIterator(docs);
+
+    size_t nOwned = 0;
+
+    for (auto keepRunning : state) {
+        if (metadata.keyBelongsToMe(shardKeyPattern.extractShardKeyFromDoc(*docsIter))) {
+            ++nOwned;
+        }
+        ++docsIter;
+    }
+
+    state.counters["nOwned"] = nOwned;
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <typename CollectionMetadataBuilderFn>
+void BM_ShardFiltererSortedScan(benchmark::State& state,
+                                CollectionMetadataBuilderFn makeCollectionMetadata) {
+    const int nShards = state.range(0);
+    const int nChunks = state.range(1);
+
+    ShardFiltererImpl filterer(ScopedCollectionFilter(
+        std::make_shared<StaticCollectionDescription>(makeCollectionMetadata(nShards, nChunks))));
+    auto docs = makeSortedScanDocs(nChunks);
+    auto docsIter = makeCircularIterator(docs);
+
+    size_t nOwned = 0;
+
+    for (auto keepRunning : state) {
+        if (filterer.documentBelongsToMe(*docsIter) ==
+            ShardFilterer::DocumentBelongsResult::kBelongs) {
+            ++nOwned;
+        }
+        ++docsIter;
+    }
+
+    state.counters["nOwned"] = nOwned;
+    state.SetItemsProcessed(state.iterations());
+}
+
 template <typename CollectionMetadataBuilderFn>
 void BM_RangeOverlapsChunk(benchmark::State& state,
                            CollectionMetadataBuilderFn makeCollectionMetadata) {
@@ -540,6 +624,17 @@ MONGO_INITIALIZER(RegisterBenchmarks)(InitializerContext* context) {
             BM_KeyBelongsToMe, Pessimal, makeChunkManagerWithPessimalBalancedDistribution),
         REGISTER_BENCHMARK_CAPTURE(
             BM_KeyBelongsToMe, Optimal, makeChunkManagerWithOptimalBalancedDistribution),
+        REGISTER_BENCHMARK_CAPTURE(BM_KeyBelongsToMeSortedScan,
+                                   Pessimal,
+                                   makeChunkManagerWithPessimalBalancedDistribution),
+        REGISTER_BENCHMARK_CAPTURE(BM_KeyBelongsToMeSortedScan,
+                                   Optimal,
+                                   makeChunkManagerWithOptimalBalancedDistribution),
+        REGISTER_BENCHMARK_CAPTURE(BM_ShardFiltererSortedScan,
+                                   Pessimal,
+                                   makeChunkManagerWithPessimalBalancedDistribution),
+        REGISTER_BENCHMARK_CAPTURE(
+            BM_ShardFiltererSortedScan, Optimal, makeChunkManagerWithOptimalBalancedDistribution),
         REGISTER_BENCHMARK_CAPTURE(
             BM_RangeOverlapsChunk, Pessimal, makeChunkManagerWithPessimalBalancedDistribution),
         REGISTER_BENCHMARK_CAPTURE(
@@ -231,6 +231,26 @@ public:
         return _cm->keyBelongsToShard(key, _thisShardId);
     }
 
+    struct KeyRangeOwnership {
+        ChunkRange range;
+        bool owned;
+    };
+
+    /**
+     * Returns the range of the chunk which contains 'key' and whether it belongs to this chunkset,
+     * or boost::none if no chunk contains 'key'. Lets callers checking many keys answer for the
+     * keys within the returned range without looking them up. If key is not a valid shard key, the
+     * behaviour is undefined.
+     */
+    boost::optional<KeyRangeOwnership> keyRangeOwnership(const BSONObj& key) const {
+        invariant(hasRoutingTable());
+        auto chunk = _cm->findChunkContainingKey(key);
+        if (!chunk) {
+            return boost::none;
+        }
+        return KeyRangeOwnership{chunk->getRange(), chunk->getShardId() == _thisShardId};
+    }
+
     /**
      * This finds the nearest chunk to a given 'key' owned by the current shard in the
      * specified chunk map scan 'direction', and returns it as a 'ChunkOwnership'. If the key is
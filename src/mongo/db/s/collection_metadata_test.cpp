@@ -29,6 +29,7 @@
 
 #include <boost/move/utility_core.hpp>
 #include <boost/none.hpp>
+#include <memory>
 #include <utility>
 
 #include <boost/optional/optional.hpp>
@@ -39,9 +40,11 @@
 #include "mongo/bson/oid.h"
 #include "mongo/bson/simple_bsonobj_comparator.h"
 #include "mongo/bson/timestamp.h"
+#include "mongo/db/exec/shard_filterer_impl.h"
 #include "mongo/db/query/collation/collator_interface.h"
 #include "mongo/db/s/collection_metadata.h"
 #include "mongo/db/s/resharding/resharding_util.h"
+#include "mongo/db/s/scoped_collection_metadata.h"
 #include "mongo/s/catalog/type_chunk.h"
 #include "mongo/s/database_version.h"
 #include "mongo/s/resharding/common_types_gen.h"
@@ -406,6 +409,72 @@ TEST_F(ThreeChunkWithRangeGapFixture, KeyBelongsToMe) {
     ASSERT(!makeCollectionMetadata().keyBelongsToMe(BSONObj()));
 }
 
+/**
+ * Counts how many times a ShardFiltererImpl consults the metadata, which it only does to look up
+ * keys outside the range of the chunk it found last.
+ */
+class CountingCollectionDescription : public ScopedCollectionDescription::Impl {
+public:
+    explicit CountingCollectionDescription(CollectionMetadata metadata)
+        : _metadata(std::move(metadata)) {}
+
+    const CollectionMetadata& get() override {
+        ++numLookups;
+        return _metadata;
+    }
+
+    int numLookups = 0;
+
+private:
+    const CollectionMetadata _metadata;
+};
+
+TEST_F(ThreeChunkWithRangeGapFixture, ShardFiltererCachesLastChunkRange) {
+    auto description = std::make_shared<CountingCollectionDescription>(makeCollectionMetadata());
+    ShardFiltererImpl filterer{ScopedCollectionFilter(description)};
+
+    ASSERT(filterer.keyBelongsToMe(BSON("a" << MINKEY)));
+    ASSERT_EQ(description->numLookups, 1);
+    ASSERT(filterer.keyBelongsToMe(BSON("a" << 0)));
+    ASSERT(filterer.keyBelongsToMe(BSON("a" << 9)));
+    ASSERT_EQ(description->numLookups, 1);
+
+    // The max of the cached range belongs to the next chunk.
+    ASSERT(filterer.keyBelongsToMe(BSON("a" << 10)));
+    ASSERT_EQ(description->numLookups, 2);
+    ASSERT(filterer.keyBelongsToMe(BSON("a" << 19)));
+    ASSERT_EQ(description->numLookups, 2);
+
+    // The range of a chunk owned by another shard is cached as well.
+    ASSERT(!filterer.keyBelongsToMe(BSON("a" << 20)));
+    ASSERT(!filterer.keyBelongsToMe(BSON("a" << 25)));
+    ASSERT_EQ(description->numLookups, 3);
+
+    // Going back to an earlier chunk replaces the cached range.
+    ASSERT(filterer.keyBelongsToMe(BSON("a" << 15)));
+    ASSERT_EQ(description->numLookups, 4);
+    ASSERT(!filterer.keyBelongsToMe(BSON("a" << 29)));
+    ASSERT_EQ(description->numLookups, 5);
+}
+
+TEST_F(ThreeChunkWithRangeGapFixture, ShardFiltererCachesLastChunkRangeUpToMaxKey) {
+    auto description = std::make_shared<CountingCollectionDescription>(makeCollectionMetadata());
+    ShardFiltererImpl filterer{ScopedCollectionFilter(description)};
+
+    ASSERT(filterer.keyBelongsToMe(BSON("a" << 30)));
+    ASSERT_EQ(description->numLookups, 1);
+
+    // The last chunk contains the MaxKey even though it is the max of its range.
+    ASSERT(filterer.keyBelongsToMe(BSON("a" << MAXKEY)));
+    ASSERT(filterer.keyBelongsToMe(BSON("a" << 1000)));
+    ASSERT_EQ(description->numLookups, 1);
+
+    // Clones start without a cached range.
+    auto clone = filterer.clone();
+    ASSERT(clone->keyBelongsToMe(BSON("a" << 40)));
+    ASSERT_EQ(description->numLookups, 2);
+}
+
 TEST_F(ThreeChunkWithRangeGapFixture, GetNextChunkFromBeginning) {
     ChunkType nextChunk;
     ASSERT(makeCollectionMetadata().getNextChunk(makeCollectionMetadata().getMinKey(), &nextChunk));
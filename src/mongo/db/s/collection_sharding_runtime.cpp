@@ -159,7 +159,9 @@ CollectionShardingRuntime::CollectionShardingRuntime(ServiceContext* service, Na
     : _serviceContext(service),
       _nss(std::move(nss)),
       _metadataType(_nss.isNamespaceAlwaysUntracked() ? MetadataType::kUntracked
-                                                      : MetadataType::kUnknown) {}
+                                                      : MetadataType::kUnknown),
+      _metadataSnapshot(std::make_shared<const MetadataSnapshot>(
+          MetadataSnapshot{_metadataType, nullptr /* activeMetadata */})) {}
 
 CollectionShardingRuntime::~CollectionShardingRuntime() = default;
 
@@ -332,6 +334,7 @@ void CollectionShardingRuntime::setFilteringMetadata(OperationContext* opCtx,
         _metadataType = MetadataType::kUntracked;
         _metadataManager.reset();
         ++_numMetadataManagerChanges;
+        _publishMetadataSnapshot(lk);
         return;
     }
 
@@ -345,6 +348,8 @@ void CollectionShardingRuntime::setFilteringMetadata(OperationContext* opCtx,
     } else {
         _metadataManager->setFilteringMetadata(std::move(newMetadata));
     }
+
+    _publishMetadataSnapshot(lk);
 }
 
 void CollectionShardingRuntime::_clearFilteringMetadata(OperationContext* opCtx,
@@ -372,6 +377,8 @@ void CollectionShardingRuntime::_clearFilteringMetadata(OperationContext* opCtx,
     _metadataType = MetadataType::kUnknown;
     if (collIsDropped)
         _metadataManager.reset();
+
+    _publishMetadataSnapshot(lk);
 }
 
 void CollectionShardingRuntime::clearFilteringMetadata(OperationContext* opCtx) {
@@ -463,6 +470,21 @@ SharedSemiFuture<void> CollectionShardingRuntime::getOngoingQueriesCompletionFut
 std::shared_ptr<ScopedCollectionDescription::Impl>
 CollectionShardingRuntime::_getCurrentMetadataIfKnown(
     const boost::optional<LogicalTime>& atClusterTime, bool preserveRange) const {
+    // Only the latest metadata is published, and preserving its range requires registering with
+    // the metadata manager, so any other request must be served under the lock.
+    if (!atClusterTime && !preserveRange) {
+        const auto snapshot = std::atomic_load(&_metadataSnapshot);  // NOLINT
+        switch (snapshot->type) {
+            case MetadataType::kUnknown:
+                return nullptr;
+            case MetadataType::kUntracked:
+                return kUntrackedCollection;
+            case MetadataType::kTracked:
+                return snapshot->activeMetadata;
+        };
+        MONGO_UNREACHABLE;
+    }
+
     stdx::lock_guard lk(_metadataManagerLock);
     switch (_metadataType) {
         case MetadataType::kUnknown:
@@ -799,6 +821,15 @@ void CollectionShardingRuntime::_cleanupBeforeInstallingNewCollectionMetadata(
         .getAsync([](auto) {});
 }
 
+void CollectionShardingRuntime::_publishMetadataSnapshot(WithLock) {
+    auto activeMetadata = _metadataType == MetadataType::kTracked
+        ? _metadataManager->getActiveMetadata(boost::none, false /* preserveRange */)
+        : nullptr;
+    std::atomic_store(&_metadataSnapshot,  // NOLINT
+                      std::make_shared<const MetadataSnapshot>(
+                          MetadataSnapshot{_metadataType, std::move(activeMetadata)}));
+}
+
 void CollectionShardingRuntime::_checkCritSecForIndexMetadata(OperationContext* opCtx) const {
     if (repl::ReadConcernArgs::get(opCtx).getLevel() ==
         repl::ReadConcernLevel::kAvailableReadConcern)
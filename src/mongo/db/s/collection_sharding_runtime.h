@@ -357,6 +357,13 @@ private:
      */
     void _checkCritSecForIndexMetadata(OperationContext* opCtx) const;
 
+    /**
+     * Publishes the current state of the filtering metadata to the readers which don't take
+     * '_metadataManagerLock'. Must be called every time '_metadataType' or the active metadata of
+     * '_metadataManager' change.
+     */
+    void _publishMetadataSnapshot(WithLock);
+
     // The service context under which this instance runs
     ServiceContext* const _serviceContext;
 
@@ -398,6 +405,18 @@ private:
     // |_______________________|_________|___________|____________|
     std::shared_ptr<MetadataManager> _metadataManager;
 
+    // Immutable copy of '_metadataType' and of the active metadata, published under
+    // '_metadataManagerLock' every time either of them changes. Callers which need the latest
+    // metadata without preserving its range read it with a single atomic load instead of taking
+    // '_metadataManagerLock', which is contended when a shard serves many versioned operations.
+    struct MetadataSnapshot {
+        MetadataType type;
+
+        // Only set if the collection is tracked.
+        std::shared_ptr<ScopedCollectionDescription::Impl> activeMetadata;
+    };
+    std::shared_ptr<const MetadataSnapshot> _metadataSnapshot;
+
     // Used for testing to check the number of times a new MetadataManager has been installed.
     std::uint64_t _numMetadataManagerChanges{0};
 
@@ -210,6 +210,24 @@ TEST_F(CollectionShardingRuntimeTest,
     ASSERT_FALSE(csr.getCurrentMetadataIfKnown());
 }
 
+TEST_F(CollectionShardingRuntimeTest,
+       GetCurrentMetadataIfKnownReturnsLatestMetadataAfterSetFilteringMetadataWithSameUUID) {
+    CollectionShardingRuntime csr(getServiceContext(), kTestNss);
+    OperationContext* opCtx = operationContext();
+    const auto uuid = UUID::gen();
+    csr.setFilteringMetadata(opCtx, makeShardedMetadata(opCtx, uuid));
+
+    // The metadata manager is kept, so the new metadata must be published through it.
+    auto newMetadata = makeShardedMetadata(opCtx, uuid);
+    csr.setFilteringMetadata(opCtx, newMetadata);
+    ASSERT_EQ(csr.getNumMetadataManagerChanges_forTest(), 1);
+
+    const auto optCurrMetadata = csr.getCurrentMetadataIfKnown();
+    ASSERT_TRUE(optCurrMetadata);
+    ASSERT_EQ(optCurrMetadata->getShardPlacementVersion(),
+              newMetadata.getShardPlacementVersion());
+}
+
 TEST_F(CollectionShardingRuntimeTest, SetFilteringMetadataWithSameUUIDKeepsSameMetadataManager) {
     CollectionShardingRuntime csr(getServiceContext(), kTestNss);
     ASSERT_EQ(csr.getNumMetadataManagerChanges_forTest(), 0);
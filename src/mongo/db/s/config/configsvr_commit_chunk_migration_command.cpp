@@ -45,6 +45,7 @@
 #include "mongo/db/repl/read_concern_args.h"
 #include "mongo/db/repl/read_concern_level.h"
 #include "mongo/db/s/commit_chunk_migration_gen.h"
+#include "mongo/db/s/config/routing_table_change_notifier.h"
 #include "mongo/db/s/config/sharding_catalog_manager.h"
 #include "mongo/db/server_options.h"
 #include "mongo/db/service_context.h"
@@ -149,6 +150,8 @@ public:
                     request().getToShard());
 
             auto shardAndCollVers = uassertStatusOK(response);
+            RoutingTableChangeNotifier::get(opCtx)->onCollectionPlacementVersionCommitted(
+                opCtx, nss, shardAndCollVers.collectionPlacementVersion);
 
             return Response{shardAndCollVers.shardPlacementVersion};
         }
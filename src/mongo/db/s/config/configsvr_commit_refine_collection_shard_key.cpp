@@ -30,6 +30,7 @@
 #include "mongo/db/audit.h"
 #include "mongo/db/auth/authorization_session.h"
 #include "mongo/db/commands.h"
+#include "mongo/db/s/config/routing_table_change_notifier.h"
 #include "mongo/db/s/config/sharding_catalog_manager.h"
 #include "mongo/s/request_types/sharded_ddl_commands_gen.h"
 
@@ -74,6 +75,13 @@ public:
                 request().getNewTimestamp(),
                 request().getNewEpoch(),
                 request().getOldTimestamp());
+
+            // Refining the shard key gives all the chunks a new generation but keeps their major
+            // versions, which start at 1, so routers only need to know about the new generation.
+            RoutingTableChangeNotifier::get(opCtx)->onCollectionPlacementVersionCommitted(
+                opCtx,
+                ns(),
+                ChunkVersion({request().getNewEpoch(), request().getNewTimestamp()}, {1, 0}));
         }
 
     private:
@@ -0,0 +1,122 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <string>
+#include <utility>
+
+#include "mongo/base/error_codes.h"
+#include "mongo/db/auth/action_type.h"
+#include "mongo/db/auth/authorization_session.h"
+#include "mongo/db/auth/resource_pattern.h"
+#include "mongo/db/cluster_role.h"
+#include "mongo/db/commands.h"
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/s/config/routing_table_change_notifier.h"
+#include "mongo/db/server_options.h"
+#include "mongo/db/service_context.h"
+#include "mongo/s/request_types/routing_table_changes_gen.h"
+#include "mongo/s/sharding_feature_flags_gen.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/duration.h"
+
+namespace mongo {
+namespace {
+
+class ConfigsvrGetRoutingTableChangesCommand final
+    : public TypedCommand<ConfigsvrGetRoutingTableChangesCommand> {
+public:
+    using Request = ConfigsvrGetRoutingTableChanges;
+
+    class Invocation final : public InvocationBase {
+    public:
+        using InvocationBase::InvocationBase;
+
+        ConfigsvrGetRoutingTableChangesResponse typedRun(OperationContext* opCtx) {
+            uassert(ErrorCodes::CommandNotSupported,
+                    "_configsvrGetRoutingTableChanges command not enabled",
+                    feature_flags::gRoutingTableChangeNotifications.isEnabled(
+                        serverGlobalParams.featureCompatibility.acquireFCVSnapshot()));
+            uassert(ErrorCodes::IllegalOperation,
+                    "_configsvrGetRoutingTableChanges can only be run on config servers",
+                    serverGlobalParams.clusterRole.has(ClusterRole::ConfigServer));
+
+            const auto deadline = opCtx->getServiceContext()->getFastClockSource()->now() +
+                Milliseconds(request().getMaxAwaitTimeMS());
+
+            auto changes = RoutingTableChangeNotifier::get(opCtx)->waitForChanges(
+                opCtx, request().getHistoryId(), request().getAfterSequenceNumber(), deadline);
+
+            return ConfigsvrGetRoutingTableChangesResponse(changes.historyId,
+                                                           changes.sequenceNumber,
+                                                           changes.complete,
+                                                           std::move(changes.changes));
+        }
+
+    private:
+        NamespaceString ns() const override {
+            return NamespaceString(request().getDbName());
+        }
+
+        bool supportsWriteConcern() const override {
+            return false;
+        }
+
+        void doCheckAuthorization(OperationContext* opCtx) const override {
+            uassert(ErrorCodes::Unauthorized,
+                    "Unauthorized",
+                    AuthorizationSession::get(opCtx->getClient())
+                        ->isAuthorizedForActionsOnResource(
+                            ResourcePattern::forClusterResource(request().getDbName().tenantId()),
+                            ActionType::internal));
+        }
+    };
+
+    bool skipApiVersionCheck() const override {
+        // Internal command (server to server).
+        return true;
+    }
+
+    std::string help() const override {
+        return "Internal command, which is exported by the sharding config server. Do not call "
+               "directly. Waits for the routing table of any collection to change.";
+    }
+
+    bool adminOnly() const override {
+        return true;
+    }
+
+    AllowedOnSecondary secondaryAllowed(ServiceContext*) const override {
+        return AllowedOnSecondary::kNever;
+    }
+};
+MONGO_REGISTER_COMMAND(ConfigsvrGetRoutingTableChangesCommand).forShard();
+
+}  // namespace
+}  // namespace mongo
@@ -46,6 +46,7 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/db/repl/read_concern_args.h"
 #include "mongo/db/repl/read_concern_level.h"
+#include "mongo/db/s/config/routing_table_change_notifier.h"
 #include "mongo/db/s/config/sharding_catalog_manager.h"
 #include "mongo/db/server_options.h"
 #include "mongo/db/service_context.h"
@@ -103,6 +104,10 @@ public:
                     opCtx, ns(), request().getShard(), request().getMaxNumberOfChunksToMerge()));
 
             const auto& [shardAndCollVers, numMergedChunks] = response;
+            if (numMergedChunks > 0) {
+                RoutingTableChangeNotifier::get(opCtx)->onCollectionPlacementVersionCommitted(
+                    opCtx, ns(), shardAndCollVers.collectionPlacementVersion);
+            }
             return MergeAllChunksOnShardResponse{shardAndCollVers.shardPlacementVersion,
                                                  numMergedChunks};
         }
@@ -43,6 +43,7 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/db/repl/read_concern_args.h"
 #include "mongo/db/repl/read_concern_level.h"
+#include "mongo/db/s/config/routing_table_change_notifier.h"
 #include "mongo/db/s/config/sharding_catalog_manager.h"
 #include "mongo/db/server_options.h"
 #include "mongo/db/service_context.h"
@@ -113,6 +114,8 @@ public:
                                                                       request().getCollectionUUID(),
                                                                       request().getChunkRange(),
                                                                       request().getShard()));
+            RoutingTableChangeNotifier::get(opCtx)->onCollectionPlacementVersionCommitted(
+                opCtx, ns(), shardAndCollVers.collectionPlacementVersion);
             return ConfigSvrMergeResponse{shardAndCollVers.shardPlacementVersion};
         }
 
@@ -47,6 +47,7 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/db/repl/read_concern_args.h"
 #include "mongo/db/repl/read_concern_level.h"
+#include "mongo/db/s/config/routing_table_change_notifier.h"
 #include "mongo/db/s/config/sharding_catalog_manager.h"
 #include "mongo/db/s/split_chunk_request_type.h"
 #include "mongo/db/server_options.h"
@@ -146,6 +147,8 @@ public:
                                                                  parsedRequest.getChunkRange(),
                                                                  parsedRequest.getSplitPoints(),
                                                                  parsedRequest.getShardName()));
+        RoutingTableChangeNotifier::get(opCtx)->onCollectionPlacementVersionCommitted(
+            opCtx, parsedRequest.getNamespace(), shardAndCollVers.collectionPlacementVersion);
 
         shardAndCollVers.collectionPlacementVersion.serialize(kCollectionVersionField, &result);
         shardAndCollVers.shardPlacementVersion.serialize(ChunkVersion::kChunkVersionField, &result);
@@ -0,0 +1,153 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/s/config/routing_table_change_notifier.h"
+
+#include <utility>
+
+#include "mongo/base/status.h"
+#include "mongo/db/repl/optime.h"
+#include "mongo/db/repl/repl_client_info.h"
+#include "mongo/db/write_concern.h"
+#include "mongo/db/write_concern_options.h"
+#include "mongo/logv2/log.h"
+#include "mongo/logv2/redaction.h"
+#include "mongo/s/catalog/sharding_catalog_client.h"
+#include "mongo/stdx/unordered_map.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/decorable.h"
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kSharding
+
+namespace mongo {
+namespace {
+
+const auto routingTableChangeNotifierDecorator =
+    ServiceContext::declareDecoration<RoutingTableChangeNotifier>();
+
+}  // namespace
+
+const ReplicaSetAwareServiceRegistry::Registerer<RoutingTableChangeNotifier>
+    routingTableChangeNotifierRegistryRegisterer("RoutingTableChangeNotifier");
+
+RoutingTableChangeNotifier* RoutingTableChangeNotifier::get(ServiceContext* serviceContext) {
+    return &routingTableChangeNotifierDecorator(serviceContext);
+}
+
+RoutingTableChangeNotifier* RoutingTableChangeNotifier::get(OperationContext* opCtx) {
+    return get(opCtx->getServiceContext());
+}
+
+void RoutingTableChangeNotifier::onCollectionPlacementVersionChanged(const NamespaceString& nss,
+                                                                     const ChunkVersion& version) {
+    stdx::lock_guard lk(_mutex);
+    _history.push_back({++_lastSequenceNumber, nss, version});
+    if (_history.size() > kMaxHistorySize) {
+        _history.pop_front();
+    }
+    _changeRecordedCV.notify_all();
+}
+
+void RoutingTableChangeNotifier::onCollectionPlacementVersionCommitted(
+    OperationContext* opCtx, const NamespaceString& nss, const ChunkVersion& version) {
+    const auto clientOpTime = repl::ReplClientInfo::forClient(opCtx->getClient()).getLastOp();
+    const auto status = [&] {
+        try {
+            WriteConcernResult unusedWCResult;
+            return waitForWriteConcern(
+                opCtx, clientOpTime, ShardingCatalogClient::kMajorityWriteConcern, &unusedWCResult);
+        } catch (const DBException& ex) {
+            return ex.toStatus();
+        }
+    }();
+    if (!status.isOK()) {
+        LOGV2_DEBUG(9886610,
+                    1,
+                    "Not notifying routers of a routing table change which could not be confirmed "
+                    "as majority committed",
+                    logAttrs(nss),
+                    "version"_attr = version,
+                    "error"_attr = redact(status));
+        return;
+    }
+
+    onCollectionPlacementVersionChanged(nss, version);
+}
+
+RoutingTableChangeNotifier::Changes RoutingTableChangeNotifier::waitForChanges(
+    OperationContext* opCtx,
+    const boost::optional<OID>& historyId,
+    long long afterSequenceNumber,
+    Date_t deadline) {
+    stdx::unique_lock lk(_mutex);
+
+    if (historyId != _historyId || afterSequenceNumber > _lastSequenceNumber) {
+        return {_historyId, _lastSequenceNumber, false, {}};
+    }
+
+    opCtx->waitForConditionOrInterruptUntil(_changeRecordedCV, lk, deadline, [&] {
+        return _lastSequenceNumber > afterSequenceNumber || historyId != _historyId;
+    });
+
+    if (historyId != _historyId) {
+        return {_historyId, _lastSequenceNumber, false, {}};
+    }
+
+    // Changes are missing if the oldest one after 'afterSequenceNumber' was evicted.
+    const bool complete = afterSequenceNumber == _lastSequenceNumber ||
+        _history.front().sequenceNumber <= afterSequenceNumber + 1;
+
+    // Only report the latest version of each collection, which is all a router needs to know.
+    stdx::unordered_map<NamespaceString, ChunkVersion> latestVersions;
+    for (auto it = _history.rbegin(); it != _history.rend(); ++it) {
+        if (it->sequenceNumber <= afterSequenceNumber) {
+            break;
+        }
+        latestVersions.emplace(it->nss, it->version);
+    }
+
+    std::vector<GossipedRoutingCache> changes;
+    changes.reserve(latestVersions.size());
+    for (auto&& [nss, version] : latestVersions) {
+        changes.emplace_back(nss, version);
+    }
+
+    return {_historyId, _lastSequenceNumber, complete, std::move(changes)};
+}
+
+void RoutingTableChangeNotifier::onStepUpBegin(OperationContext* opCtx, long long term) {
+    // Changes committed while another node was primary were never recorded here.
+    stdx::lock_guard lk(_mutex);
+    _historyId = OID::gen();
+    _lastSequenceNumber = 0;
+    _history.clear();
+    _changeRecordedCV.notify_all();
+}
+
+}  // namespace mongo
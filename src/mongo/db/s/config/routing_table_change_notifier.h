@@ -0,0 +1,157 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <boost/optional/optional.hpp>
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "mongo/bson/oid.h"
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/repl/replica_set_aware_service.h"
+#include "mongo/db/service_context.h"
+#include "mongo/s/chunk_version.h"
+#include "mongo/s/gossiped_routing_cache_gen.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+
+/**
+ * Keeps a bounded, in-memory history of the routing table changes committed by this config server
+ * and lets routers wait for new ones, so that they can refresh their routing table cache before a
+ * shard rejects one of their requests as stale.
+ *
+ * The history is discarded whenever this node steps up, and is identified by an id which changes
+ * every time it is, so that routers can tell when they may have missed changes.
+ *
+ * Chunk migrations, splits and merges, shard key refinements and resharding commits are recorded.
+ * Dropping or renaming a collection is not, as it is committed by the shards' DDL coordinators
+ * rather than by a command of this config server.
+ */
+class RoutingTableChangeNotifier
+    : public ReplicaSetAwareServiceConfigSvr<RoutingTableChangeNotifier> {
+public:
+    static constexpr std::size_t kMaxHistorySize = 10 * 1000;
+
+    RoutingTableChangeNotifier() = default;
+
+    /**
+     * Obtains the service-wide instance.
+     */
+    static RoutingTableChangeNotifier* get(ServiceContext* serviceContext);
+    static RoutingTableChangeNotifier* get(OperationContext* opCtx);
+
+    /**
+     * Records that the collection placement version of 'nss' has been advanced to 'version' and
+     * wakes up any waiting routers.
+     */
+    void onCollectionPlacementVersionChanged(const NamespaceString& nss,
+                                             const ChunkVersion& version);
+
+    /**
+     * Waits for the writes done so far by 'opCtx', which advanced the collection placement version
+     * of 'nss' to 'version', to be majority committed and then records the change. Routers refresh
+     * from majority committed data, so they are not told about a change any earlier. If the wait
+     * fails, the change is not recorded and routers find out about it through the usual stale
+     * version checks instead. Never throws.
+     */
+    void onCollectionPlacementVersionCommitted(OperationContext* opCtx,
+                                               const NamespaceString& nss,
+                                               const ChunkVersion& version);
+
+    struct Changes {
+        OID historyId;
+        long long sequenceNumber;
+        bool complete;
+        std::vector<GossipedRoutingCache> changes;
+    };
+
+    /**
+     * Returns the latest version of each collection which changed after 'afterSequenceNumber' of
+     * the history identified by 'historyId', waiting until 'deadline' for a change to be recorded
+     * if there is none yet. Returns immediately, and with 'complete' set to false, if 'historyId'
+     * is not the current history.
+     */
+    Changes waitForChanges(OperationContext* opCtx,
+                           const boost::optional<OID>& historyId,
+                           long long afterSequenceNumber,
+                           Date_t deadline);
+
+private:
+    RoutingTableChangeNotifier(const RoutingTableChangeNotifier&) = delete;
+    RoutingTableChangeNotifier& operator=(const RoutingTableChangeNotifier&) = delete;
+
+    /**
+     * ReplicaSetAwareService entry points.
+     */
+    void onStartup(OperationContext* opCtx) final {}
+
+    void onSetCurrentConfig(OperationContext* opCtx) final {}
+
+    void onConsistentDataAvailable(OperationContext* opCtx,
+                                   bool isMajority,
+                                   bool isRollback) final {}
+
+    void onStepUpBegin(OperationContext* opCtx, long long term) final;
+
+    void onStepUpComplete(OperationContext* opCtx, long long term) final {}
+
+    void onStepDown() final {}
+
+    void onRollbackBegin() final {}
+
+    void onShutdown() final {}
+
+    void onBecomeArbiter() final {}
+
+    inline std::string getServiceName() const final {
+        return "RoutingTableChangeNotifier";
+    }
+
+    struct Change {
+        long long sequenceNumber;
+        NamespaceString nss;
+        ChunkVersion version;
+    };
+
+    stdx::mutex _mutex;
+    stdx::condition_variable _changeRecordedCV;
+
+    OID _historyId{OID::gen()};
+    long long _lastSequenceNumber{0};
+    std::deque<Change> _history;
+};
+
+}  // namespace mongo
@@ -0,0 +1,117 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <boost/none.hpp>
+#include <boost/optional/optional.hpp>
+
+#include "mongo/bson/oid.h"
+#include "mongo/bson/timestamp.h"
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/s/config/config_server_test_fixture.h"
+#include "mongo/db/s/config/routing_table_change_notifier.h"
+#include "mongo/s/chunk_version.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/framework.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+namespace {
+
+class RoutingTableChangeNotifierTest : public ConfigServerTestFixture {
+protected:
+    RoutingTableChangeNotifier* notifier() {
+        return RoutingTableChangeNotifier::get(operationContext());
+    }
+
+    RoutingTableChangeNotifier::Changes waitForChanges(const boost::optional<OID>& historyId,
+                                                       long long afterSequenceNumber) {
+        return notifier()->waitForChanges(
+            operationContext(), historyId, afterSequenceNumber, Date_t::now());
+    }
+
+    const NamespaceString kNss1 = NamespaceString::createNamespaceString_forTest("db.coll1");
+    const NamespaceString kNss2 = NamespaceString::createNamespaceString_forTest("db.coll2");
+    const CollectionGeneration kCollGen{OID::gen(), Timestamp(1, 1)};
+};
+
+TEST_F(RoutingTableChangeNotifierTest, UnknownHistoryIsReportedAsIncomplete) {
+    notifier()->onCollectionPlacementVersionChanged(kNss1, ChunkVersion(kCollGen, {1, 0}));
+
+    const auto changes = waitForChanges(boost::none, 0);
+    ASSERT_FALSE(changes.complete);
+    ASSERT_EQ(1, changes.sequenceNumber);
+    ASSERT(changes.changes.empty());
+
+    const auto otherHistory = waitForChanges(OID::gen(), 0);
+    ASSERT_FALSE(otherHistory.complete);
+    ASSERT_EQ(changes.historyId, otherHistory.historyId);
+}
+
+TEST_F(RoutingTableChangeNotifierTest, ReportsLatestVersionOfEachCollection) {
+    const auto start = waitForChanges(boost::none, 0);
+
+    notifier()->onCollectionPlacementVersionChanged(kNss1, ChunkVersion(kCollGen, {1, 0}));
+    notifier()->onCollectionPlacementVersionChanged(kNss2, ChunkVersion(kCollGen, {1, 0}));
+    notifier()->onCollectionPlacementVersionChanged(kNss1, ChunkVersion(kCollGen, {2, 0}));
+
+    const auto changes = waitForChanges(start.historyId, start.sequenceNumber);
+    ASSERT(changes.complete);
+    ASSERT_EQ(start.sequenceNumber + 3, changes.sequenceNumber);
+    ASSERT_EQ(2, changes.changes.size());
+    for (const auto& change : changes.changes) {
+        ASSERT_EQ(change.getNss() == kNss1 ? ChunkVersion(kCollGen, {2, 0})
+                                           : ChunkVersion(kCollGen, {1, 0}),
+                  change.getCollectionVersion());
+    }
+
+    const auto noChanges = waitForChanges(changes.historyId, changes.sequenceNumber);
+    ASSERT(noChanges.complete);
+    ASSERT_EQ(changes.sequenceNumber, noChanges.sequenceNumber);
+    ASSERT(noChanges.changes.empty());
+}
+
+TEST_F(RoutingTableChangeNotifierTest, EvictedChangesAreReportedAsIncomplete) {
+    const auto start = waitForChanges(boost::none, 0);
+
+    for (std::size_t i = 0; i <= RoutingTableChangeNotifier::kMaxHistorySize; ++i) {
+        notifier()->onCollectionPlacementVersionChanged(
+            kNss1, ChunkVersion(kCollGen, {static_cast<uint32_t>(i + 1), 0}));
+    }
+
+    const auto changes = waitForChanges(start.historyId, start.sequenceNumber);
+    ASSERT_FALSE(changes.complete);
+    ASSERT_EQ(1, changes.changes.size());
+
+    const auto recentChanges = waitForChanges(start.historyId, start.sequenceNumber + 1);
+    ASSERT(recentChanges.complete);
+    ASSERT_EQ(1, recentChanges.changes.size());
+}
+
+}  // namespace
+}  // namespace mongo
@@ -0,0 +1,186 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/s/range_access_sampler.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "mongo/db/s/sharding_runtime_d_params_gen.h"
+#include "mongo/util/decorable.h"
+
+namespace mongo {
+namespace {
+
+const auto rangeAccessSamplerDecorator = ServiceContext::declareDecoration<RangeAccessSampler>();
+
+/**
+ * Returns the median of the given shard key values, provided that it can be used to split the
+ * given range, i.e. it lies strictly inside it.
+ */
+boost::optional<BSONObj> estimateMedianKey(const ChunkRange& range, std::vector<BSONObj> keys) {
+    if (keys.empty()) {
+        return boost::none;
+    }
+
+    std::sort(keys.begin(), keys.end(), SimpleBSONObjComparator::LessThan());
+    const auto& median = keys[keys.size() / 2];
+    if (SimpleBSONObjComparator::kInstance.evaluate(median == range.getMin())) {
+        return boost::none;
+    }
+    return median;
+}
+
+}  // namespace
+
+RangeAccessSampler* RangeAccessSampler::get(ServiceContext* serviceContext) {
+    return &rangeAccessSamplerDecorator(serviceContext);
+}
+
+RangeAccessSampler* RangeAccessSampler::get(OperationContext* opCtx) {
+    return get(opCtx->getServiceContext());
+}
+
+bool RangeAccessSampler::shouldSample() {
+    const auto samplingInterval = rangeAccessSamplingInterval.loadRelaxed();
+    if (samplingInterval <= 0) {
+        return false;
+    }
+
+    thread_local int accessesUntilNextSample = 0;
+    if (--accessesUntilNextSample > 0) {
+        return false;
+    }
+    accessesUntilNextSample = samplingInterval;
+    return true;
+}
+
+void RangeAccessSampler::recordAccess(const UUID& collectionUuid,
+                                      const ChunkRange& range,
+                                      const BSONObj& shardKey,
+                                      Date_t now) {
+    // Each sampled access stands for all the accesses skipped since the previous sample
+    const double weight = std::max(rangeAccessSamplingInterval.loadRelaxed(), 1);
+
+    stdx::lock_guard lk(_mutex);
+    auto& stats = _collections[collectionUuid];
+    _rotateWindowsIfNeeded(lk, stats, now);
+
+    auto& window = stats.currentWindow;
+    window.numAccesses += weight;
+
+    auto it = window.ranges.find(range.getMin());
+    if (it == window.ranges.end()) {
+        if (window.ranges.size() >= kMaxRangesPerCollection) {
+            return;
+        }
+        it = window.ranges.emplace(range.getMin().getOwned(), RangeStats()).first;
+        it->second.max = range.getMax().getOwned();
+    } else if (SimpleBSONObjComparator::kInstance.evaluate(it->second.max != range.getMax())) {
+        // The range was split or merged since its first access in this window
+        it->second = RangeStats();
+        it->second.max = range.getMax().getOwned();
+    }
+
+    auto& rangeStats = it->second;
+    rangeStats.numAccesses += weight;
+
+    // Reservoir sampling, so that every sampled key has the same chance to be retained
+    ++rangeStats.numSampledKeys;
+    if (rangeStats.sampledKeys.size() < kMaxSampledKeysPerRange) {
+        rangeStats.sampledKeys.push_back(shardKey.getOwned());
+    } else if (const auto idx = _random.nextInt64(rangeStats.numSampledKeys);
+               idx < static_cast<long long>(kMaxSampledKeysPerRange)) {
+        rangeStats.sampledKeys[idx] = shardKey.getOwned();
+    }
+}
+
+RangeAccessSampler::CollectionLoad RangeAccessSampler::getCollectionLoad(
+    const UUID& collectionUuid, size_t maxRanges, Date_t now) {
+    stdx::lock_guard lk(_mutex);
+    auto collIt = _collections.find(collectionUuid);
+    if (collIt == _collections.end()) {
+        return {};
+    }
+
+    auto& stats = collIt->second;
+    _rotateWindowsIfNeeded(lk, stats, now);
+    if (stats.lastWindow.numAccesses == 0 && stats.currentWindow.numAccesses == 0) {
+        // The collection has not been accessed for a whole window, so stop tracking it
+        _collections.erase(collIt);
+        return {};
+    }
+
+    const auto& window = stats.lastWindow;
+    const double windowLengthSecs = durationCount<Seconds>(kWindowLength);
+
+    std::vector<SimpleBSONObjMap<RangeStats>::const_iterator> rangeIts;
+    rangeIts.reserve(window.ranges.size());
+    for (auto it = window.ranges.begin(); it != window.ranges.end(); ++it) {
+        rangeIts.push_back(it);
+    }
+
+    const auto numRanges = std::min(maxRanges, rangeIts.size());
+    std::partial_sort(rangeIts.begin(),
+                      rangeIts.begin() + numRanges,
+                      rangeIts.end(),
+                      [](const auto& lhs, const auto& rhs) {
+                          return lhs->second.numAccesses > rhs->second.numAccesses;
+                      });
+
+    CollectionLoad load;
+    load.opsPerSec = window.numAccesses / windowLengthSecs;
+    load.hottestRanges.reserve(numRanges);
+    for (size_t i = 0; i < numRanges; ++i) {
+        const auto& [min, rangeStats] = *rangeIts[i];
+        ChunkRange range(min, rangeStats.max);
+        auto medianKey = estimateMedianKey(range, rangeStats.sampledKeys);
+        load.hottestRanges.push_back(
+            {std::move(range), rangeStats.numAccesses / windowLengthSecs, std::move(medianKey)});
+    }
+    return load;
+}
+
+void RangeAccessSampler::_rotateWindowsIfNeeded(WithLock, CollectionStats& stats, Date_t now) {
+    if (now - stats.currentWindowStart < kWindowLength) {
+        return;
+    }
+
+    if (now - stats.currentWindowStart < kWindowLength * 2) {
+        stats.lastWindow = std::move(stats.currentWindow);
+        stats.currentWindowStart += kWindowLength;
+    } else {
+        // Nothing was accessed during the window which just ended
+        stats.lastWindow = WindowStats();
+        stats.currentWindowStart = now;
+    }
+    stats.currentWindow = WindowStats();
+}
+
+}  // namespace mongo
@@ -0,0 +1,147 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <boost/optional/optional.hpp>
+#include <cstddef>
+#include <vector>
+
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/simple_bsonobj_comparator.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/service_context.h"
+#include "mongo/platform/random.h"
+#include "mongo/s/catalog/type_chunk.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/stdx/unordered_map.h"
+#include "mongo/util/concurrency/with_lock.h"
+#include "mongo/util/time_support.h"
+#include "mongo/util/uuid.h"
+
+namespace mongo {
+
+/**
+ * Keeps track of how frequently the ranges owned by this shard are accessed, so that the balancer
+ * can detect hot ranges and move them away from overloaded shards. Reads are sampled by the shard
+ * filterer and writes by the ShardServerOpObserver, one out of every
+ * 'rangeAccessSamplingInterval' accesses per thread. The balancer retrieves the sampled load
+ * through the _shardsvrGetStatsForBalancing command.
+ *
+ * Accesses are accumulated into fixed-length windows and the load of a range is estimated from the
+ * last complete window, so that the reported rates do not depend on when the balancer asks.
+ */
+class RangeAccessSampler {
+    RangeAccessSampler(const RangeAccessSampler&) = delete;
+    RangeAccessSampler& operator=(const RangeAccessSampler&) = delete;
+
+public:
+    // Length of the windows the sampled accesses are accumulated into
+    static constexpr Seconds kWindowLength{60};
+
+    // Maximum number of ranges tracked per collection. Accesses to ranges beyond this limit are
+    // dropped until the next window starts.
+    static constexpr size_t kMaxRangesPerCollection{1000};
+
+    // Maximum number of shard key values retained per range to estimate its median key
+    static constexpr size_t kMaxSampledKeysPerRange{16};
+
+    struct RangeLoad {
+        ChunkRange range;
+        double opsPerSec;
+        // Shard key value which splits the sampled accesses to the range in two halves, if one
+        // could be estimated
+        boost::optional<BSONObj> medianKey;
+    };
+
+    struct CollectionLoad {
+        double opsPerSec{0};
+        // Sorted by descending load
+        std::vector<RangeLoad> hottestRanges;
+    };
+
+    RangeAccessSampler() = default;
+
+    static RangeAccessSampler* get(ServiceContext* serviceContext);
+    static RangeAccessSampler* get(OperationContext* opCtx);
+
+    /**
+     * Returns true if the calling thread should sample its current access. This only touches a
+     * thread-local counter, so it is cheap enough to be called on every document access.
+     */
+    static bool shouldSample();
+
+    /**
+     * Records a sampled access to the document with the given shard key, which belongs to the
+     * given range owned by this shard.
+     */
+    void recordAccess(const UUID& collectionUuid,
+                      const ChunkRange& range,
+                      const BSONObj& shardKey,
+                      Date_t now);
+
+    /**
+     * Returns the estimated load on the collection over the last complete window, along with its
+     * 'maxRanges' hottest ranges.
+     */
+    CollectionLoad getCollectionLoad(const UUID& collectionUuid, size_t maxRanges, Date_t now);
+
+private:
+    struct RangeStats {
+        BSONObj max;
+        // Estimated number of accesses, i.e. the number of sampled accesses each weighted by the
+        // sampling interval in effect when it was sampled
+        double numAccesses{0};
+        long long numSampledKeys{0};
+        std::vector<BSONObj> sampledKeys;
+    };
+
+    struct WindowStats {
+        double numAccesses{0};
+        // Keyed by the min of the range
+        SimpleBSONObjMap<RangeStats> ranges;
+    };
+
+    struct CollectionStats {
+        Date_t currentWindowStart;
+        WindowStats currentWindow;
+        WindowStats lastWindow;
+    };
+
+    void _rotateWindowsIfNeeded(WithLock, CollectionStats& stats, Date_t now);
+
+    stdx::mutex _mutex;
+
+    stdx::unordered_map<UUID, CollectionStats, UUID::Hash> _collections;
+
+    // Used to pick which sampled keys are retained once a range's reservoir is full
+    PseudoRandom _random{SecureRandom().nextInt64()};
+};
+
+}  // namespace mongo
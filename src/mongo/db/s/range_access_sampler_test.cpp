@@ -0,0 +1,166 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/s/range_access_sampler.h"
+
+#include "mongo/bson/bsonmisc.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/idl/server_parameter_test_util.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/bson_test_util.h"
+#include "mongo/unittest/framework.h"
+
+namespace mongo {
+namespace {
+
+const auto kWindowLength = RangeAccessSampler::kWindowLength;
+const Date_t kStart = Date_t::fromMillisSinceEpoch(1000 * 1000);
+
+const ChunkRange kRangeA{BSON("x" << 0), BSON("x" << 100)};
+const ChunkRange kRangeB{BSON("x" << 100), BSON("x" << 200)};
+
+void recordAccesses(RangeAccessSampler& sampler,
+                    const UUID& uuid,
+                    const ChunkRange& range,
+                    int numAccesses,
+                    Date_t now) {
+    const auto minValue = range.getMin()["x"].numberInt();
+    for (int i = 0; i < numAccesses; i++) {
+        sampler.recordAccess(uuid, range, BSON("x" << minValue + i % 10), now);
+    }
+}
+
+TEST(RangeAccessSampler, ShouldSampleOnceEveryInterval) {
+    RAIIServerParameterControllerForTest samplingInterval("rangeAccessSamplingInterval", 4);
+
+    int numSampled = 0;
+    for (int i = 0; i < 8; i++) {
+        numSampled += RangeAccessSampler::shouldSample();
+    }
+    ASSERT_EQ(2, numSampled);
+}
+
+TEST(RangeAccessSampler, ShouldNotSampleIfDisabled) {
+    RAIIServerParameterControllerForTest samplingInterval("rangeAccessSamplingInterval", 0);
+
+    for (int i = 0; i < 8; i++) {
+        ASSERT_FALSE(RangeAccessSampler::shouldSample());
+    }
+}
+
+TEST(RangeAccessSampler, ReportsLoadOfLastCompleteWindow) {
+    RangeAccessSampler sampler;
+    const auto uuid = UUID::gen();
+
+    recordAccesses(sampler, uuid, kRangeA, 120, kStart);
+    recordAccesses(sampler, uuid, kRangeB, 60, kStart + Seconds(1));
+
+    // The first window is not complete yet
+    auto load = sampler.getCollectionLoad(uuid, 10, kStart + Seconds(2));
+    ASSERT_EQ(0, load.opsPerSec);
+    ASSERT(load.hottestRanges.empty());
+
+    load = sampler.getCollectionLoad(uuid, 10, kStart + kWindowLength);
+    ASSERT_EQ(3, load.opsPerSec);
+    ASSERT_EQ(2U, load.hottestRanges.size());
+    ASSERT_BSONOBJ_EQ(kRangeA.getMin(), load.hottestRanges[0].range.getMin());
+    ASSERT_EQ(2, load.hottestRanges[0].opsPerSec);
+    ASSERT_BSONOBJ_EQ(kRangeB.getMin(), load.hottestRanges[1].range.getMin());
+    ASSERT_EQ(1, load.hottestRanges[1].opsPerSec);
+}
+
+TEST(RangeAccessSampler, ReturnsAtMostTheRequestedNumberOfRanges) {
+    RangeAccessSampler sampler;
+    const auto uuid = UUID::gen();
+
+    recordAccesses(sampler, uuid, kRangeA, 10, kStart);
+    recordAccesses(sampler, uuid, kRangeB, 20, kStart);
+
+    const auto load = sampler.getCollectionLoad(uuid, 1, kStart + kWindowLength);
+    ASSERT_EQ(1U, load.hottestRanges.size());
+    ASSERT_BSONOBJ_EQ(kRangeB.getMin(), load.hottestRanges[0].range.getMin());
+}
+
+TEST(RangeAccessSampler, EstimatesMedianKey) {
+    RangeAccessSampler sampler;
+    const auto uuid = UUID::gen();
+
+    for (int i = 10; i < 20; i++) {
+        sampler.recordAccess(uuid, kRangeA, BSON("x" << i), kStart);
+    }
+
+    const auto load = sampler.getCollectionLoad(uuid, 10, kStart + kWindowLength);
+    ASSERT_EQ(1U, load.hottestRanges.size());
+    ASSERT(load.hottestRanges[0].medianKey);
+    ASSERT_BSONOBJ_EQ(BSON("x" << 15), *load.hottestRanges[0].medianKey);
+}
+
+TEST(RangeAccessSampler, NoMedianKeyIfItIsTheMinOfTheRange) {
+    RangeAccessSampler sampler;
+    const auto uuid = UUID::gen();
+
+    for (int i = 0; i < 10; i++) {
+        sampler.recordAccess(uuid, kRangeA, kRangeA.getMin(), kStart);
+    }
+
+    const auto load = sampler.getCollectionLoad(uuid, 10, kStart + kWindowLength);
+    ASSERT_EQ(1U, load.hottestRanges.size());
+    ASSERT_FALSE(load.hottestRanges[0].medianKey);
+}
+
+TEST(RangeAccessSampler, ResetsRangeWhoseBoundsChanged) {
+    RangeAccessSampler sampler;
+    const auto uuid = UUID::gen();
+
+    const ChunkRange splitRangeA{kRangeA.getMin(), BSON("x" << 50)};
+    recordAccesses(sampler, uuid, kRangeA, 60, kStart);
+    recordAccesses(sampler, uuid, splitRangeA, 120, kStart + Seconds(1));
+
+    const auto load = sampler.getCollectionLoad(uuid, 10, kStart + kWindowLength);
+    ASSERT_EQ(3, load.opsPerSec);
+    ASSERT_EQ(1U, load.hottestRanges.size());
+    ASSERT_BSONOBJ_EQ(splitRangeA.getMax(), load.hottestRanges[0].range.getMax());
+    ASSERT_EQ(2, load.hottestRanges[0].opsPerSec);
+}
+
+TEST(RangeAccessSampler, ForgetsIdleCollections) {
+    RangeAccessSampler sampler;
+    const auto uuid = UUID::gen();
+
+    recordAccesses(sampler, uuid, kRangeA, 60, kStart);
+
+    ASSERT_EQ(1, sampler.getCollectionLoad(uuid, 10, kStart + kWindowLength).opsPerSec);
+
+    const auto load = sampler.getCollectionLoad(uuid, 10, kStart + kWindowLength * 3);
+    ASSERT_EQ(0, load.opsPerSec);
+    ASSERT(load.hottestRanges.empty());
+}
+
+}  // namespace
+}  // namespace mongo
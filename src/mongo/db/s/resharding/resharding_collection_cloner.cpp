@@ -29,6 +29,7 @@
 
 
 #include <absl/container/node_hash_map.h>
+#include <algorithm>
 #include <boost/move/utility_core.hpp>
 #include <boost/none.hpp>
 #include <boost/optional/optional.hpp>
@@ -326,7 +327,9 @@ public:
           _cancelSource(cancelToken),
           _factory(_cancelSource.token(), _executor),
           _remoteCursors(std::move(remoteCursors)),
-          _numWriteThreads(numWriteThreads),
+          // Batches from one donor are always written by the same thread, so threads beyond one
+          // per donor would never receive any work.
+          _numWriteThreads(std::min(numWriteThreads, int(_remoteCursors.size()))),
           _queues(_numWriteThreads),
           _activeCursors(0),
           _openConsumers(0) {
@@ -73,6 +73,7 @@
 #include "mongo/db/s/balancer/balance_stats.h"
 #include "mongo/db/s/balancer/balancer_policy.h"
 #include "mongo/db/s/config/initial_split_policy.h"
+#include "mongo/db/s/config/routing_table_change_notifier.h"
 #include "mongo/db/s/config/sharding_catalog_manager.h"
 #include "mongo/db/s/resharding/recipient_document_gen.h"
 #include "mongo/db/s/resharding/resharding_coordinator_commit_monitor.h"
@@ -2558,6 +2559,10 @@ void ReshardingCoordinator::_commit(const ReshardingCoordinatorDocument& coordin
         return collectionPlacementAsVector;
     }();
 
+    // The resharded collection's chunks are created with major versions starting at 1.
+    const ChunkVersion reshardedCollectionVersion({newCollectionEpoch, newCollectionTimestamp},
+                                                  {1, 0});
+
     resharding::writeDecisionPersistedState(opCtx.get(),
                                             _metrics.get(),
                                             updatedCoordinatorDoc,
@@ -2565,6 +2570,9 @@ void ReshardingCoordinator::_commit(const ReshardingCoordinatorDocument& coordin
                                             std::move(newCollectionTimestamp),
                                             std::move(indexVersion),
                                             reshardedCollectionPlacement);
+    RoutingTableChangeNotifier::get(opCtx.get())
+        ->onCollectionPlacementVersionCommitted(
+            opCtx.get(), coordinatorDoc.getSourceNss(), reshardedCollectionVersion);
 
     // Update the in memory state
     installCoordinatorDoc(opCtx.get(), updatedCoordinatorDoc);
@@ -30,6 +30,7 @@
 
 #include "mongo/util/duration.h"
 #include <absl/container/node_hash_map.h>
+#include <algorithm>
 #include <boost/cstdint.hpp>
 #include <boost/move/utility_core.hpp>
 #include <boost/none.hpp>
@@ -268,6 +269,7 @@ BSONObj ReshardingMetrics::reportForCurrentOp() const noexcept {
                 builder.append(_reshardingFieldNames->getForIndexesToBuild(),
                                _indexesToBuild.load());
                 builder.append(_reshardingFieldNames->getForIndexesBuilt(), _indexesBuilt.load());
+                reportThroughput(&builder);
                 break;
             default:
                 break;
@@ -399,4 +401,49 @@ void ReshardingMetrics::setIndexesBuilt(int64_t numIndexes) {
     _indexesBuilt.store(numIndexes);
 }
 
+boost::optional<ReshardingMetrics::CloneThroughput> ReshardingMetrics::getCloneThroughput() const {
+    auto elapsed = getElapsed<Milliseconds>(TimedPhase::kCloning, getClockSource());
+    if (!elapsed) {
+        return boost::none;
+    }
+    // Round a sub-millisecond cloning phase up rather than dividing by zero.
+    auto elapsedMillis = std::max(durationCount<Milliseconds>(*elapsed), int64_t{1});
+    return CloneThroughput{getDocumentsProcessedCount() * 1000 / elapsedMillis,
+                           getBytesWrittenCount() * 1000 / elapsedMillis};
+}
+
+boost::optional<int64_t> ReshardingMetrics::getOplogApplicationRatePerSec() const {
+    auto elapsed = getElapsed<Milliseconds>(TimedPhase::kApplying, getClockSource());
+    if (!elapsed) {
+        return boost::none;
+    }
+    auto elapsedMillis = std::max(durationCount<Milliseconds>(*elapsed), int64_t{1});
+    return getOplogEntriesApplied() * 1000 / elapsedMillis;
+}
+
+boost::optional<Seconds> ReshardingMetrics::getOplogCatchUpTimeEstimate() const {
+    auto rate = getOplogApplicationRatePerSec();
+    if (!rate || *rate == 0) {
+        return boost::none;
+    }
+    auto backlog = std::max(getOplogEntriesFetched() - getOplogEntriesApplied(), int64_t{0});
+    return Seconds{backlog / *rate};
+}
+
+void ReshardingMetrics::reportThroughput(BSONObjBuilder* builder) const {
+    if (auto throughput = getCloneThroughput()) {
+        builder->append(_reshardingFieldNames->getForDocumentsCopiedPerSec(),
+                        throughput->documentsPerSec);
+        builder->append(_reshardingFieldNames->getForBytesCopiedPerSec(),
+                        throughput->bytesPerSec);
+    }
+    if (auto rate = getOplogApplicationRatePerSec()) {
+        builder->append(_reshardingFieldNames->getForOplogEntriesAppliedPerSec(), *rate);
+    }
+    if (auto catchUpTime = getOplogCatchUpTimeEstimate()) {
+        builder->append(_reshardingFieldNames->getForOplogCatchUpTimeEstimated(),
+                        durationCount<Seconds>(*catchUpTime));
+    }
+}
+
 }  // namespace mongo
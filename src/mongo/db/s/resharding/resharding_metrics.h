@@ -215,6 +215,30 @@ public:
     void setIndexesToBuild(int64_t numIndexes);
     void setIndexesBuilt(int64_t numIndexes);
 
+    struct CloneThroughput {
+        int64_t documentsPerSec;
+        int64_t bytesPerSec;
+    };
+
+    /**
+     * Returns the rate at which this recipient has copied documents over the cloning phase so far,
+     * or boost::none if cloning has not started.
+     */
+    boost::optional<CloneThroughput> getCloneThroughput() const;
+
+    /**
+     * Returns the rate at which this recipient has applied oplog entries over the applying phase so
+     * far, or boost::none if applying has not started.
+     */
+    boost::optional<int64_t> getOplogApplicationRatePerSec() const;
+
+    /**
+     * Returns how long applying the oplog entries fetched but not yet applied would take at the
+     * current application rate. This bounds how long the critical section would need to wait for
+     * this recipient to catch up if it started now.
+     */
+    boost::optional<Seconds> getOplogCatchUpTimeEstimate() const;
+
 protected:
     boost::optional<Milliseconds> getRecipientHighEstimateRemainingTimeMillis() const override;
     StringData getStateString() const noexcept override;
@@ -224,6 +248,7 @@ private:
     void restoreRecipientSpecificFields(const ReshardingRecipientDocument& document);
     void restoreCoordinatorSpecificFields(const ReshardingCoordinatorDocument& document);
     void restoreIndexBuildDurationFields(const ReshardingRecipientMetrics& metrics);
+    void reportThroughput(BSONObjBuilder* builder) const;
     ReshardingCumulativeMetrics* getReshardingCumulativeMetrics();
 
     template <typename T>
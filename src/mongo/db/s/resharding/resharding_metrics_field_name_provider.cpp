@@ -35,6 +35,10 @@ constexpr auto kIsSameKeyResharding = "isSameKeyResharding";
 constexpr auto kIndexesToBuild = "indexesToBuild";
 constexpr auto kIndexesBuilt = "indexesBuilt";
 constexpr auto kIndexBuildTimeElapsed = "indexBuildTimeElapsedSecs";
+constexpr auto kDocumentsCopiedPerSec = "documentsCopiedPerSec";
+constexpr auto kBytesCopiedPerSec = "bytesCopiedPerSec";
+constexpr auto kOplogEntriesAppliedPerSec = "oplogEntriesAppliedPerSec";
+constexpr auto kOplogCatchUpTimeEstimated = "oplogCatchUpTimeEstimatedSecs";
 }  // namespace
 
 StringData ReshardingMetricsFieldNameProvider::getForIsSameKeyResharding() const {
@@ -49,4 +53,16 @@ StringData ReshardingMetricsFieldNameProvider::getForIndexesBuilt() const {
 StringData ReshardingMetricsFieldNameProvider::getForIndexBuildTimeElapsed() const {
     return kIndexBuildTimeElapsed;
 }
+StringData ReshardingMetricsFieldNameProvider::getForDocumentsCopiedPerSec() const {
+    return kDocumentsCopiedPerSec;
+}
+StringData ReshardingMetricsFieldNameProvider::getForBytesCopiedPerSec() const {
+    return kBytesCopiedPerSec;
+}
+StringData ReshardingMetricsFieldNameProvider::getForOplogEntriesAppliedPerSec() const {
+    return kOplogEntriesAppliedPerSec;
+}
+StringData ReshardingMetricsFieldNameProvider::getForOplogCatchUpTimeEstimated() const {
+    return kOplogCatchUpTimeEstimated;
+}
 }  // namespace mongo
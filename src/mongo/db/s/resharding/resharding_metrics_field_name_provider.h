@@ -45,6 +45,10 @@ public:
     StringData getForIndexesToBuild() const;
     StringData getForIndexesBuilt() const;
     StringData getForIndexBuildTimeElapsed() const;
+    StringData getForDocumentsCopiedPerSec() const;
+    StringData getForBytesCopiedPerSec() const;
+    StringData getForOplogEntriesAppliedPerSec() const;
+    StringData getForOplogCatchUpTimeEstimated() const;
 };
 
 }  // namespace mongo
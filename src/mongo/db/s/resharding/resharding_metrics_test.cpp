@@ -791,6 +791,58 @@ TEST_F(ReshardingMetricsTest, onIndexBuild) {
     ASSERT_EQ(report.getIntField("indexesBuilt"), 1);
 }
 
+TEST_F(ReshardingMetricsTest, RecipientReportsCloneThroughput) {
+    RAIIServerParameterControllerForTest controller("featureFlagReshardingImprovements", true);
+    auto metrics = createInstanceMetrics(getClockSource(), UUID::gen(), Role::kRecipient);
+    const auto& clock = getClockSource();
+
+    auto report = metrics->reportForCurrentOp();
+    ASSERT_FALSE(report.hasField("documentsCopiedPerSec"));
+    ASSERT_FALSE(report.hasField("bytesCopiedPerSec"));
+
+    metrics->setStartFor(TimedPhase::kCloning, clock->now());
+    metrics->onDocumentsProcessed(100, 5000, Milliseconds(1));
+    clock->advance(Seconds(4));
+    metrics->onDocumentsProcessed(300, 15000, Milliseconds(1));
+
+    report = metrics->reportForCurrentOp();
+    ASSERT_EQ(report.getIntField("documentsCopiedPerSec"), 100);
+    ASSERT_EQ(report.getIntField("bytesCopiedPerSec"), 5000);
+
+    // The rate stops decaying once cloning is done.
+    metrics->setEndFor(TimedPhase::kCloning, clock->now());
+    clock->advance(Seconds(4));
+    report = metrics->reportForCurrentOp();
+    ASSERT_EQ(report.getIntField("documentsCopiedPerSec"), 100);
+    ASSERT_EQ(report.getIntField("bytesCopiedPerSec"), 5000);
+}
+
+TEST_F(ReshardingMetricsTest, RecipientReportsOplogCatchUpRate) {
+    RAIIServerParameterControllerForTest controller("featureFlagReshardingImprovements", true);
+    auto metrics = createInstanceMetrics(getClockSource(), UUID::gen(), Role::kRecipient);
+    const auto& clock = getClockSource();
+
+    auto report = metrics->reportForCurrentOp();
+    ASSERT_FALSE(report.hasField("oplogEntriesAppliedPerSec"));
+    ASSERT_FALSE(report.hasField("oplogCatchUpTimeEstimatedSecs"));
+
+    metrics->setStartFor(TimedPhase::kApplying, clock->now());
+    metrics->onOplogEntriesFetched(1000);
+    clock->advance(Seconds(5));
+    metrics->onOplogEntriesApplied(500);
+
+    // 500 entries remain to be applied at 100 entries per second.
+    report = metrics->reportForCurrentOp();
+    ASSERT_EQ(report.getIntField("oplogEntriesAppliedPerSec"), 100);
+    ASSERT_EQ(report.getIntField("oplogCatchUpTimeEstimatedSecs"), 5);
+
+    clock->advance(Seconds(5));
+    metrics->onOplogEntriesApplied(500);
+    report = metrics->reportForCurrentOp();
+    ASSERT_EQ(report.getIntField("oplogEntriesAppliedPerSec"), 100);
+    ASSERT_EQ(report.getIntField("oplogCatchUpTimeEstimatedSecs"), 0);
+}
+
 TEST_F(ReshardingMetricsTest, RecipientReportsRemainingTimeLowElapsed) {
     auto metrics = createInstanceMetrics(getClockSource(), UUID::gen(), Role::kRecipient);
     const auto& clock = getClockSource();
@@ -55,6 +55,7 @@
 #include "mongo/db/s/resharding/resharding_donor_oplog_iterator.h"
 #include "mongo/db/s/resharding/resharding_future_util.h"
 #include "mongo/db/s/resharding/resharding_oplog_applier.h"
+#include "mongo/db/s/resharding/resharding_server_parameters_gen.h"
 #include "mongo/db/s/resharding/resharding_util.h"
 #include "mongo/idl/idl_parser.h"
 #include "mongo/logv2/log.h"
@@ -166,23 +167,54 @@ SemiFuture<void> ReshardingOplogApplier::run(
     CancellationToken cancelToken,
     CancelableOperationContextFactory factory) {
     struct ChainContext {
+        explicit ChainContext(const CancellationToken& cancelToken)
+            : prefetchSource(cancelToken) {}
+
         std::unique_ptr<ReshardingDonorOplogIteratorInterface> oplogIter;
         Timer fetchTimer;
+
+        // Retrieval of the batch following the one being applied, if it was started before
+        // applying that batch. Canceling 'prefetchSource' stops it waiting for further oplog
+        // entries to be inserted into the oplog buffer collection.
+        boost::optional<SemiFuture<OplogBatch>> nextBatch;
+        CancellationSource prefetchSource;
     };
 
-    auto chainCtx = std::make_shared<ChainContext>();
+    auto chainCtx = std::make_shared<ChainContext>(cancelToken);
     chainCtx->oplogIter = std::move(_oplogIter);
 
     return AsyncTry([this, chainCtx, executor, cancelToken, factory] {
                chainCtx->fetchTimer.reset();
-               return chainCtx->oplogIter->getNextBatch(executor, cancelToken, factory)
-                   .thenRunOn(executor)
+               auto batchFuture = [&] {
+                   if (chainCtx->nextBatch) {
+                       auto nextBatch = std::move(*chainCtx->nextBatch);
+                       chainCtx->nextBatch.reset();
+                       return std::move(nextBatch).thenRunOn(executor);
+                   }
+                   return chainCtx->oplogIter->getNextBatch(executor, cancelToken, factory);
+               }();
+
+               return std::move(batchFuture)
                    .then([this, chainCtx, executor, cancelToken, factory](OplogBatch batch) {
                        LOGV2_DEBUG(5391002, 3, "Starting batch", "batchSize"_attr = batch.size());
 
                        _env->applierMetrics()->onBatchRetrievedDuringOplogApplying(
                            duration_cast<Milliseconds>(chainCtx->fetchTimer.elapsed()));
 
+                       // Read the next batch from the oplog buffer collection concurrently with
+                       // applying this one. The iterator is only ever used by one task at a time
+                       // because the next retrieval waits for this one to have completed.
+                       if (!batch.empty() &&
+                           resharding::gReshardingOplogApplierPrefetchNextBatch.load()) {
+                           chainCtx->nextBatch =
+                               ExecutorFuture<void>(executor)
+                                   .then([chainCtx, executor, factory] {
+                                       return chainCtx->oplogIter->getNextBatch(
+                                           executor, chainCtx->prefetchSource.token(), factory);
+                                   })
+                                   .semi();
+                       }
+
                        _currentBatchToApply = std::move(batch);
                        return _applyBatch(executor, cancelToken, factory);
                    })
@@ -218,10 +250,26 @@ SemiFuture<void> ReshardingOplogApplier::run(
         })
         .on(executor, cancelToken)
         .ignoreValue()
-        .thenRunOn(std::move(cleanupExecutor))
+        .thenRunOn(cleanupExecutor)
         // It is unsafe to capture `this` once the task is running on the cleanupExecutor because
         // RecipientStateMachine, along with its ReshardingOplogApplier member, may have already
         // been destructed.
+        .onCompletion([chainCtx, cleanupExecutor](Status status) -> ExecutorFuture<void> {
+            if (!chainCtx->nextBatch) {
+                return ExecutorFuture<void>(cleanupExecutor, std::move(status));
+            }
+
+            // The iterator must not be disposed of while the prefetch is still reading from it, so
+            // stop the prefetch and chain the disposal after it instead of blocking on it.
+            chainCtx->prefetchSource.cancel();
+            auto nextBatch = std::move(*chainCtx->nextBatch);
+            chainCtx->nextBatch.reset();
+            return std::move(nextBatch)
+                .thenRunOn(cleanupExecutor)
+                .onCompletion([status = std::move(status)](StatusWith<OplogBatch>) mutable {
+                    return std::move(status);
+                });
+        })
         .onCompletion([chainCtx](Status status) {
             if (chainCtx->oplogIter) {
                 // Use a separate Client to make a better effort of calling dispose() even when the
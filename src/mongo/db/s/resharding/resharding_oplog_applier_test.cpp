@@ -84,6 +84,8 @@
 #include "mongo/executor/network_connection_hook.h"
 #include "mongo/executor/network_interface_factory.h"
 #include "mongo/executor/thread_pool_task_executor.h"
+#include "mongo/idl/server_parameter_test_util.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/rpc/metadata/egress_metadata_hook_list.h"
 #include "mongo/rpc/metadata/metadata_hook.h"
 #include "mongo/s/catalog/sharding_catalog_client.h"
@@ -105,6 +107,7 @@
 #include "mongo/unittest/framework.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/clock_source.h"
+#include "mongo/util/concurrency/notification.h"
 #include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/future_impl.h"
 #include "mongo/util/net/hostandport.h"
@@ -119,6 +122,16 @@ namespace {
 
 using namespace fmt::literals;
 
+/**
+ * State of a batch which an OplogIteratorMock only returns, with an error, once its retrieval is
+ * canceled. Shared with the test because the applier destroys the iterator when it is done.
+ */
+struct HangingBatch {
+    Notification<void> requested;
+    AtomicWord<bool> returned{false};
+    AtomicWord<bool> disposedWhileHanging{false};
+};
+
 class OplogIteratorMock : public ReshardingDonorOplogIteratorInterface {
 public:
     OplogIteratorMock(std::deque<repl::OplogEntry> oplogToReturn, size_t batchSize)
@@ -134,6 +147,15 @@ public:
         // getNextBatch() doesn't already have an operation context.
         auto opCtx = factory.makeOperationContext(&cc());
 
+        if (_hangingBatch && ++_numBatchesRequested == _hangingBatchNumber) {
+            _hangingBatch->requested.set();
+            return cancelToken.onCancel().thenRunOn(std::move(executor)).onCompletion(
+                [hangingBatch = _hangingBatch](Status) -> std::vector<repl::OplogEntry> {
+                    hangingBatch->returned.store(true);
+                    uasserted(ErrorCodes::CallbackCanceled, "OplogIteratorMock batch canceled");
+                });
+        }
+
         return ExecutorFuture(std::move(executor)).then([this] {
             std::vector<repl::OplogEntry> ret;
 
@@ -157,10 +179,28 @@ public:
         _doThrow = true;
     }
 
+    /**
+     * Makes the retrieval of the 'batchNumber'th batch, counting from 1, wait until it is canceled.
+     */
+    void setHangingBatch(size_t batchNumber, std::shared_ptr<HangingBatch> hangingBatch) {
+        _hangingBatchNumber = batchNumber;
+        _hangingBatch = std::move(hangingBatch);
+    }
+
+    void dispose(OperationContext* opCtx) override {
+        if (_hangingBatch && _hangingBatch->requested && !_hangingBatch->returned.load()) {
+            _hangingBatch->disposedWhileHanging.store(true);
+        }
+    }
+
 private:
     std::deque<repl::OplogEntry> _oplogToReturn;
     const size_t _batchSize;
     bool _doThrow{false};
+
+    size_t _numBatchesRequested{0};
+    size_t _hangingBatchNumber{0};
+    std::shared_ptr<HangingBatch> _hangingBatch;
 };
 
 class ReshardingOplogApplierTest : public ShardingMongoDTestFixture {
@@ -647,6 +687,147 @@ TEST_F(ReshardingOplogApplierTest, InsertTypeOplogAppliedInMultipleBatches) {
     ASSERT_EQ(20, progressDoc->getNumEntriesApplied());
 }
 
+TEST_F(ReshardingOplogApplierTest, InsertTypeOplogAppliedInMultipleBatchesWithoutPrefetch) {
+    RAIIServerParameterControllerForTest prefetchController{
+        "reshardingOplogApplierPrefetchNextBatch", false};
+    loadCatalogCacheValues();
+
+    std::deque<repl::OplogEntry> crudOps;
+
+    for (int x = 0; x < 20; x++) {
+        crudOps.push_back(makeOplog(repl::OpTime(Timestamp(x, 3), 1),
+                                    repl::OpTypeEnum::kInsert,
+                                    BSON("_id" << x),
+                                    boost::none));
+    }
+
+    auto iterator = std::make_unique<OplogIteratorMock>(std::move(crudOps), 3 /* batchSize */);
+    boost::optional<ReshardingOplogApplier> applier;
+    applier.emplace(makeApplierEnv(),
+                    kApplierBatchTaskCount,
+                    sourceId(),
+                    oplogBufferNs(),
+                    appliedToNs(),
+                    stashCollections(),
+                    0U /* myStashIdx */,
+                    chunkManager(),
+                    std::move(iterator));
+
+    auto cancelToken = operationContext()->getCancellationToken();
+    CancelableOperationContextFactory factory(cancelToken, getCancelableOpCtxExecutor());
+    auto future = applier->run(getExecutor(), getExecutor(), cancelToken, factory);
+    ASSERT_OK(future.getNoThrow());
+
+    DBDirectClient client(operationContext());
+
+    for (int x = 0; x < 19; x++) {
+        auto doc = client.findOne(appliedToNs(), BSON("_id" << x));
+        ASSERT_BSONOBJ_EQ(BSON("_id" << x), doc);
+    }
+
+    auto progressDoc = ReshardingOplogApplier::checkStoredProgress(operationContext(), sourceId());
+    ASSERT_TRUE(progressDoc);
+    ASSERT_EQ(Timestamp(19, 3), progressDoc->getProgress().getTs());
+    ASSERT_EQ(20, progressDoc->getNumEntriesApplied());
+}
+
+TEST_F(ReshardingOplogApplierTest, ErrorDuringBatchApplyWhilePrefetchingNextBatch) {
+    RAIIServerParameterControllerForTest prefetchController{
+        "reshardingOplogApplierPrefetchNextBatch", true};
+    loadCatalogCacheValues();
+    std::deque<repl::OplogEntry> crudOps;
+    crudOps.push_back(makeOplog(repl::OpTime(Timestamp(5, 3), 1),
+                                repl::OpTypeEnum::kInsert,
+                                BSON("_id" << 1),
+                                boost::none));
+    crudOps.push_back(makeOplog(repl::OpTime(Timestamp(6, 3), 1),
+                                repl::OpTypeEnum::kUpdate,
+                                BSON("$invalidOperator" << BSON("x" << 1)),
+                                BSON("_id" << 1)));
+    crudOps.push_back(makeOplog(repl::OpTime(Timestamp(7, 3), 1),
+                                repl::OpTypeEnum::kInsert,
+                                BSON("_id" << 2),
+                                boost::none));
+
+    // The second batch is only returned once the applier gives up on it.
+    auto hangingBatch = std::make_shared<HangingBatch>();
+    auto iterator = std::make_unique<OplogIteratorMock>(std::move(crudOps), 2 /* batchSize */);
+    iterator->setHangingBatch(2, hangingBatch);
+
+    boost::optional<ReshardingOplogApplier> applier;
+    applier.emplace(makeApplierEnv(),
+                    kApplierBatchTaskCount,
+                    sourceId(),
+                    oplogBufferNs(),
+                    appliedToNs(),
+                    stashCollections(),
+                    0U /* myStashIdx */,
+                    chunkManager(),
+                    std::move(iterator));
+
+    auto cancelToken = operationContext()->getCancellationToken();
+    CancelableOperationContextFactory factory(cancelToken, getCancelableOpCtxExecutor());
+    auto future = applier->run(getExecutor(), getExecutor(), cancelToken, factory);
+    ASSERT_EQ(future.getNoThrow(), ErrorCodes::duplicateCodeForTest(4772600));
+
+    ASSERT(hangingBatch->requested);
+    ASSERT(hangingBatch->returned.load());
+    ASSERT_FALSE(hangingBatch->disposedWhileHanging.load());
+
+    DBDirectClient client(operationContext());
+    ASSERT_BSONOBJ_EQ(BSONObj(), client.findOne(appliedToNs(), BSON("_id" << 2)));
+    ASSERT_FALSE(ReshardingOplogApplier::checkStoredProgress(operationContext(), sourceId()));
+}
+
+TEST_F(ReshardingOplogApplierTest, CanceledWhileWaitingForPrefetchedBatch) {
+    RAIIServerParameterControllerForTest prefetchController{
+        "reshardingOplogApplierPrefetchNextBatch", true};
+    loadCatalogCacheValues();
+    std::deque<repl::OplogEntry> crudOps;
+    crudOps.push_back(makeOplog(repl::OpTime(Timestamp(5, 3), 1),
+                                repl::OpTypeEnum::kInsert,
+                                BSON("_id" << 1),
+                                boost::none));
+    crudOps.push_back(makeOplog(repl::OpTime(Timestamp(6, 3), 1),
+                                repl::OpTypeEnum::kInsert,
+                                BSON("_id" << 2),
+                                boost::none));
+    crudOps.push_back(makeOplog(repl::OpTime(Timestamp(7, 3), 1),
+                                repl::OpTypeEnum::kInsert,
+                                BSON("_id" << 3),
+                                boost::none));
+
+    auto hangingBatch = std::make_shared<HangingBatch>();
+    auto iterator = std::make_unique<OplogIteratorMock>(std::move(crudOps), 2 /* batchSize */);
+    iterator->setHangingBatch(2, hangingBatch);
+
+    boost::optional<ReshardingOplogApplier> applier;
+    applier.emplace(makeApplierEnv(),
+                    kApplierBatchTaskCount,
+                    sourceId(),
+                    oplogBufferNs(),
+                    appliedToNs(),
+                    stashCollections(),
+                    0U /* myStashIdx */,
+                    chunkManager(),
+                    std::move(iterator));
+
+    auto abortSource = CancellationSource();
+    auto cancelToken = abortSource.token();
+    CancelableOperationContextFactory factory(cancelToken, getCancelableOpCtxExecutor());
+    auto future = applier->run(getExecutor(), getExecutor(), cancelToken, factory);
+
+    hangingBatch->requested.get();
+    abortSource.cancel();
+    ASSERT_EQ(future.getNoThrow(), ErrorCodes::CallbackCanceled);
+
+    ASSERT(hangingBatch->returned.load());
+    ASSERT_FALSE(hangingBatch->disposedWhileHanging.load());
+
+    DBDirectClient client(operationContext());
+    ASSERT_BSONOBJ_EQ(BSONObj(), client.findOne(appliedToNs(), BSON("_id" << 3)));
+}
+
 TEST_F(ReshardingOplogApplierTest, ErrorDuringFirstBatchApply) {
     loadCatalogCacheValues();
     std::deque<repl::OplogEntry> crudOps;
@@ -932,6 +932,15 @@ ReshardingRecipientService::RecipientStateMachine::_cloneThenTransitionToBuildin
     return future_util::withCancellation(_dataReplication->awaitCloningDone(), abortToken)
         .thenRunOn(**executor)
         .then([this, &factory] {
+            if (auto throughput = _metrics->getCloneThroughput()) {
+                LOGV2(9886601,
+                      "Resharding recipient finished cloning",
+                      "reshardingUUID"_attr = _metadata.getReshardingUUID(),
+                      "documentsCopied"_attr = _metrics->getDocumentsProcessedCount(),
+                      "bytesCopied"_attr = _metrics->getBytesWrittenCount(),
+                      "documentsCopiedPerSec"_attr = throughput->documentsPerSec,
+                      "bytesCopiedPerSec"_attr = throughput->bytesPerSec);
+            }
             if (resharding::gFeatureFlagReshardingImprovements.isEnabled(
                     serverGlobalParams.featureCompatibility.acquireFCVSnapshot())) {
                 _transitionState(RecipientStateEnum::kBuildingIndex, factory);
@@ -1079,6 +1088,13 @@ ExecutorFuture<void> ReshardingRecipientService::RecipientStateMachine::
                                                  abortToken);
         })
         .then([this, &factory] {
+            if (auto rate = _metrics->getOplogApplicationRatePerSec()) {
+                LOGV2(9886602,
+                      "Resharding recipient caught up with all donors",
+                      "reshardingUUID"_attr = _metadata.getReshardingUUID(),
+                      "oplogEntriesAppliedPerSec"_attr = *rate);
+            }
+
             auto opCtx = factory.makeOperationContext(&cc());
             for (const auto& donor : _donorShards) {
                 auto stashNss = resharding::getLocalConflictStashNamespace(
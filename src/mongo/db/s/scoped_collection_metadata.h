@@ -139,6 +139,11 @@ public:
         return _impl->get().keyBelongsToMe(key);
     }
 
+    boost::optional<CollectionMetadata::KeyRangeOwnership> keyRangeOwnership(
+        const BSONObj& key) const {
+        return _impl->get().keyRangeOwnership(key);
+    }
+
     ChunkManager::ChunkOwnership nearestOwnedChunk(const BSONObj& key,
                                                    ChunkMap::Direction direction) const {
         return _impl->get().nearestOwnedChunk(key, direction);
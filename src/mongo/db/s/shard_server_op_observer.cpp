@@ -55,6 +55,7 @@
 #include "mongo/db/s/database_sharding_state.h"
 #include "mongo/db/s/migration_source_manager.h"
 #include "mongo/db/s/operation_sharding_state.h"
+#include "mongo/db/s/range_access_sampler.h"
 #include "mongo/db/s/range_deletion_task_gen.h"
 #include "mongo/db/s/shard_filtering_metadata_refresh.h"
 #include "mongo/db/s/shard_identity_rollback_notifier.h"
@@ -183,6 +184,40 @@ void abortOngoingMigrationIfNeeded(OperationContext* opCtx, const NamespaceStrin
     }
 }
 
+/**
+ * Feeds a sampled write to a document of a sharded collection into the RangeAccessSampler. Only
+ * primaries sample writes, since secondaries applying oplog entries do not serve the user load.
+ */
+void sampleWriteAccess(OperationContext* opCtx, const CollectionPtr& coll, const BSONObj& doc) {
+    if (doc.isEmpty() || !opCtx->isEnforcingConstraints() || coll->ns().isOnInternalDb() ||
+        !RangeAccessSampler::shouldSample()) {
+        return;
+    }
+
+    const auto metadata =
+        CollectionShardingRuntime::assertCollectionLockedAndAcquireShared(opCtx, coll->ns())
+            ->getCurrentMetadataIfKnown();
+    if (!metadata || !metadata->isSharded()) {
+        return;
+    }
+
+    const auto shardKey = metadata->getShardKeyPattern().extractShardKeyFromDoc(doc);
+    if (shardKey.isEmpty()) {
+        return;
+    }
+
+    const auto ownership = metadata->keyRangeOwnership(shardKey);
+    if (!ownership || !ownership->owned) {
+        return;
+    }
+
+    RangeAccessSampler::get(opCtx)->recordAccess(
+        metadata->getUUID(),
+        ownership->range,
+        shardKey,
+        opCtx->getServiceContext()->getFastClockSource()->now());
+}
+
 }  // namespace
 
 ShardServerOpObserver::ShardServerOpObserver() = default;
@@ -207,6 +242,8 @@ void ShardServerOpObserver::onInserts(OperationContext* opCtx,
     for (auto it = begin; it != end; ++it) {
         const auto& insertedDoc = it->doc;
 
+        sampleWriteAccess(opCtx, coll, insertedDoc);
+
         if (nss == NamespaceString::kServerConfigurationNamespace) {
             if (auto idElem = insertedDoc["_id"]) {
                 if (idElem.str() == ShardIdentityType::IdName) {
@@ -315,6 +352,8 @@ void ShardServerOpObserver::onUpdate(OperationContext* opCtx,
         return;
     }
 
+    sampleWriteAccess(opCtx, args.coll, args.updateArgs->updatedDoc);
+
     const auto& updateDoc = args.updateArgs->update;
     // Most of these handlers do not need to run when the update is a full document replacement.
     // An empty updateDoc implies a no-op update and is not a valid oplog entry.
@@ -614,6 +653,8 @@ void ShardServerOpObserver::onDelete(OperationContext* opCtx,
         return;
     }
 
+    sampleWriteAccess(opCtx, coll, doc);
+
     const auto& nss = coll->ns();
     BSONObj documentId;
     if (nss == NamespaceString::kCollectionCriticalSectionsNamespace ||
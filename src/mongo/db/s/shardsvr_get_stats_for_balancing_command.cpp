@@ -48,6 +48,7 @@
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/s/balancer_stats_registry.h"
+#include "mongo/db/s/range_access_sampler.h"
 #include "mongo/db/service_context.h"
 #include "mongo/rpc/op_msg.h"
 #include "mongo/s/request_types/get_stats_for_balancing_gen.h"
@@ -69,6 +70,9 @@ public:
     // Default scale factor for data size (MiB)
     static constexpr int kDefaultScaleFactorMB{1024 * 1024};
 
+    // Maximum number of hot ranges returned per collection when range loads are requested
+    static constexpr size_t kMaxHotRangesPerCollection{10};
+
     bool skipApiVersionCheck() const override {
         // Internal command (config -> shard).
         return true;
@@ -106,12 +110,40 @@ public:
             for (const auto& nsWithOptUUID : request().getCollections()) {
                 const auto collDataSizeScaled = static_cast<long long>(
                     _getCollDataSizeBytes(opCtx, nsWithOptUUID) / scaleFactor);
-                collStats.emplace_back(nsWithOptUUID.getNs(), collDataSizeScaled);
+                CollStatsForBalancing stats(nsWithOptUUID.getNs(), collDataSizeScaled);
+                if (request().getIncludeRangeLoads()) {
+                    _appendRangeLoads(opCtx, nsWithOptUUID, stats);
+                }
+                collStats.push_back(std::move(stats));
             }
             return {std::move(collStats)};
         }
 
     private:
+        void _appendRangeLoads(OperationContext* opCtx,
+                               const NamespaceWithOptionalUUID& nsWithOptUUID,
+                               CollStatsForBalancing& stats) const {
+            // The sampled loads are keyed by collection UUID, which the balancer always attaches
+            RangeAccessSampler::CollectionLoad load;
+            if (const auto& collUUID = nsWithOptUUID.getUUID()) {
+                load = RangeAccessSampler::get(opCtx)->getCollectionLoad(
+                    *collUUID,
+                    kMaxHotRangesPerCollection,
+                    opCtx->getServiceContext()->getFastClockSource()->now());
+            }
+
+            std::vector<RangeLoadForBalancing> hotRanges;
+            hotRanges.reserve(load.hottestRanges.size());
+            for (const auto& rangeLoad : load.hottestRanges) {
+                RangeLoadForBalancing hotRange(
+                    rangeLoad.range.getMin(), rangeLoad.range.getMax(), rangeLoad.opsPerSec);
+                hotRange.setMedianKey(rangeLoad.medianKey);
+                hotRanges.push_back(std::move(hotRange));
+            }
+            stats.setOpsPerSec(load.opsPerSec);
+            stats.setHotRanges(std::move(hotRanges));
+        }
+
         long long _getCollDataSizeBytes(OperationContext* opCtx,
                                         const NamespaceWithOptionalUUID& nsWithOptUUID) const {
             const auto& ns = nsWithOptUUID.getNs();
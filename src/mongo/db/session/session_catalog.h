@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <array>
 #include <boost/move/utility_core.hpp>
 #include <boost/optional.hpp>
 #include <boost/optional/optional.hpp>
@@ -64,6 +65,10 @@ class ObservableSession;
 /**
  * Keeps track of the transaction runtime state for every active transaction session on this
  * instance.
+ *
+ * The catalog is split into a fixed number of partitions, each with its own mutex, so that
+ * checking out unrelated sessions does not serialize on a single lock. A logical session and all
+ * of its child (internal) sessions always live in the same partition.
  */
 class SessionCatalog {
     SessionCatalog(const SessionCatalog&) = delete;
@@ -130,6 +135,9 @@ public:
      * not allowed to block, perform I/O or acquire any lock manager locks.
      * Iterates through the SessionCatalog and applies 'workerFn' to each Session. This locks the
      * SessionCatalog.
+     *
+     * The scans over multiple sessions lock one partition at a time, so they do not observe a
+     * single point-in-time view of the whole catalog.
      */
     enum class ScanSessionCreateSession { kYes, kNo };
     void scanSession(const LogicalSessionId& lsid,
@@ -227,6 +235,27 @@ private:
     };
     using SessionRuntimeInfoMap = LogicalSessionIdMap<std::unique_ptr<SessionRuntimeInfo>>;
 
+    /**
+     * One independently locked slice of the catalog.
+     */
+    struct Partition {
+        // Protects the state below
+        mutable stdx::mutex mutex;
+
+        // Owns the Session objects for the sessions which hash to this partition.
+        SessionRuntimeInfoMap sessions;
+    };
+
+    // Number of partitions the catalog is split into. Must be a power of two.
+    static constexpr size_t kNumPartitions = 32;
+    static_assert((kNumPartitions & (kNumPartitions - 1)) == 0);
+
+    /**
+     * Returns the partition which owns 'lsid'. Child sessions map to the partition of their
+     * parent session.
+     */
+    Partition& _getPartition(const LogicalSessionId& lsid);
+
     /**
      * Returns a callback with the default logic used to decide if a session may be reaped early.
      */
@@ -248,16 +277,22 @@ private:
     ScopedCheckedOutSession _checkOutSession(OperationContext* opCtx);
 
     /**
-     * Returns the session runtime info for 'lsid' from the '_sessions' map. The returned pointer
-     * is guaranteed to be linked on the map for as long as the mutex is held.
+     * Returns the session runtime info for 'lsid' from the sessions map of 'partition', whose
+     * mutex must be held. The returned pointer is guaranteed to be linked on the map for as long
+     * as the mutex is held.
      */
-    SessionRuntimeInfo* _getSessionRuntimeInfo(WithLock lk, const LogicalSessionId& lsid);
+    SessionRuntimeInfo* _getSessionRuntimeInfo(WithLock lk,
+                                               Partition& partition,
+                                               const LogicalSessionId& lsid);
 
     /**
-     * Creates or returns the session runtime info for 'lsid' from the '_sessions' map. The
-     * returned pointer is guaranteed to be linked on the map for as long as the mutex is held.
+     * Creates or returns the session runtime info for 'lsid' from the sessions map of
+     * 'partition', whose mutex must be held. The returned pointer is guaranteed to be linked on the
+     * map for as long as the mutex is held.
      */
-    SessionRuntimeInfo* _getOrCreateSessionRuntimeInfo(WithLock lk, const LogicalSessionId& lsid);
+    SessionRuntimeInfo* _getOrCreateSessionRuntimeInfo(WithLock lk,
+                                                       Partition& partition,
+                                                       const LogicalSessionId& lsid);
 
     /**
      * Makes a session, previously checked out through 'checkoutSession', available again. Will free
@@ -279,11 +314,8 @@ private:
     MakeSessionWorkerFnForEagerReap _makeSessionWorkerFnForEagerReap =
         _defaultMakeSessionWorkerFnForEagerReap;
 
-    // Protects the state below
-    mutable stdx::mutex _mutex;
-
-    // Owns the Session objects for all current Sessions.
-    SessionRuntimeInfoMap _sessions;
+    // Owns the Session objects for all current Sessions, split by parent session id.
+    std::array<Partition, kNumPartitions> _partitions;
 
     AtomicWord<bool> _disallowNewTransactions{false};
 };
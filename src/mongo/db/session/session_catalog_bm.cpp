@@ -0,0 +1,111 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "mongo/db/client.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/session/kill_sessions.h"
+#include "mongo/db/session/logical_session_id.h"
+#include "mongo/db/session/session_catalog.h"
+#include "mongo/db/session/session_killer.h"
+
+namespace mongo {
+namespace {
+
+ServiceContext* getServiceContext() {
+    static ServiceContext* const serviceContext = [] {
+        auto serviceContext = ServiceContext::make();
+        auto serviceContextPtr = serviceContext.get();
+        setGlobalServiceContext(std::move(serviceContext));
+        return serviceContextPtr;
+    }();
+    return serviceContext;
+}
+
+// Adds idle sessions to the catalog until it holds at least 'numSessions' entries. The catalog is
+// shared by all runs, so it only ever grows.
+void populateSessions(SessionCatalog* catalog, int64_t numSessions) {
+    for (auto i = static_cast<int64_t>(catalog->size()); i < numSessions; i++) {
+        catalog->scanSession(
+            makeLogicalSessionIdForTest(),
+            [](ObservableSession&) {},
+            SessionCatalog::ScanSessionCreateSession::kYes);
+    }
+}
+
+}  // namespace
+
+// Arg is the number of idle sessions in the catalog. Every thread repeatedly checks out and checks
+// in its own session, which is the pattern of independent retryable writes.
+void BM_SessionCatalogCheckOutCheckIn(benchmark::State& state) {
+    auto serviceContext = getServiceContext();
+    if (state.thread_index == 0) {
+        populateSessions(SessionCatalog::get(serviceContext), state.range(0));
+    }
+
+    ThreadClient threadClient(serviceContext->getService());
+    auto opCtx = threadClient->makeOperationContext();
+    opCtx->setLogicalSessionId(makeLogicalSessionIdForTest());
+
+    for (auto _ : state) {
+        OperationContextSession ocs(opCtx.get());
+        benchmark::DoNotOptimize(OperationContextSession::get(opCtx.get()));
+    }
+}
+
+// Arg is the number of idle sessions in the catalog. Measures the cost of a scan over the whole
+// catalog, as done by killSessions and the logical session cache refresh, while it is otherwise
+// idle.
+void BM_SessionCatalogScanSessions(benchmark::State& state) {
+    auto serviceContext = getServiceContext();
+    auto catalog = SessionCatalog::get(serviceContext);
+    populateSessions(catalog, state.range(0));
+
+    // An empty pattern matches every session.
+    const SessionKiller::Matcher matcher(KillAllSessionsByPatternSet{{}});
+    for (auto _ : state) {
+        int64_t numSessions = 0;
+        catalog->scanSessions(matcher, [&](ObservableSession&) { numSessions++; });
+        benchmark::DoNotOptimize(numSessions);
+    }
+}
+
+BENCHMARK(BM_SessionCatalogCheckOutCheckIn)
+    ->Arg(1'000)
+    ->Arg(200'000)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+BENCHMARK(BM_SessionCatalogScanSessions)->Arg(1'000)->Arg(200'000);
+
+}  // namespace mongo
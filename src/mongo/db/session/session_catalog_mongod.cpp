@@ -83,6 +83,7 @@
 #include "mongo/db/session/session_txn_record_gen.h"
 #include "mongo/db/session/sessions_collection.h"
 #include "mongo/db/storage/recovery_unit.h"
+#include "mongo/db/transaction/retryable_write_history_cache.h"
 #include "mongo/db/transaction/transaction_participant.h"
 #include "mongo/db/transaction_resources.h"
 #include "mongo/idl/idl_parser.h"
@@ -691,6 +692,10 @@ void MongoDSessionCatalog::invalidateAllSessions(OperationContext* opCtx) {
     });
 
     killSessionTokens(opCtx, _ti.get(), std::move(sessionKillTokens));
+
+    // The oplog chains cached for retryable writes may no longer match the oplog, for example
+    // after a rollback.
+    RetryableWriteHistoryCache::get(opCtx)->clear();
 }
 
 int MongoDSessionCatalog::reapSessionsOlderThan(OperationContext* opCtx,
@@ -482,6 +482,42 @@ TEST_F(SessionCatalogTestWithDefaultOpCtx, ScanSessions) {
                        ErrorCodes::InvalidOptions);
 }
 
+TEST_F(SessionCatalogTestWithDefaultOpCtx, ScanSessionsVisitsEverySessionAcrossPartitions) {
+    // Create enough logical sessions to spread them over all of the catalog's partitions, each
+    // with one child session.
+    const int kNumParentSessions = 500;
+    LogicalSessionIdSet lsidsCreated;
+    boost::optional<LogicalSessionId> someChildLsid;
+    for (int i = 0; i < kNumParentSessions; ++i) {
+        auto parentLsid = makeLogicalSessionIdForTest();
+        auto childLsid = makeLogicalSessionIdWithTxnNumberAndUUIDForTest(parentLsid);
+        for (const auto& lsid : {parentLsid, childLsid}) {
+            catalog()->scanSession(
+                lsid, [](ObservableSession&) {}, SessionCatalog::ScanSessionCreateSession::kYes);
+            lsidsCreated.insert(lsid);
+        }
+        someChildLsid = childLsid;
+    }
+    ASSERT_EQ(static_cast<size_t>(kNumParentSessions), catalog()->size());
+
+    auto lsidsFound = getAllSessionIds(_opCtx);
+    ASSERT_EQ(lsidsCreated.size(), lsidsFound.size());
+    for (const auto& lsid : lsidsFound) {
+        ASSERT(lsidsCreated.count(lsid));
+    }
+
+    int numParentSessionsFound = 0;
+    catalog()->scanParentSessions([&](ObservableSession& session) {
+        ASSERT(isParentSessionId(session.getSessionId()));
+        ++numParentSessionsFound;
+    });
+    ASSERT_EQ(kNumParentSessions, numParentSessionsFound);
+
+    // A child session lives in its parent's partition, so it can still be checked out by itself.
+    createSession(*someChildLsid);
+    ASSERT_EQ(static_cast<size_t>(kNumParentSessions), catalog()->size());
+}
+
 TEST_F(SessionCatalogTestWithDefaultOpCtx, ScanSessionsForReapWhenParentSessionIsCheckedOut) {
     auto runTest = [&](bool hangAfterIncrementingNumWaitingToCheckOut) {
         auto parentLsid = makeLogicalSessionIdForTest();
@@ -0,0 +1,594 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/storage/backup_block_copier.h"
+
+#include <algorithm>
+#include <boost/filesystem/operations.hpp>
+#include <cerrno>
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+#include "mongo/base/error_codes.h"
+#include "mongo/base/string_data.h"
+#include "mongo/config.h"  // IWYU pragma: keep
+#include "mongo/logv2/log.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/util/concurrency/thread_pool.h"
+#include "mongo/util/errno_util.h"
+#include "mongo/util/murmur3.h"
+#include "mongo/util/scopeguard.h"
+#include "mongo/util/static_immortal.h"
+#include "mongo/util/str.h"
+#include "mongo/util/timer.h"
+
+#ifdef MONGO_CONFIG_WIREDTIGER_ENABLED
+#include <wiredtiger.h>
+#endif
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kStorage
+
+namespace mongo {
+namespace {
+
+// Size of the buffer used when copying a block through user space.
+constexpr std::size_t kCopyBufferSize = 1024 * 1024;
+
+/**
+ * Returns whether 'inner' is 'outer' or a path within it. Both paths must be canonical.
+ */
+bool isSameOrWithin(const boost::filesystem::path& inner, const boost::filesystem::path& outer) {
+    return std::mismatch(outer.begin(), outer.end(), inner.begin(), inner.end()).first ==
+        outer.end();
+}
+
+#ifndef _WIN32
+std::size_t chunkSize(std::uint64_t remaining) {
+    return static_cast<std::size_t>(std::min<std::uint64_t>(kCopyBufferSize, remaining));
+}
+
+std::uint32_t addToChecksum(std::uint32_t checksum, const char* data, std::size_t size) {
+#ifdef MONGO_CONFIG_WIREDTIGER_ENABLED
+    return wiredtiger_crc32c_with_seed_func()(checksum, data, size);
+#else
+    return murmur3<sizeof(std::uint32_t)>(ConstDataRange{data, size}, checksum);
+#endif
+}
+
+/**
+ * Owns a file descriptor, closing it on destruction.
+ */
+class FileDescriptor {
+public:
+    FileDescriptor(const boost::filesystem::path& path, int flags)
+        : _path(path.string()), _fd(::open(_path.c_str(), flags, 0600)) {}
+
+    ~FileDescriptor() {
+        if (_fd >= 0)
+            ::close(_fd);
+    }
+
+    FileDescriptor(const FileDescriptor&) = delete;
+    FileDescriptor& operator=(const FileDescriptor&) = delete;
+
+    Status status(StringData action) const {
+        if (_fd >= 0)
+            return Status::OK();
+        auto ec = lastPosixError();
+        return {ErrorCodes::FileOpenFailed,
+                str::stream() << "Failed to open '" << _path << "' to " << action << ": "
+                              << errorMessage(ec)};
+    }
+
+    int get() const {
+        return _fd;
+    }
+
+    const std::string& path() const {
+        return _path;
+    }
+
+private:
+    const std::string _path;
+    const int _fd;
+};
+
+Status streamError(StringData action, const std::string& path) {
+    auto ec = lastPosixError();
+    return {ErrorCodes::FileStreamFailed,
+            str::stream() << "Failed to " << action << " '" << path << "': " << errorMessage(ec)};
+}
+
+/**
+ * Flushes the data of 'file' to disk, or for a directory, the entries added to it.
+ */
+Status syncToDisk(const FileDescriptor& file) {
+#ifdef __linux__
+    const int ret = ::fdatasync(file.get());
+#else
+    const int ret = ::fsync(file.get());
+#endif
+    return ret == 0 ? Status::OK() : streamError("sync", file.path());
+}
+
+/**
+ * Reads exactly 'size' bytes at 'offset', failing if the file ends before then.
+ */
+Status readFully(const FileDescriptor& file, char* buf, std::size_t size, off_t offset) {
+    while (size > 0) {
+        auto n = ::pread(file.get(), buf, size, offset);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n < 0)
+            return streamError("read from", file.path());
+        if (n == 0)
+            return {ErrorCodes::FileStreamFailed,
+                    str::stream() << "Unexpected end of file '" << file.path() << "' at offset "
+                                  << offset};
+        buf += n;
+        size -= n;
+        offset += n;
+    }
+    return Status::OK();
+}
+
+Status writeFully(const FileDescriptor& file, const char* buf, std::size_t size, off_t offset) {
+    while (size > 0) {
+        auto n = ::pwrite(file.get(), buf, size, offset);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n < 0)
+            return streamError("write to", file.path());
+        buf += n;
+        size -= n;
+        offset += n;
+    }
+    return Status::OK();
+}
+
+StatusWith<std::uint32_t> checksumRange(const FileDescriptor& file,
+                                        char* buf,
+                                        off_t offset,
+                                        std::uint64_t length) {
+    std::uint32_t checksum = 0;
+    for (std::uint64_t read = 0; read < length;) {
+        auto size = chunkSize(length - read);
+        if (auto status = readFully(file, buf, size, offset + read); !status.isOK())
+            return status;
+        checksum = addToChecksum(checksum, buf, size);
+        read += size;
+    }
+    return checksum;
+}
+
+/**
+ * Compares the checksum of a copied range in the source and the destination. The destination must
+ * have been synced to disk: its cached pages are dropped first, so that it is read back from disk.
+ */
+Status verifyRange(const FileDescriptor& source,
+                   const FileDescriptor& destination,
+                   off_t offset,
+                   std::uint64_t length) {
+#ifdef POSIX_FADV_DONTNEED
+    // Only a hint. Pages which cannot be dropped are read back from the page cache.
+    ::posix_fadvise(destination.get(), offset, length, POSIX_FADV_DONTNEED);
+#endif
+
+    auto buf = std::make_unique<char[]>(kCopyBufferSize);
+    auto sourceChecksum = checksumRange(source, buf.get(), offset, length);
+    if (!sourceChecksum.isOK())
+        return sourceChecksum.getStatus();
+    auto destinationChecksum = checksumRange(destination, buf.get(), offset, length);
+    if (!destinationChecksum.isOK())
+        return destinationChecksum.getStatus();
+
+    if (sourceChecksum.getValue() != destinationChecksum.getValue()) {
+        return {ErrorCodes::ChecksumMismatch,
+                str::stream() << "Checksum mismatch copying " << length << " bytes at offset "
+                              << offset << " from '" << source.path() << "' to '"
+                              << destination.path() << "'"};
+    }
+    return Status::OK();
+}
+
+/**
+ * Copies the range, letting the kernel move the data where possible.
+ */
+Status copyRange(const FileDescriptor& source,
+                 const FileDescriptor& destination,
+                 off_t offset,
+                 std::uint64_t length) {
+#ifdef __linux__
+    off_t inOffset = offset;
+    off_t outOffset = offset;
+    std::uint64_t remaining = length;
+    while (remaining > 0) {
+        auto n = ::copy_file_range(
+            source.get(), &inOffset, destination.get(), &outOffset, remaining, 0);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n < 0 && remaining == length &&
+            (errno == EXDEV || errno == ENOSYS || errno == EINVAL || errno == EOPNOTSUPP)) {
+            // The file systems involved don't support in-kernel copies. Nothing has been copied
+            // yet, so fall back to copying through user space.
+            break;
+        }
+        if (n < 0)
+            return streamError("copy from", source.path());
+        if (n == 0)
+            return {ErrorCodes::FileStreamFailed,
+                    str::stream() << "Unexpected end of file '" << source.path() << "' at offset "
+                                  << inOffset};
+        remaining -= n;
+    }
+    if (remaining == 0)
+        return Status::OK();
+#endif
+
+    auto buf = std::make_unique<char[]>(kCopyBufferSize);
+    for (std::uint64_t copied = 0; copied < length;) {
+        auto size = chunkSize(length - copied);
+        if (auto status = readFully(source, buf.get(), size, offset + copied); !status.isOK())
+            return status;
+        if (auto status = writeFully(destination, buf.get(), size, offset + copied);
+            !status.isOK())
+            return status;
+        copied += size;
+    }
+    return Status::OK();
+}
+
+/**
+ * Threads shared by all copies, so that concurrent copies cannot start more than
+ * BackupBlockCopier::kMaxThreads threads between them. The threads exit once idle.
+ */
+ThreadPool& copierThreadPool() {
+    static StaticImmortal<ThreadPool> pool{[] {
+        ThreadPool::Options options;
+        options.poolName = "BackupBlockCopier";
+        options.threadNamePrefix = "BackupBlockCopier-";
+        options.minThreads = 0;
+        options.maxThreads = BackupBlockCopier::kMaxThreads;
+        return options;
+    }()};
+    static const bool started = [] {
+        pool->startup();
+        return true;
+    }();
+    (void)started;
+    return *pool;
+}
+
+/**
+ * Calls a function for each index in [0, count) from up to 'numThreads' threads, the calling
+ * thread being one of them, until it fails or the token is canceled.
+ *
+ * The other threads are borrowed from the shared pool. When the pool is busy with other copies,
+ * their tasks may only start once all indexes have been claimed. Such late tasks return without
+ * touching the caller's state, so the caller only waits for tasks that actually started.
+ */
+class ConcurrentLoop : public std::enable_shared_from_this<ConcurrentLoop> {
+public:
+    ConcurrentLoop(std::size_t count,
+                   CancellationToken token,
+                   std::function<Status(std::size_t)> fn)
+        : _count(count), _token(std::move(token)), _fn(std::move(fn)) {}
+
+    Status run(std::size_t numThreads) {
+        numThreads = std::max<std::size_t>(1, std::min(numThreads, _count));
+        for (std::size_t i = 1; i < numThreads; ++i) {
+            copierThreadPool().schedule([self = shared_from_this()](Status status) {
+                if (status.isOK())
+                    self->_work();
+            });
+        }
+        _work();
+
+        stdx::unique_lock<stdx::mutex> lk(_mutex);
+        _closed = true;
+        _workerExited.wait(lk, [&] { return _numRunning == 0; });
+        return _firstError;
+    }
+
+private:
+    void _work() {
+        {
+            stdx::lock_guard<stdx::mutex> lk(_mutex);
+            if (_closed)
+                return;
+            ++_numRunning;
+        }
+        ON_BLOCK_EXIT([&] {
+            stdx::lock_guard<stdx::mutex> lk(_mutex);
+            --_numRunning;
+            _workerExited.notify_all();
+        });
+
+        while (!_failed.load()) {
+            if (_token.isCanceled()) {
+                _fail({ErrorCodes::CallbackCanceled, "Copying backup blocks was canceled"});
+                return;
+            }
+
+            auto i = _next.fetchAndAdd(1);
+            if (i >= _count)
+                return;
+
+            if (auto status = _fn(i); !status.isOK())
+                _fail(std::move(status));
+        }
+    }
+
+    void _fail(Status status) {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        if (!_failed.swap(true))
+            _firstError = std::move(status);
+    }
+
+    const std::size_t _count;
+    const CancellationToken _token;
+    const std::function<Status(std::size_t)> _fn;
+
+    AtomicWord<std::size_t> _next{0};
+    AtomicWord<bool> _failed{false};
+
+    stdx::mutex _mutex;
+    stdx::condition_variable _workerExited;
+    std::size_t _numRunning = 0;
+    bool _closed = false;
+    Status _firstError = Status::OK();
+};
+
+Status runConcurrently(std::size_t numThreads,
+                       std::size_t count,
+                       const CancellationToken& token,
+                       std::function<Status(std::size_t)> fn) {
+    if (count == 0)
+        return Status::OK();
+    return std::make_shared<ConcurrentLoop>(count, token, std::move(fn))->run(numThreads);
+}
+#endif
+
+}  // namespace
+
+double BackupBlockCopier::Stats::bytesPerSecond() const {
+    auto micros = durationCount<Microseconds>(elapsed);
+    return micros > 0 ? static_cast<double>(bytesCopied) * 1000 * 1000 / micros : 0;
+}
+
+StatusWith<boost::filesystem::path> BackupBlockCopier::resolveDestinationRoot(
+    const boost::filesystem::path& destination, const boost::filesystem::path& dbpath) {
+    if (!destination.is_absolute()) {
+        return Status(ErrorCodes::InvalidOptions,
+                      str::stream() << "The backup destination '" << destination.string()
+                                    << "' must be an absolute path");
+    }
+
+    boost::system::error_code ec;
+    if (!boost::filesystem::is_directory(destination, ec)) {
+        return Status(ErrorCodes::NonExistentPath,
+                      str::stream() << "The backup destination '" << destination.string()
+                                    << "' is not an existing directory");
+    }
+
+    auto resolved = boost::filesystem::weakly_canonical(destination, ec);
+    if (ec) {
+        return Status(ErrorCodes::InvalidOptions,
+                      str::stream() << "Failed to resolve the backup destination '"
+                                    << destination.string() << "': " << ec.message());
+    }
+    auto resolvedDbpath =
+        boost::filesystem::weakly_canonical(boost::filesystem::absolute(dbpath), ec);
+    if (ec) {
+        return Status(ErrorCodes::InvalidOptions,
+                      str::stream() << "Failed to resolve the dbpath '" << dbpath.string()
+                                    << "': " << ec.message());
+    }
+
+    // Copying into the dbpath would overwrite the files being backed up, and copying into a
+    // directory containing it would let the backed up paths collide with the dbpath's own files.
+    if (isSameOrWithin(resolved, resolvedDbpath) || isSameOrWithin(resolvedDbpath, resolved)) {
+        return Status(ErrorCodes::InvalidOptions,
+                      str::stream() << "The backup destination '" << resolved.string()
+                                    << "' must not be, contain or be within the dbpath '"
+                                    << resolvedDbpath.string() << "'");
+    }
+    return resolved;
+}
+
+BackupBlockCopier::BackupBlockCopier(Options options) : _options(std::move(options)) {
+    invariant(_options.numThreads > 0);
+}
+
+StatusWith<BackupBlockCopier::Stats> BackupBlockCopier::copy(
+    const std::vector<BackupBlock>& blocks, const CancellationToken& token) const {
+#ifdef _WIN32
+    return {ErrorCodes::IllegalOperation, "Copying backup blocks is not supported on Windows"};
+#else
+    Timer timer;
+
+    // Resolve each block's destination and create the destination files up front, so that the
+    // workers only ever write into existing files of the right size.
+    const auto sourceRoot = _options.sourceRoot.lexically_normal();
+    std::vector<boost::filesystem::path> destinations;
+    destinations.reserve(blocks.size());
+    std::map<boost::filesystem::path, std::uint64_t> destinationSizes;
+    for (const auto& block : blocks) {
+        auto relative = boost::filesystem::path(block.filePath())
+                            .lexically_normal()
+                            .lexically_relative(sourceRoot);
+        if (relative.empty() || relative == "." ||
+            std::find(relative.begin(), relative.end(), boost::filesystem::path("..")) !=
+                relative.end()) {
+            return Status(ErrorCodes::BadValue,
+                          str::stream() << "Backup file '" << block.filePath()
+                                        << "' is not within '" << _options.sourceRoot.string()
+                                        << "'");
+        }
+        destinations.push_back(_options.destinationRoot / relative);
+        auto& size = destinationSizes[destinations.back()];
+        size = std::max(size, block.fileSize());
+    }
+
+    // Directories which gained an entry, and so must be synced for the entry to survive a crash.
+    std::set<boost::filesystem::path> changedDirectories;
+    for (const auto& [path, size] : destinationSizes) {
+        for (auto dir = path.parent_path(); !boost::filesystem::exists(dir);
+             dir = dir.parent_path()) {
+            changedDirectories.insert(dir.parent_path());
+        }
+        boost::system::error_code ec;
+        boost::filesystem::create_directories(path.parent_path(), ec);
+        if (ec) {
+            return Status(ErrorCodes::FileStreamFailed,
+                          str::stream() << "Failed to create directory '"
+                                        << path.parent_path().string() << "': " << ec.message());
+        }
+        if (!boost::filesystem::exists(path))
+            changedDirectories.insert(path.parent_path());
+
+        // The destination may hold an earlier backup of the file, which is resized rather than
+        // truncated: an incremental backup only rewrites the blocks which changed since then.
+        // Resizing unconditionally also empties files which are now empty.
+        FileDescriptor file(path, O_WRONLY | O_CREAT);
+        if (auto status = file.status("create"); !status.isOK())
+            return status;
+        if (::ftruncate(file.get(), size) != 0)
+            return streamError("resize", file.path());
+    }
+
+    // The length copied for each block, with whole-file blocks resolved to the file's size. Each
+    // entry is only written by the worker copying that block.
+    std::vector<std::uint64_t> lengths(blocks.size(), 0);
+    AtomicWord<std::uint64_t> bytesCopied{0};
+    auto copyBlock = [&](std::size_t i) -> Status {
+        const auto& block = blocks[i];
+
+        FileDescriptor source(block.filePath(), O_RDONLY);
+        if (auto status = source.status("read"); !status.isOK())
+            return status;
+        FileDescriptor destination(destinations[i], O_WRONLY);
+        if (auto status = destination.status("write"); !status.isOK())
+            return status;
+
+        std::uint64_t length = block.length();
+        if (block.offset() == 0 && length == 0) {
+            if (_options.incrementalSinceBasis)
+                return Status::OK();
+
+            struct stat st;
+            if (::fstat(source.get(), &st) != 0)
+                return streamError("stat", source.path());
+            length = st.st_size;
+        }
+
+        auto status = copyRange(source, destination, block.offset(), length);
+        if (status.isOK()) {
+            lengths[i] = length;
+            bytesCopied.fetchAndAdd(length);
+        }
+        return status;
+    };
+    if (auto status = runConcurrently(_options.numThreads, blocks.size(), token, copyBlock);
+        !status.isOK())
+        return status;
+
+    // Nothing is reported as copied before it reached the disk.
+    std::vector<boost::filesystem::path> destinationFiles;
+    destinationFiles.reserve(destinationSizes.size());
+    for (const auto& entry : destinationSizes)
+        destinationFiles.push_back(entry.first);
+    auto syncFile = [&](std::size_t i) -> Status {
+        FileDescriptor file(destinationFiles[i], O_WRONLY);
+        if (auto status = file.status("sync"); !status.isOK())
+            return status;
+        return syncToDisk(file);
+    };
+    if (auto status =
+            runConcurrently(_options.numThreads, destinationFiles.size(), token, syncFile);
+        !status.isOK())
+        return status;
+    for (const auto& dir : changedDirectories) {
+        FileDescriptor file(dir, O_RDONLY | O_DIRECTORY);
+        if (auto status = file.status("sync"); !status.isOK())
+            return status;
+        if (auto status = syncToDisk(file); !status.isOK())
+            return status;
+    }
+
+    if (_options.verifyChecksums) {
+        auto verifyBlock = [&](std::size_t i) -> Status {
+            if (lengths[i] == 0)
+                return Status::OK();
+
+            FileDescriptor source(blocks[i].filePath(), O_RDONLY);
+            if (auto status = source.status("read"); !status.isOK())
+                return status;
+            FileDescriptor destination(destinations[i], O_RDONLY);
+            if (auto status = destination.status("verify"); !status.isOK())
+                return status;
+            return verifyRange(source, destination, blocks[i].offset(), lengths[i]);
+        };
+        if (auto status =
+                runConcurrently(_options.numThreads, blocks.size(), token, verifyBlock);
+            !status.isOK())
+            return status;
+    }
+
+    Stats stats;
+    stats.blocksCopied = blocks.size();
+    stats.bytesCopied = bytesCopied.load();
+    stats.elapsed = timer.elapsed();
+
+    LOGV2(9886200,
+          "Copied backup blocks",
+          "destination"_attr = _options.destinationRoot.string(),
+          "numBlocks"_attr = stats.blocksCopied,
+          "bytesCopied"_attr = stats.bytesCopied,
+          "numThreads"_attr = _options.numThreads,
+          "verifyChecksums"_attr = _options.verifyChecksums,
+          "duration"_attr = stats.elapsed,
+          "bytesPerSecond"_attr = static_cast<long long>(stats.bytesPerSecond()));
+    return stats;
+#endif
+}
+
+}  // namespace mongo
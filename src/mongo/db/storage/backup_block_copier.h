@@ -0,0 +1,107 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <boost/filesystem/path.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "mongo/base/status_with.h"
+#include "mongo/db/storage/backup_block.h"
+#include "mongo/util/cancellation.h"
+#include "mongo/util/duration.h"
+
+namespace mongo {
+
+/**
+ * Copies the blocks returned by a backup cursor from the dbpath into a local backup directory,
+ * preserving each file's path relative to the dbpath. Blocks are copied by threads borrowed from a
+ * pool shared by all copiers, so blocks of the same file may be written concurrently and out of
+ * order.
+ *
+ * The data is moved between files by the kernel where the platform supports it (copy_file_range on
+ * Linux), without passing through user space. Every destination file, and every directory which
+ * gained an entry, is synced to disk before a copy succeeds. When checksums are requested, a
+ * separate pass then reads each copied range back from the disk and compares its checksum against
+ * the source.
+ */
+class BackupBlockCopier {
+public:
+    // Maximum number of threads copying blocks across all copiers.
+    static constexpr std::size_t kMaxThreads = 32;
+
+    struct Options {
+        // Directory the backed up files are relative to, typically the dbpath.
+        boost::filesystem::path sourceRoot;
+        // Directory the files are copied to, as returned by resolveDestinationRoot().
+        boost::filesystem::path destinationRoot;
+        std::size_t numThreads = 4;
+        bool verifyChecksums = false;
+        // Whether the blocks describe changes since a previous incremental backup. In that case a
+        // block with offset=0 and length=0 denotes an unchanged file, which is only resized to its
+        // current size. Otherwise such a block denotes the entire file.
+        bool incrementalSinceBasis = false;
+    };
+
+    struct Stats {
+        std::size_t blocksCopied = 0;
+        std::uint64_t bytesCopied = 0;
+        Microseconds elapsed{0};
+
+        /**
+         * Returns the achieved copy throughput, or 0 if no time has elapsed.
+         */
+        double bytesPerSecond() const;
+    };
+
+    /**
+     * Returns the canonical form of 'destination', which must be an absolute path to an existing
+     * directory that neither is, contains, nor is within 'dbpath'.
+     */
+    static StatusWith<boost::filesystem::path> resolveDestinationRoot(
+        const boost::filesystem::path& destination, const boost::filesystem::path& dbpath);
+
+    explicit BackupBlockCopier(Options options);
+
+    /**
+     * Copies all 'blocks', returning the first error encountered by any worker. Once an error has
+     * occurred, or 'token' has been canceled, the remaining blocks are not copied. Cancellation is
+     * checked before each block and reported as CallbackCanceled.
+     */
+    StatusWith<Stats> copy(
+        const std::vector<BackupBlock>& blocks,
+        const CancellationToken& token = CancellationToken::uncancelable()) const;
+
+private:
+    Options _options;
+};
+
+}  // namespace mongo
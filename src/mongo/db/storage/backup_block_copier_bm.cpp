@@ -0,0 +1,93 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <benchmark/benchmark.h>
+#include <boost/filesystem/operations.hpp>
+#include <boost/filesystem/path.hpp>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "mongo/db/storage/backup_block.h"
+#include "mongo/db/storage/backup_block_copier.h"
+#include "mongo/unittest/temp_dir.h"
+#include "mongo/util/assert_util.h"
+
+namespace mongo {
+namespace {
+
+#ifndef _WIN32
+constexpr std::size_t kNumFiles = 8;
+constexpr std::size_t kFileSize = 64 * 1024 * 1024;
+constexpr std::size_t kBlockSize = 16 * 1024 * 1024;
+
+/**
+ * Copies 'kNumFiles' files, each reported as a series of 'kBlockSize' blocks as in an incremental
+ * backup, with the given number of threads and with or without checksum verification.
+ */
+void BM_CopyBackupBlocks(benchmark::State& state) {
+    unittest::TempDir source("BackupBlockCopierBMSource");
+    unittest::TempDir destination("BackupBlockCopierBMDestination");
+    auto sourceRoot = boost::filesystem::absolute(source.path());
+
+    std::string contents(kFileSize, 'x');
+    std::vector<BackupBlock> blocks;
+    for (std::size_t i = 0; i < kNumFiles; ++i) {
+        auto path = sourceRoot / ("collection-" + std::to_string(i) + ".wt");
+        std::ofstream(path.string(), std::ios::binary) << contents;
+        for (std::size_t offset = 0; offset < kFileSize; offset += kBlockSize) {
+            blocks.emplace_back(
+                boost::none, boost::none, path.string(), offset, kBlockSize, kFileSize);
+        }
+    }
+
+    BackupBlockCopier::Options options;
+    options.sourceRoot = sourceRoot;
+    options.destinationRoot = boost::filesystem::absolute(destination.path());
+    options.numThreads = state.range(0);
+    options.verifyChecksums = state.range(1);
+    BackupBlockCopier copier(options);
+
+    for (auto _ : state) {
+        auto stats = copier.copy(blocks);
+        invariant(stats.getStatus());
+        state.counters["copyBytesPerSecond"] = stats.getValue().bytesPerSecond();
+    }
+    state.SetBytesProcessed(state.iterations() * kNumFiles * kFileSize);
+}
+
+BENCHMARK(BM_CopyBackupBlocks)
+    ->ArgNames({"threads", "verifyChecksums"})
+    ->ArgsProduct({{1, 4, 16}, {0, 1}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+#endif
+
+}  // namespace
+}  // namespace mongo
@@ -0,0 +1,244 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <boost/filesystem/operations.hpp>
+#include <boost/filesystem/path.hpp>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "mongo/base/error_codes.h"
+#include "mongo/db/storage/backup_block.h"
+#include "mongo/db/storage/backup_block_copier.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/framework.h"
+#include "mongo/unittest/temp_dir.h"
+#include "mongo/util/cancellation.h"
+
+namespace mongo {
+namespace {
+
+#ifndef _WIN32
+class BackupBlockCopierTest : public unittest::Test {
+protected:
+    boost::filesystem::path sourcePath(const std::string& name) const {
+        return boost::filesystem::absolute(_source.path()) / name;
+    }
+
+    boost::filesystem::path destinationPath(const std::string& name) const {
+        return boost::filesystem::absolute(_destination.path()) / name;
+    }
+
+    static void writeFile(const boost::filesystem::path& path, const std::string& contents) {
+        boost::filesystem::create_directories(path.parent_path());
+        std::ofstream out(path.string(), std::ios::binary | std::ios::trunc);
+        out << contents;
+    }
+
+    static std::string readFile(const boost::filesystem::path& path) {
+        std::ifstream in(path.string(), std::ios::binary);
+        return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+    }
+
+    static std::string makeContents(std::size_t size, char seed) {
+        std::string contents(size, '\0');
+        for (std::size_t i = 0; i < size; ++i)
+            contents[i] = static_cast<char>(seed + i % 61);
+        return contents;
+    }
+
+    BackupBlock makeBlock(const std::string& name,
+                          std::uint64_t offset,
+                          std::uint64_t length,
+                          std::uint64_t fileSize) const {
+        return BackupBlock(
+            boost::none, boost::none, sourcePath(name).string(), offset, length, fileSize);
+    }
+
+    BackupBlockCopier makeCopier(bool verifyChecksums, bool incrementalSinceBasis = false) const {
+        BackupBlockCopier::Options options;
+        options.sourceRoot = boost::filesystem::absolute(_source.path());
+        options.destinationRoot = boost::filesystem::absolute(_destination.path());
+        options.numThreads = 4;
+        options.verifyChecksums = verifyChecksums;
+        options.incrementalSinceBasis = incrementalSinceBasis;
+        return BackupBlockCopier(options);
+    }
+
+private:
+    unittest::TempDir _source{"BackupBlockCopierTestSource"};
+    unittest::TempDir _destination{"BackupBlockCopierTestDestination"};
+};
+
+TEST_F(BackupBlockCopierTest, FullCopy) {
+    for (bool verifyChecksums : {false, true}) {
+        const auto first = makeContents(3 * 1024 * 1024 + 17, 'a');
+        const auto second = makeContents(4096, 'A');
+        writeFile(sourcePath("collection-1.wt"), first);
+        writeFile(sourcePath("journal/WiredTigerLog.0000000001"), second);
+
+        std::vector<BackupBlock> blocks{
+            makeBlock("collection-1.wt", 0, first.size(), first.size()),
+            makeBlock("journal/WiredTigerLog.0000000001", 0, 0, second.size())};
+        auto stats = makeCopier(verifyChecksums).copy(blocks);
+        ASSERT_OK(stats.getStatus());
+        ASSERT_EQ(stats.getValue().blocksCopied, 2U);
+        ASSERT_EQ(stats.getValue().bytesCopied, first.size() + second.size());
+
+        ASSERT_EQ(readFile(destinationPath("collection-1.wt")), first);
+        ASSERT_EQ(readFile(destinationPath("journal/WiredTigerLog.0000000001")), second);
+    }
+}
+
+TEST_F(BackupBlockCopierTest, IncrementalCopy) {
+    const std::size_t kBlockSize = 64 * 1024;
+    auto contents = makeContents(8 * kBlockSize, 'a');
+    writeFile(sourcePath("collection-1.wt"), contents);
+    writeFile(sourcePath("index-2.wt"), contents);
+    writeFile(destinationPath("collection-1.wt"), contents);
+    writeFile(destinationPath("index-2.wt"), contents);
+
+    // Change two blocks and grow the collection file by a third one. The index is unchanged.
+    auto changed = contents;
+    changed.replace(kBlockSize, kBlockSize, makeContents(kBlockSize, 'A'));
+    changed.replace(5 * kBlockSize, kBlockSize, makeContents(kBlockSize, '0'));
+    changed += makeContents(kBlockSize, 'z');
+    writeFile(sourcePath("collection-1.wt"), changed);
+
+    std::vector<BackupBlock> blocks{
+        makeBlock("collection-1.wt", kBlockSize, kBlockSize, changed.size()),
+        makeBlock("collection-1.wt", 5 * kBlockSize, kBlockSize, changed.size()),
+        makeBlock("collection-1.wt", 8 * kBlockSize, kBlockSize, changed.size()),
+        makeBlock("index-2.wt", 0, 0, contents.size())};
+    auto stats = makeCopier(true, true /* incrementalSinceBasis */).copy(blocks);
+    ASSERT_OK(stats.getStatus());
+    ASSERT_EQ(stats.getValue().bytesCopied, 3 * kBlockSize);
+
+    ASSERT_EQ(readFile(destinationPath("collection-1.wt")), changed);
+    ASSERT_EQ(readFile(destinationPath("index-2.wt")), contents);
+}
+
+TEST_F(BackupBlockCopierTest, FullCopyReplacesLargerDestinationFiles) {
+    const auto contents = makeContents(4096, 'a');
+    writeFile(sourcePath("collection-1.wt"), contents);
+    writeFile(sourcePath("WiredTiger.turtle"), "");
+    writeFile(destinationPath("collection-1.wt"), makeContents(3 * 4096, 'A'));
+    writeFile(destinationPath("WiredTiger.turtle"), makeContents(4096, 'A'));
+
+    std::vector<BackupBlock> blocks{makeBlock("collection-1.wt", 0, 0, contents.size()),
+                                    makeBlock("WiredTiger.turtle", 0, 0, 0)};
+    ASSERT_OK(makeCopier(false).copy(blocks).getStatus());
+
+    ASSERT_EQ(readFile(destinationPath("collection-1.wt")), contents);
+    ASSERT_EQ(readFile(destinationPath("WiredTiger.turtle")), "");
+}
+
+TEST_F(BackupBlockCopierTest, RejectsFilesOutsideSourceRoot) {
+    std::vector<BackupBlock> blocks{
+        BackupBlock(boost::none, boost::none, "/outside/collection-1.wt", 0, 0, 0)};
+    ASSERT_EQ(makeCopier(true).copy(blocks).getStatus(), ErrorCodes::BadValue);
+}
+
+TEST_F(BackupBlockCopierTest, RejectsParentComponentsAfterTheFirst) {
+    writeFile(sourcePath("collection-1.wt"), makeContents(4096, 'a'));
+    std::vector<BackupBlock> blocks{makeBlock("journal/../../collection-1.wt", 0, 0, 4096)};
+    ASSERT_EQ(makeCopier(true).copy(blocks).getStatus(), ErrorCodes::BadValue);
+}
+
+TEST_F(BackupBlockCopierTest, CanceledCopyFails) {
+    const auto contents = makeContents(4096, 'a');
+    writeFile(sourcePath("collection-1.wt"), contents);
+
+    CancellationSource cancellationSource;
+    cancellationSource.cancel();
+    std::vector<BackupBlock> blocks{makeBlock("collection-1.wt", 0, 0, contents.size())};
+    ASSERT_EQ(makeCopier(false).copy(blocks, cancellationSource.token()).getStatus(),
+              ErrorCodes::CallbackCanceled);
+}
+
+TEST_F(BackupBlockCopierTest, MissingSourceFileFails) {
+    std::vector<BackupBlock> blocks{makeBlock("collection-1.wt", 0, 0, 0)};
+    ASSERT_EQ(makeCopier(true).copy(blocks).getStatus(), ErrorCodes::FileOpenFailed);
+}
+#endif
+
+class BackupBlockCopierDestinationTest : public unittest::Test {
+protected:
+    boost::filesystem::path root() const {
+        return boost::filesystem::canonical(boost::filesystem::absolute(_root.path()));
+    }
+
+    boost::filesystem::path makeDirectory(const std::string& name) const {
+        auto path = root() / name;
+        boost::filesystem::create_directories(path);
+        return path;
+    }
+
+private:
+    unittest::TempDir _root{"BackupBlockCopierDestinationTest"};
+};
+
+TEST_F(BackupBlockCopierDestinationTest, AcceptsDirectoryBesideDbpath) {
+    auto dbpath = makeDirectory("db");
+    auto destination = makeDirectory("backup");
+    auto resolved = BackupBlockCopier::resolveDestinationRoot(destination / "." / "", dbpath);
+    ASSERT_OK(resolved.getStatus());
+    ASSERT_EQ(resolved.getValue(), destination);
+}
+
+TEST_F(BackupBlockCopierDestinationTest, RejectsDbpathItsDescendantsAndAncestors) {
+    auto dbpath = makeDirectory("db");
+    makeDirectory("db/journal");
+    for (const auto& destination :
+         {dbpath, dbpath / "journal", dbpath / "journal" / "..", root(), root() / "db" / ".."}) {
+        ASSERT_EQ(BackupBlockCopier::resolveDestinationRoot(destination, dbpath).getStatus(),
+                  ErrorCodes::InvalidOptions);
+    }
+}
+
+TEST_F(BackupBlockCopierDestinationTest, RejectsRelativePaths) {
+    auto dbpath = makeDirectory("db");
+    ASSERT_EQ(BackupBlockCopier::resolveDestinationRoot("backup", dbpath).getStatus(),
+              ErrorCodes::InvalidOptions);
+}
+
+TEST_F(BackupBlockCopierDestinationTest, RequiresAnExistingDirectory) {
+    auto dbpath = makeDirectory("db");
+    ASSERT_EQ(BackupBlockCopier::resolveDestinationRoot(root() / "missing", dbpath).getStatus(),
+              ErrorCodes::NonExistentPath);
+
+    auto file = root() / "file";
+    std::ofstream(file.string()) << "contents";
+    ASSERT_EQ(BackupBlockCopier::resolveDestinationRoot(file, dbpath).getStatus(),
+              ErrorCodes::NonExistentPath);
+}
+
+}  // namespace
+}  // namespace mongo
@@ -45,6 +45,8 @@ struct AutoCompactOptions {
     bool runOnce = false;
     // Minimum amount of MB to reclaim for compaction to proceed.
     boost::optional<int64_t> freeSpaceTargetMB;
+    // Maximum time to spend compacting a single file before moving on to the next one.
+    boost::optional<int64_t> timeSliceSecs;
     // Idents that are skipped by background compaction.
     std::vector<StringData> excludedIdents;
 };
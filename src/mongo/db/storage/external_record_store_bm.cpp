@@ -0,0 +1,128 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/column/bsoncolumnbuilder.h"
+#include "mongo/db/catalog/virtual_collection_options.h"
+#include "mongo/db/pipeline/external_data_source_option_gen.h"
+#include "mongo/db/storage/multi_bson_stream_cursor.h"
+#include "mongo/db/storage/named_pipe.h"
+#include "mongo/stdx/thread.h"
+
+namespace mongo {
+namespace {
+
+constexpr int kNumDocs = 100'000;
+constexpr int kDocsPerBatch = 1000;
+
+BSONObj makeDoc(int i) {
+    return BSON("_id" << i << "ts" << 1'700'000'000'000LL + i << "value" << i % 100);
+}
+
+// The documents of 'makeDoc()', as plain BSON objects or as BSONColumn batches.
+std::vector<BSONObj> makeStreamObjs(FileTypeEnum fileType) {
+    std::vector<BSONObj> objs;
+    if (fileType == FileTypeEnum::bson) {
+        for (int i = 0; i < kNumDocs; ++i) {
+            objs.push_back(makeDoc(i));
+        }
+        return objs;
+    }
+
+    for (int batchStart = 0; batchStart < kNumDocs; batchStart += kDocsPerBatch) {
+        BSONColumnBuilder<> columns[3];
+        for (int i = batchStart; i < batchStart + kDocsPerBatch; ++i) {
+            int fieldIdx = 0;
+            for (auto&& field : makeDoc(i)) {
+                columns[fieldIdx++].append(field);
+            }
+        }
+        BSONObjBuilder batch;
+        batch.append("_id", columns[0].finalize());
+        batch.append("ts", columns[1].finalize());
+        batch.append("value", columns[2].finalize());
+        objs.push_back(batch.obj());
+    }
+    return objs;
+}
+
+// Measures reading the same documents from a named pipe through MultiBsonStreamCursor.
+void BM_MultiBsonStreamCursorRead(benchmark::State& state, FileTypeEnum fileType) {
+    const auto objs = makeStreamObjs(fileType);
+    const std::string pipePath = "ERSBench_MultiBsonStreamCursorReadPipe";
+
+    size_t bytesPerIteration = 0;
+    for (auto&& obj : objs) {
+        bytesPerIteration += obj.objsize();
+    }
+
+    VirtualCollectionOptions vopts;
+    vopts.dataSources.emplace_back(
+        ExternalDataSourceMetadata::kUrlProtocolFile + pipePath, StorageTypeEnum::pipe, fileType);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        NamedPipeOutput pipeWriter(pipePath);
+        stdx::thread producer([&] {
+            pipeWriter.open();
+            for (auto&& obj : objs) {
+                pipeWriter.write(obj.objdata(), obj.objsize());
+            }
+            pipeWriter.close();
+        });
+        state.ResumeTiming();
+
+        MultiBsonStreamCursor cursor(vopts);
+        int docsRead = 0;
+        while (auto record = cursor.next()) {
+            benchmark::DoNotOptimize(record->data.data());
+            ++docsRead;
+        }
+
+        state.PauseTiming();
+        producer.join();
+        if (docsRead != kNumDocs) {
+            state.SkipWithError("Unexpected number of documents read");
+        }
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * kNumDocs);
+    state.SetBytesProcessed(state.iterations() * bytesPerIteration);
+}
+
+BENCHMARK_CAPTURE(BM_MultiBsonStreamCursorRead, Bson, FileTypeEnum::bson);
+BENCHMARK_CAPTURE(BM_MultiBsonStreamCursorRead, BsonColumn, FileTypeEnum::bsonColumn);
+
+}  // namespace
+}  // namespace mongo
@@ -45,12 +45,14 @@
 #include "mongo/bson/bsonmisc.h"
 #include "mongo/bson/bsonobj.h"
 #include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/column/bsoncolumnbuilder.h"
 #include "mongo/db/catalog/virtual_collection_options.h"
 #include "mongo/db/pipeline/external_data_source_option_gen.h"
 #include "mongo/db/record_id.h"
 #include "mongo/db/storage/input_stream.h"
 #include "mongo/db/storage/multi_bson_stream_cursor.h"
 #include "mongo/db/storage/named_pipe.h"
+#include "mongo/db/storage/read_ahead_input_stream.h"
 #include "mongo/db/storage/record_data.h"
 #include "mongo/db/storage/record_store.h"
 #include "mongo/platform/random.h"
@@ -585,4 +587,141 @@ TEST_F(ExternalRecordStoreTest, NamedPipeMultiplePipes4) {
     ASSERT_EQ(objsRead, objsWritten)
         << "Expected objsRead == {} but got {}"_format(objsWritten, objsRead);
 }
+
+// Tests that a ReadAheadInputStream returns the stream's bytes unchanged even when reads straddle
+// the chunks it reads ahead, and reports EOF once the stream is exhausted.
+TEST_F(ExternalRecordStoreTest, ReadAheadInputStreamReadsAcrossChunks) {
+    const int kNumObjs = 1000;
+    std::vector<BSONObj> bsonObjs = {BSON("a" << 1), BSON("bb" << getRandomString(37))};
+    PipeWaiter pw;
+    const auto pipePath = "ERSTest_ReadAheadInputStreamReadsAcrossChunksPipe";
+    stdx::thread producer(createNamedPipe, &pw, pipePath, kNumObjs, bsonObjs);
+    ON_BLOCK_EXIT([&] { producer.join(); });
+
+    pw.wait();
+
+    // A chunk size not dividing the object sizes makes most objects span two chunks.
+    ReadAheadInputStream<NamedPipeInput> inputStream(7, pipePath);
+    for (int i = 0; i < kNumObjs; ++i) {
+        const auto& srcBsonObj = bsonObjs[i % bsonObjs.size()];
+        auto count = srcBsonObj.objsize();
+        int nRead = inputStream.readBytes(count, _buffer);
+        ASSERT_EQ(nRead, count) << "Failed to read data up to {} bytes"_format(count);
+        ASSERT_EQ(std::memcmp(srcBsonObj.objdata(), _buffer, count), 0)
+            << "Read data is not same as the source data";
+    }
+    ASSERT_EQ(inputStream.readBytes(kBufferSize, _buffer), 0);
+}
+
+#ifndef _WIN32
+// Tests that a ReadAheadInputStream hands over data as soon as it arrives rather than waiting for a
+// full chunk, and that destroying it does not wait for a stalled producer to write or close.
+TEST_F(ExternalRecordStoreTest, ReadAheadInputStreamDoesNotWaitForStalledProducer) {
+    auto srcBsonObj = BSON("a" << 1);
+    auto count = srcBsonObj.objsize();
+    PipeWaiter pw;
+    PipeWaiter consumerDone;
+    const auto pipePath = "ERSTest_ReadAheadInputStreamDoesNotWaitForStalledProducerPipe";
+    stdx::thread producer([&] {
+        NamedPipeOutput pipeWriter(pipePath);
+        pw.notify();
+        pipeWriter.open();
+
+        // Writes much less than a chunk, but more than the output stream buffers so that some of
+        // it reaches the pipe, and keeps the pipe open until the consumer is done.
+        for (int i = 0; i < 1000; ++i) {
+            pipeWriter.write(srcBsonObj.objdata(), count);
+        }
+        consumerDone.wait();
+
+        pipeWriter.close();
+    });
+    ON_BLOCK_EXIT([&] { producer.join(); });
+    // Runs before the join above, after the stream below has been destroyed.
+    ON_BLOCK_EXIT([&] { consumerDone.notify(); });
+
+    pw.wait();
+
+    {
+        ReadAheadInputStream<NamedPipeInput> inputStream(
+            ReadAheadInputStream<NamedPipeInput>::kDefaultChunkSize, pipePath);
+        ASSERT_EQ(inputStream.readBytes(count, _buffer), count);
+        ASSERT_EQ(std::memcmp(srcBsonObj.objdata(), _buffer, count), 0)
+            << "Read data is not same as the source data";
+    }
+}
+#endif
+
+// Tests reading a pipe of BSONColumn batches followed by a pipe of plain BSON objects with a
+// MultiBsonStreamCursor.
+TEST_F(ExternalRecordStoreTest, NamedPipeColumnarBatches) {
+    const int kNumBatches = 3;
+    const int kDocsPerBatch = 100;
+
+    // Each batch has an "a" column with a value for each document and a "b" column with a value for
+    // every other document only.
+    std::vector<BSONObj> expectedDocs;
+    std::vector<BSONObj> batches;
+    for (int batchIdx = 0; batchIdx < kNumBatches; ++batchIdx) {
+        BSONColumnBuilder<> aColumn;
+        BSONColumnBuilder<> bColumn;
+        for (int i = 0; i < kDocsPerBatch; ++i) {
+            const int docIdx = batchIdx * kDocsPerBatch + i;
+            BSONObjBuilder doc;
+            doc.append("a", docIdx);
+            aColumn.append(BSON("" << docIdx).firstElement());
+            if (i % 2 == 0) {
+                doc.append("b", "value{}"_format(docIdx));
+                bColumn.append(BSON("" << "value{}"_format(docIdx)).firstElement());
+            } else {
+                bColumn.skip();
+            }
+            expectedDocs.push_back(doc.obj());
+        }
+        BSONObjBuilder batch;
+        batch.append("a", aColumn.finalize());
+        batch.append("b", bColumn.finalize());
+        batches.push_back(batch.obj());
+    }
+    std::vector<BSONObj> plainObjs = {BSON("zed" << "two")};
+    const int kNumPlainObjs = 10;
+
+    PipeWaiter pw[kNumPipes];
+    const std::string pipePaths[] = {"ERSTest_NamedPipeColumnarBatchesPipe1",
+                                     "ERSTest_NamedPipeColumnarBatchesPipe2"};
+    stdx::thread pipeThreads[kNumPipes] = {
+        stdx::thread(createNamedPipe, &pw[0], pipePaths[0], kNumBatches, batches),
+        stdx::thread(createNamedPipe, &pw[1], pipePaths[1], kNumPlainObjs, plainObjs)};
+    ON_BLOCK_EXIT([&] {
+        for (int pipeIdx = 0; pipeIdx < kNumPipes; ++pipeIdx) {
+            pipeThreads[pipeIdx].join();
+        }
+    });
+
+    for (int pipeIdx = 0; pipeIdx < kNumPipes; ++pipeIdx) {
+        pw[pipeIdx].wait();
+    }
+
+    VirtualCollectionOptions vopts;
+    vopts.dataSources.emplace_back(ExternalDataSourceMetadata::kUrlProtocolFile + pipePaths[0],
+                                   StorageTypeEnum::pipe,
+                                   FileTypeEnum::bsonColumn);
+    vopts.dataSources.emplace_back(ExternalDataSourceMetadata::kUrlProtocolFile + pipePaths[1],
+                                   StorageTypeEnum::pipe,
+                                   FileTypeEnum::bson);
+    MultiBsonStreamCursor msbc(vopts);
+
+    for (size_t i = 0; i < expectedDocs.size(); ++i) {
+        auto record = msbc.next();
+        ASSERT(record);
+        ASSERT_EQ(record->id.getLong(), static_cast<long>(i));
+        ASSERT_BSONOBJ_EQ(record->data.toBson(), expectedDocs[i]);
+    }
+    for (int i = 0; i < kNumPlainObjs; ++i) {
+        auto record = msbc.next();
+        ASSERT(record);
+        ASSERT_BSONOBJ_EQ(record->data.toBson(), plainObjs[0]);
+    }
+    ASSERT_FALSE(msbc.next());
+}
 }  // namespace mongo
@@ -30,6 +30,7 @@
 #pragma once
 
 #include "mongo/util/assert_util.h"
+#include "mongo/util/duration.h"
 
 namespace mongo {
 // This interface represents any low-level input object such as file descriptor or file handle and
@@ -62,6 +63,13 @@ public:
         return doRead(data, count);
     }
 
+    // Waits up to 'timeout' for the input to become readable. Returns true if the next read() will
+    // not block, which includes EOF and errors, and false if the wait timed out.
+    bool waitForData(Milliseconds timeout) {
+        uassert(9886505, "Input must have been opened before waiting for data", isOpen());
+        return doWaitForData(timeout);
+    }
+
     virtual bool isOpen() const = 0;
 
     virtual bool isGood() const = 0;
@@ -76,5 +84,10 @@ protected:
     virtual void doClose() = 0;
 
     virtual int doRead(char* data, int count) = 0;
+
+    // Inputs which cannot wait without reading are always treated as readable.
+    virtual bool doWaitForData(Milliseconds timeout) {
+        return true;
+    }
 };
 }  // namespace mongo
@@ -110,6 +110,33 @@ public:
         return -1;
     }
 
+    /**
+     * Reads at most 'count' bytes into the caller-provided 'buffer', returning as soon as any bytes
+     * are available instead of waiting for all 'count' of them. Returns 0 at EOF and -1 on error.
+     * Pair with waitForData() to avoid blocking when the input has nothing to read.
+     */
+    int readSomeBytes(int count, char* buffer) {
+        tassert(9886506, "Number of bytes to read must be greater than 0", count > 0);
+
+        if (MONGO_likely(InputT::isGood())) {
+            const int nRead = InputT::read(buffer, count);
+            if (MONGO_likely(nRead > 0)) {
+                return nRead;
+            }
+        }
+
+        if (InputT::isEof()) {
+            return 0;
+        }
+
+        tassert(9886507, "Expected an error condition but succeeded", InputT::isFailed());
+        LOGV2_ERROR(9886508,
+                    "Failed to read a named pipe",
+                    "error"_attr = getErrorMessage("read", InputT::getAbsolutePath()));
+
+        return -1;
+    }
+
 private:
     // Hides InputT::read() so that readBytes() is the external interface for reading.
     using InputT::read;
@@ -41,6 +41,8 @@
 #include "mongo/base/data_view.h"
 #include "mongo/base/error_codes.h"
 #include "mongo/base/string_data.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/bsontypes.h"
 #include "mongo/bson/util/builder.h"
 #include "mongo/db/catalog/virtual_collection_options.h"
 #include "mongo/db/storage/record_data.h"
@@ -75,9 +77,9 @@ void MultiBsonStreamCursor::expandBuffer(int32_t bsonSize) {
 }
 
 /**
- * Returns the next record from the current stream or boost::none if exhausted or error.
+ * Returns the next BSON object from the current stream or boost::none if exhausted or error.
  */
-boost::optional<Record> MultiBsonStreamCursor::nextFromCurrentStream() {
+boost::optional<RecordData> MultiBsonStreamCursor::nextFromCurrentStream() {
     int32_t bsonSize;  // size of the next BSON object
     int readBytes;     // number of bytes just read
     int remBytes;      // number of remainder bytes to read for either size field or object body
@@ -151,12 +153,74 @@ boost::optional<Record> MultiBsonStreamCursor::nextFromCurrentStream() {
 
     // All cases are now collapsed to Case 1: the full object is in the buffer at '_bufBegin'.
     // 'recordData.data' includes the size in the first four bytes.
-    boost::optional<RecordData> recordData = RecordData{(_buffer.get() + _bufBegin), bsonSize};
+    RecordData recordData{(_buffer.get() + _bufBegin), bsonSize};
     _bufBegin += bsonSize;
     tassert(
         6968307, "_bufBegin {} > _bufSize {}"_format(_bufBegin, _bufSize), (_bufBegin <= _bufSize));
 
-    return {{RecordId{_nextRecordId++}, std::move(*recordData)}};
+    return recordData;
+}
+
+/**
+ * Returns the next document from the current stream of BSONColumn batches or boost::none if
+ * exhausted or error. Each batch is a BSON object whose fields are BSONColumn binaries of the same
+ * length, the i-th document of the batch having the i-th element of each column as its field of
+ * that name. Skipped elements leave the field out of the document.
+ */
+boost::optional<RecordData> MultiBsonStreamCursor::nextFromCurrentColumnarStream() {
+    while (_batchPos == _batchOffsets.size()) {
+        auto batch = nextFromCurrentStream();
+        if (!batch) {
+            return boost::none;
+        }
+        decodeBatch(batch->toBson());
+    }
+
+    BSONObj doc(_batchBuf.buf() + _batchOffsets[_batchPos++]);
+    return RecordData{doc.objdata(), doc.objsize()};
+}
+
+/**
+ * Replaces the documents in '_batchBuf' with those of the BSONColumn batch 'batch'. Each column is
+ * decompressed as a whole with the block-based decoder, and the documents are then assembled row by
+ * row, back to back in '_batchBuf', so that a batch costs no allocation per document.
+ */
+void MultiBsonStreamCursor::decodeBatch(const BSONObj& batch) {
+    boost::intrusive_ptr<BSONElementStorage> allocator{new BSONElementStorage()};
+    std::vector<StringData> fieldNames;
+    std::vector<std::vector<BSONElement>> columns;
+    for (auto&& field : batch) {
+        uassert(9886502,
+                "Field '{}' of a columnar batch in {} is not a BSONColumn"_format(
+                    field.fieldNameStringData(), _vopts.dataSources[_streamIdx].url),
+                field.type() == BinData && field.binDataType() == BinDataType::Column);
+        fieldNames.push_back(field.fieldNameStringData());
+
+        int size = 0;
+        const char* data = field.binData(size);
+        bsoncolumn::BSONColumnBlockBased column(data, size);
+        column.decompress<bsoncolumn::BSONElementMaterializer>(columns.emplace_back(), allocator);
+        uassert(9886503,
+                "Columns of a columnar batch in {} have different lengths"_format(
+                    _vopts.dataSources[_streamIdx].url),
+                columns.back().size() == columns.front().size());
+    }
+
+    _batchBuf.reset();
+    _batchOffsets.clear();
+    _batchPos = 0;
+    const size_t numRows = columns.empty() ? 0 : columns.front().size();
+    for (size_t row = 0; row < numRows; ++row) {
+        _batchOffsets.push_back(_batchBuf.len());
+        BSONObjBuilder doc(_batchBuf);
+        for (size_t i = 0; i < columns.size(); ++i) {
+            // Skipped elements are materialized as EOO.
+            if (!columns[i][row].eoo()) {
+                doc.appendAs(columns[i][row], fieldNames[i]);
+            }
+        }
+        doc.done();
+    }
 }
 
 /**
@@ -164,7 +228,7 @@ boost::optional<Record> MultiBsonStreamCursor::nextFromCurrentStream() {
  *
  * While creating an input stream, it strips off the file protocol part from the 'url'.
  */
-std::unique_ptr<InputStream<NamedPipeInput>> MultiBsonStreamCursor::getInputStream(
+std::unique_ptr<ReadAheadInputStream<NamedPipeInput>> MultiBsonStreamCursor::getInputStream(
     const std::string& url) {
     auto filePathPos = url.find(ExternalDataSourceMetadata::kUrlProtocolFile.toString());
     tassert(
@@ -173,7 +237,8 @@ std::unique_ptr<InputStream<NamedPipeInput>> MultiBsonStreamCursor::getInputStre
     auto filePathStr =
         url.substr(filePathPos + ExternalDataSourceMetadata::kUrlProtocolFile.size());
 
-    return std::make_unique<InputStream<NamedPipeInput>>(filePathStr);
+    return std::make_unique<ReadAheadInputStream<NamedPipeInput>>(
+        ReadAheadInputStream<NamedPipeInput>::kDefaultChunkSize, filePathStr);
 }
 
 /**
@@ -182,9 +247,11 @@ std::unique_ptr<InputStream<NamedPipeInput>> MultiBsonStreamCursor::getInputStre
  */
 boost::optional<Record> MultiBsonStreamCursor::next() {
     while (_streamIdx < _numStreams) {
-        auto record = nextFromCurrentStream();
-        if (MONGO_likely(record)) {
-            return record;
+        auto recordData = _vopts.dataSources[_streamIdx].fileType == FileTypeEnum::bsonColumn
+            ? nextFromCurrentColumnarStream()
+            : nextFromCurrentStream();
+        if (MONGO_likely(recordData)) {
+            return {{RecordId{_nextRecordId++}, std::move(*recordData)}};
         }
         ++_streamIdx;
         if (_streamIdx < _numStreams) {
@@ -39,11 +39,14 @@
 #include <boost/optional/optional.hpp>
 #include <fmt/format.h>
 
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/column/bsoncolumn.h"
+#include "mongo/bson/util/builder.h"
 #include "mongo/db/catalog/virtual_collection_options.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/record_id.h"
-#include "mongo/db/storage/input_stream.h"
 #include "mongo/db/storage/named_pipe.h"
+#include "mongo/db/storage/read_ahead_input_stream.h"
 #include "mongo/db/storage/record_store.h"
 #include "mongo/util/assert_util.h"
 
@@ -84,8 +87,11 @@ public:
 
 private:
     void expandBuffer(int32_t bsonSize);
-    boost::optional<Record> nextFromCurrentStream();
-    static std::unique_ptr<InputStream<NamedPipeInput>> getInputStream(const std::string& url);
+    boost::optional<RecordData> nextFromCurrentStream();
+    boost::optional<RecordData> nextFromCurrentColumnarStream();
+    void decodeBatch(const BSONObj& batch);
+    static std::unique_ptr<ReadAheadInputStream<NamedPipeInput>> getInputStream(
+        const std::string& url);
 
     // The size in bytes of a BSON object's "size" prefix.
     static constexpr int kSizeSize = static_cast<int>(sizeof(int32_t));
@@ -115,7 +121,14 @@ private:
     int _streamIdx = 0;         // index in' _vopts' of stream being consumed in '_streamReader'
 
     // Reader for the current stream.
-    std::unique_ptr<InputStream<NamedPipeInput>> _streamReader = nullptr;
+    std::unique_ptr<ReadAheadInputStream<NamedPipeInput>> _streamReader = nullptr;
+
+    // Documents decoded from the last BSONColumn batch read, stored back to back, their offsets in
+    // '_batchBuf' and the index of the next one to return. Only used for streams of the
+    // 'bsonColumn' file type.
+    BufBuilder _batchBuf;
+    std::vector<int> _batchOffsets;
+    size_t _batchPos = 0;
 
     const VirtualCollectionOptions& _vopts;  // metadata containing the pipe URLs
 };
@@ -92,11 +92,16 @@ protected:
     void doOpen() override;
     int doRead(char* data, int size) override;
     void doClose() override;
+#ifndef _WIN32
+    bool doWaitForData(Milliseconds timeout) override;
+#endif
 
 private:
     std::string _pipeAbsolutePath;
 #ifndef _WIN32
-    std::ifstream _ifs;
+    int _fd = -1;
+    bool _isEof = false;
+    bool _isFailed = false;
 #else
     HANDLE _pipe;
     bool _isOpen : 1;
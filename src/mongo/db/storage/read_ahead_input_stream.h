@@ -0,0 +1,189 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <utility>
+
+#include "mongo/db/storage/input_stream.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/duration.h"
+
+namespace mongo {
+/**
+ * Double-buffered InputStream: a background thread reads the next large chunk of the underlying
+ * input while the caller consumes the current one, so that reading overlaps with whatever the
+ * caller does with the data.
+ *
+ * readBytes() has the same contract as InputStream::readBytes(). The background thread hands over
+ * whatever the input had available, up to a chunk, rather than waiting for a full chunk, so that a
+ * slow producer does not hold back data that already arrived. It waits for data in short polls and
+ * so notices destruction without the producer writing more data or closing the pipe. (Inputs that
+ * cannot poll, such as pipes on Windows, still finish their current read first.)
+ *
+ * Type requirement: 'InputT' must be usable with InputStream.
+ */
+template <typename InputT>
+class ReadAheadInputStream {
+public:
+    // Large enough for few reads per stream, small enough for the two chunks to be cheap.
+    static constexpr int kDefaultChunkSize = 1024 * 1024;
+
+    // How long the background thread waits for data before checking whether it should exit.
+    static constexpr Milliseconds kShutdownPollInterval{100};
+
+    template <typename... ArgT>
+    explicit ReadAheadInputStream(int chunkSize, ArgT&&... args)
+        : _input(std::forward<ArgT>(args)...),
+          _chunkSize(chunkSize),
+          _current{std::make_unique<char[]>(chunkSize)},
+          _spare{std::make_unique<char[]>(chunkSize)} {
+        tassert(9886500, "Read-ahead chunk size must be greater than 0", chunkSize > 0);
+        _reader = stdx::thread([this] { _readAhead(); });
+    }
+
+    ~ReadAheadInputStream() {
+        {
+            stdx::lock_guard<stdx::mutex> lk(_mutex);
+            _shuttingDown = true;
+        }
+        _cv.notify_all();
+        _reader.join();
+    }
+
+    ReadAheadInputStream(const ReadAheadInputStream&) = delete;
+    ReadAheadInputStream& operator=(const ReadAheadInputStream&) = delete;
+
+    /**
+     * Reads 'count' bytes into the caller-provided 'buffer'. Returns fewer bytes only at EOF, and
+     * -1 on error. See InputStream::readBytes().
+     */
+    int readBytes(int count, char* buffer) {
+        tassert(9886501, "Number of bytes to read must be greater than 0", count > 0);
+
+        int nReadTotal = 0;
+        while (nReadTotal < count) {
+            if (_currentPos == _current.size) {
+                stdx::unique_lock<stdx::mutex> lk(_mutex);
+                _cv.wait(lk, [&] { return _spareFull || _inputEnded; });
+                if (!_spareFull) {
+                    break;  // The input ended and all of it was consumed.
+                }
+                if (_spare.size < 0) {
+                    return -1;
+                }
+                std::swap(_current, _spare);
+                _currentPos = 0;
+                _spareFull = false;
+                lk.unlock();
+                _cv.notify_all();
+                continue;
+            }
+
+            const int nCopy = std::min(count - nReadTotal, _current.size - _currentPos);
+            std::memcpy(buffer + nReadTotal, _current.data.get() + _currentPos, nCopy);
+            _currentPos += nCopy;
+            nReadTotal += nCopy;
+        }
+        return nReadTotal;
+    }
+
+private:
+    struct Chunk {
+        std::unique_ptr<char[]> data;
+        int size = 0;  // number of valid bytes in 'data', or -1 if reading them failed
+    };
+
+    /**
+     * Body of the background thread: fills the spare chunk whenever the caller has taken it, until
+     * the input ends or this object is destroyed.
+     */
+    void _readAhead() {
+        while (true) {
+            char* target;
+            {
+                stdx::unique_lock<stdx::mutex> lk(_mutex);
+                _cv.wait(lk, [&] { return !_spareFull || _shuttingDown; });
+                if (_shuttingDown) {
+                    return;
+                }
+                target = _spare.data.get();
+            }
+
+            // The caller never touches the spare chunk while it is not full, so read without the
+            // mutex held.
+            while (!_input.waitForData(kShutdownPollInterval)) {
+                stdx::lock_guard<stdx::mutex> lk(_mutex);
+                if (_shuttingDown) {
+                    return;
+                }
+            }
+            const int nRead = _input.readSomeBytes(_chunkSize, target);
+
+            {
+                stdx::lock_guard<stdx::mutex> lk(_mutex);
+                if (nRead != 0) {
+                    _spare.size = nRead;
+                    _spareFull = true;
+                }
+                _inputEnded = nRead <= 0;
+            }
+            _cv.notify_all();
+
+            if (nRead <= 0) {
+                return;
+            }
+        }
+    }
+
+    InputStream<InputT> _input;
+    const int _chunkSize;
+
+    // Only accessed by the caller.
+    Chunk _current;
+    int _currentPos = 0;
+
+    stdx::mutex _mutex;
+    stdx::condition_variable _cv;
+
+    // Owned by the background thread while '_spareFull' is false, by the caller otherwise.
+    Chunk _spare;
+    bool _spareFull = false;
+    bool _inputEnded = false;
+    bool _shuttingDown = false;
+
+    stdx::thread _reader;
+};
+}  // namespace mongo
@@ -212,6 +212,13 @@ public:
      */
     virtual void setPrefetching(bool enable) {}
 
+    /**
+     * Hints that this operation is about to scan data sequentially, so that the storage engine may
+     * read pages from disk ahead of its cursors. Unlike setPrefetching(), this may be called at any
+     * time, including with cursors open; the hint takes effect from the next storage transaction.
+     */
+    virtual void setScanPrefetchHint() {}
+
     /**
      * Transitions the active unit of work to the "prepared" state. Must be called after
      * beginUnitOfWork and before calling either abortUnitOfWork or commitUnitOfWork. Must be
@@ -136,6 +136,21 @@ static std::vector<CompiledConfiguration>& makeCompiledConfigurations() {
 
 static std::vector<CompiledConfiguration>& compiledBeginTransactions = makeCompiledConfigurations();
 
+// Begins a transaction at a read timestamp. Enumerating every combination of options as above would
+// not cover the timestamp, so all values are bound at the time of the call instead.
+static CompiledConfiguration compiledBeginTransactionAtReadTimestamp(
+    "WT_SESSION.begin_transaction",
+    "ignore_prepare=%s,roundup_timestamps=(prepared=%d,read=%d),no_timestamp=%d,read_timestamp=%s");
+
+static NoReadTimestamp getNoReadTimestamp(
+    RecoveryUnit::UntimestampedWriteAssertionLevel allowUntimestampedWrite) {
+    if (allowUntimestampedWrite != RecoveryUnit::UntimestampedWriteAssertionLevel::kEnforce ||
+        MONGO_unlikely(allowUntimestampedWrites())) {
+        return NoReadTimestamp::kTrue;
+    }
+    return NoReadTimestamp::kFalse;
+}
+
 WiredTigerBeginTxnBlock::WiredTigerBeginTxnBlock(
     WiredTigerSession* session,
     PrepareConflictBehavior prepareConflictBehavior,
@@ -146,11 +161,7 @@ WiredTigerBeginTxnBlock::WiredTigerBeginTxnBlock(
     invariant(!_rollback);
     _wt_session = _session->getSession();
 
-    NoReadTimestamp no_timestamp = NoReadTimestamp::kFalse;
-    if (allowUntimestampedWrite != RecoveryUnit::UntimestampedWriteAssertionLevel::kEnforce ||
-        MONGO_unlikely(allowUntimestampedWrites())) {
-        no_timestamp = NoReadTimestamp::kTrue;
-    }
+    NoReadTimestamp no_timestamp = getNoReadTimestamp(allowUntimestampedWrite);
 
     int config = getConfigOffset(static_cast<int>(prepareConflictBehavior),
                                  static_cast<int>(roundUpPreparedTimestamps
@@ -166,6 +177,37 @@ WiredTigerBeginTxnBlock::WiredTigerBeginTxnBlock(
     _rollback = true;
 }
 
+WiredTigerBeginTxnBlock::WiredTigerBeginTxnBlock(
+    WiredTigerSession* session,
+    PrepareConflictBehavior prepareConflictBehavior,
+    bool roundUpPreparedTimestamps,
+    RoundUpReadTimestamp roundUpReadTimestamp,
+    RecoveryUnit::UntimestampedWriteAssertionLevel allowUntimestampedWrite,
+    Timestamp readTimestamp)
+    : _session(session) {
+    invariant(!_rollback);
+    invariant(!readTimestamp.isNull());
+    _wt_session = _session->getSession();
+
+    static constexpr const char* ignorePrepareStr[] = {"false", "true", "force"};
+
+    // WiredTiger reads timestamps from configuration strings as hex.
+    char readTimestampStr[(2 * 8 /*bytes in hex*/) + 1 /*nul terminator*/];
+    auto formatted = fmt::format_to_n(
+        readTimestampStr, sizeof(readTimestampStr) - 1, "{:x}", readTimestamp.asULL());
+    *formatted.out = '\0';
+
+    const char* compiled_config = compiledBeginTransactionAtReadTimestamp.bind(
+        _session,
+        ignorePrepareStr[static_cast<int>(prepareConflictBehavior)],
+        static_cast<int64_t>(roundUpPreparedTimestamps),
+        static_cast<int64_t>(roundUpReadTimestamp == RoundUpReadTimestamp::kRound),
+        static_cast<int64_t>(getNoReadTimestamp(allowUntimestampedWrite) == NoReadTimestamp::kTrue),
+        static_cast<const char*>(readTimestampStr));
+    invariantWTOK(_wt_session->begin_transaction(_wt_session, compiled_config), _wt_session);
+    _rollback = true;
+}
+
 WiredTigerBeginTxnBlock::WiredTigerBeginTxnBlock(WiredTigerSession* session, const char* config)
     : _session(session) {
     invariant(!_rollback);
@@ -66,6 +66,19 @@ public:
                             bool roundUpPreparedTimestamps,
                             RoundUpReadTimestamp roundUpReadTimestamp,
                             RecoveryUnit::UntimestampedWriteAssertionLevel allowUntimestampedWrite);
+
+    /**
+     * Begins a transaction which reads at 'readTimestamp', binding the timestamp into a compiled
+     * configuration so that WiredTiger opens the transaction and sets its read timestamp in a
+     * single call. Failing to set the read timestamp is fatal, so callers which need to handle an
+     * invalid read timestamp must use setReadSnapshot() instead.
+     */
+    WiredTigerBeginTxnBlock(WiredTigerSession* session,
+                            PrepareConflictBehavior prepareConflictBehavior,
+                            bool roundUpPreparedTimestamps,
+                            RoundUpReadTimestamp roundUpReadTimestamp,
+                            RecoveryUnit::UntimestampedWriteAssertionLevel allowUntimestampedWrite,
+                            Timestamp readTimestamp);
     WiredTigerBeginTxnBlock(WiredTigerSession* session, const char* config);
     ~WiredTigerBeginTxnBlock();
 
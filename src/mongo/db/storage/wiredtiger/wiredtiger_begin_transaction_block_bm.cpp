@@ -125,7 +125,40 @@ void BM_setTimestamp(benchmark::State& state) {
     }
 }
 
+// Parses the configuration on every call, for comparison with the compiled configurations used by
+// BM_WiredTigerBeginTxnBlockWithArgs.
+void BM_WiredTigerBeginTxnBlockWithConfigString(benchmark::State& state) {
+    WiredTigerTestHelper helper;
+    for (auto _ : state) {
+        WiredTigerBeginTxnBlock beginTxn(
+            helper.session(), "ignore_prepare=true,roundup_timestamps=(prepared=true,read=false)");
+    }
+}
+
+// Begins the transaction and sets its read timestamp in a single call with a compiled
+// configuration, for comparison with BM_setTimestamp.
+void BM_setTimestampWithCompiledConfig(benchmark::State& state) {
+    WiredTigerTestHelper helper;
+    for (auto _ : state) {
+        WiredTigerBeginTxnBlock beginTxn(helper.session(),
+                                         PrepareConflictBehavior::kEnforce,
+                                         false,
+                                         RoundUpReadTimestamp::kNoRoundError,
+                                         RecoveryUnit::UntimestampedWriteAssertionLevel::kEnforce,
+                                         Timestamp(1));
+    }
+}
+
+// Sets the read timestamp with a configuration string that is parsed on every call.
+void BM_setTimestampWithConfigString(benchmark::State& state) {
+    WiredTigerTestHelper helper;
+    for (auto _ : state) {
+        WiredTigerBeginTxnBlock beginTxn(helper.session(), "read_timestamp=1");
+    }
+}
+
 BENCHMARK(BM_WiredTigerBeginTxnBlock);
+BENCHMARK(BM_WiredTigerBeginTxnBlockWithConfigString);
 BENCHMARK_TEMPLATE(BM_WiredTigerBeginTxnBlockWithArgs, PrepareConflictBehavior::kEnforce, false);
 BENCHMARK_TEMPLATE(BM_WiredTigerBeginTxnBlockWithArgs, PrepareConflictBehavior::kEnforce, true);
 BENCHMARK_TEMPLATE(BM_WiredTigerBeginTxnBlockWithArgs,
@@ -141,6 +174,8 @@ BENCHMARK_TEMPLATE(BM_WiredTigerBeginTxnBlockWithArgs,
                    PrepareConflictBehavior::kIgnoreConflictsAllowWrites,
                    true);
 BENCHMARK(BM_setTimestamp);
+BENCHMARK(BM_setTimestampWithCompiledConfig);
+BENCHMARK(BM_setTimestampWithConfigString);
 
 }  // namespace
 }  // namespace mongo
@@ -44,6 +44,10 @@ const char* CompiledConfiguration::getConfig(WiredTigerSession* session) const {
     return (compiled->get(_compileToken));
 }
 
+WT_SESSION* CompiledConfiguration::_getWTSession(WiredTigerSession* session) {
+    return session->getSession();
+}
+
 // -----------------------
 
 
@@ -29,9 +29,15 @@
 
 #pragma once
 
-#include "mongo/base/status.h"
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
 #include <wiredtiger.h>
 
+#include "mongo/base/status.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_error_util.h"
+
 namespace mongo {
 
 class WiredTigerSession;
@@ -46,7 +52,24 @@ public:
 
     const char* getConfig(WiredTigerSession* session) const;
 
+    /**
+     * Returns the compiled configuration with 'args' bound, in order, to its '%d' (int64_t) and
+     * '%s' (const char*) parameters. The values only apply to the next API call on 'session' that
+     * uses this configuration, and bound strings must outlive that call.
+     */
+    template <typename... Args>
+    const char* bind(WiredTigerSession* session, Args... args) const {
+        static_assert(((std::is_same_v<Args, int64_t> || std::is_same_v<Args, const char*>)&&...),
+                      "Only int64_t and const char* values can be bound to a configuration");
+        const char* config = getConfig(session);
+        WT_SESSION* wtSession = _getWTSession(session);
+        invariantWTOK(wtSession->bind_configuration(wtSession, config, args...), wtSession);
+        return config;
+    }
+
 private:
+    static WT_SESSION* _getWTSession(WiredTigerSession* session);
+
     std::string _apiName;
     std::string _config;
     int _compileToken;
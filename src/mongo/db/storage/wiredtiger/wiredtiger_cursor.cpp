@@ -55,6 +55,7 @@ WiredTigerCursor::WiredTigerCursor(WiredTigerRecoveryUnit& ru,
                                    bool allowOverwrite) {
     _tableID = tableID;
     _ru = &ru;
+    _ru->setSessionAffinity(tableID);
     _session = _ru->getSession();
     _isCheckpoint =
         (_ru->getTimestampReadSource() == WiredTigerRecoveryUnit::ReadSource::kCheckpoint);
@@ -479,6 +479,7 @@ WiredTigerKVEngine::WiredTigerKVEngine(const std::string& canonicalName,
             serverGlobalParams.featureCompatibility.acquireFCVSnapshot()) &&
         !_ephemeral) {
         ss << "prefetch=(available=true,default=false),";
+        _prefetchAvailable = true;
     }
 
     ss << WiredTigerCustomizationHooks::get(getGlobalServiceContext())
@@ -636,6 +637,7 @@ void WiredTigerKVEngine::notifyReplStartupRecoveryComplete(RecoveryUnit& ru) {
     AutoCompactOptions options{/*enable=*/true,
                                /*runOnce=*/false,
                                /*freeSpaceTargetMB=*/boost::none,
+                               /*timeSliceSecs=*/boost::none,
                                /*excludedIdents*/ std::vector<StringData>()};
 
     auto status = autoCompact(ru, options);
@@ -2901,7 +2903,9 @@ Status WiredTigerKVEngine::autoCompact(RecoveryUnit& ru, const AutoCompactOption
 
     StringBuilder config;
     if (options.enable) {
-        config << "background=true,timeout=0";
+        // The timeout bounds the time spent on each file, after which compaction moves on to the
+        // next eligible one.
+        config << "background=true,timeout=" << options.timeSliceSecs.value_or(0);
         if (options.freeSpaceTargetMB) {
             config << ",free_space_target=" << std::to_string(*options.freeSpaceTargetMB) << "MB";
         }
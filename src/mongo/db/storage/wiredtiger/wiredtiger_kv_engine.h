@@ -239,6 +239,14 @@ public:
         return _ephemeral;
     }
 
+    /**
+     * Returns whether the connection was opened with pre-fetching available, so that sessions may
+     * enable it.
+     */
+    bool isPrefetchAvailable() const {
+        return _prefetchAvailable;
+    }
+
     void setOldestActiveTransactionTimestampCallback(
         StorageEngine::OldestActiveTransactionTimestampCallback callback) override;
 
@@ -334,6 +342,10 @@ public:
         return &_sessionCache->snapshotManager();
     }
 
+    WiredTigerSessionCache* getSessionCache() const {
+        return _sessionCache.get();
+    }
+
     void setJournalListener(JournalListener* jl) final;
 
     void setStableTimestamp(Timestamp stableTimestamp, bool force) override;
@@ -690,6 +702,7 @@ private:
     mutable stdx::mutex _sizeStorerSyncTrackerMutex;
 
     bool _ephemeral;  // whether we are using the in-memory mode of the WT engine
+    bool _prefetchAvailable = false;
     const bool _inRepairMode;
 
     std::unique_ptr<WiredTigerSessionSweeper> _sessionSweeper;
@@ -29,6 +29,7 @@
 
 #include "mongo/db/storage/wiredtiger/wiredtiger_oplog_manager.h"
 
+#include <algorithm>
 #include <boost/optional/optional.hpp>
 // IWYU pragma: no_include "cxxabi.h"
 #include <limits>
@@ -37,6 +38,8 @@
 #include <string>
 
 #include "mongo/db/client.h"
+#include "mongo/db/commands/server_status_metric.h"
+#include "mongo/db/exec/histogram_server_status_metric.h"
 #include "mongo/db/record_id.h"
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/storage/record_store.h"
@@ -68,6 +71,18 @@ MONGO_FAIL_POINT_DEFINE(WTPauseOplogVisibilityUpdateLoop);
 // the journal.
 const int kDelayMillis = 100;
 
+namespace {
+/**
+ * An element in this histogram is the time, in microseconds, between the earliest commit signaling
+ * the oplog visibility thread and the oplog read timestamp advancing. This includes the batching
+ * delay and the time commits behind an oplog hole wait for the hole to be filled. Reported in
+ * serverStatus as metrics.wiredTiger.oplogVisibilityLagMicros.
+ */
+auto& visibilityLagMicrosHistogram =
+    *MetricBuilder<HistogramServerStatusMetric>{"wiredTiger.oplogVisibilityLagMicros"}.bind(
+        HistogramServerStatusMetric::pow(11, 16, 4));
+}  // namespace
+
 void WiredTigerOplogManager::startVisibilityThread(OperationContext* opCtx,
                                                    RecordStore* oplogRecordStore) {
     invariant(!_isRunning.loadRelaxed());
@@ -142,6 +157,9 @@ void WiredTigerOplogManager::haltVisibilityThread() {
 
 void WiredTigerOplogManager::triggerOplogVisibilityUpdate() {
     stdx::lock_guard<stdx::mutex> lk(_oplogVisibilityStateMutex);
+    if (!_earliestPendingUpdateMicros) {
+        _earliestPendingUpdateMicros = curTimeMicros64();
+    }
     if (!_triggerOplogVisibilityUpdate) {
         _triggerOplogVisibilityUpdate = true;
         _oplogVisibilityThreadCV.notify_one();
@@ -282,6 +300,13 @@ void WiredTigerOplogManager::_updateOplogVisibilityLoop(WiredTigerSessionCache*
         if (newTimestamp > currentVisibleTimestamp) {
             _setOplogReadTimestamp(lk, newTimestamp);
         }
+
+        if (_earliestPendingUpdateMicros) {
+            const long long lagMicros =
+                static_cast<long long>(curTimeMicros64() - _earliestPendingUpdateMicros);
+            visibilityLagMicrosHistogram.increment(static_cast<uint64_t>(std::max(lagMicros, 0LL)));
+            _earliestPendingUpdateMicros = 0;
+        }
         lk.unlock();
 
         // Wake up any awaitData cursors and tell them more data might be visible now.
@@ -136,5 +136,9 @@ private:
     // Incremented when a caller is waiting for more of the oplog to become visible, to avoid update
     // delays for batching.
     int64_t _opsWaitingForOplogVisibilityUpdate = 0;
+
+    // The time, in microseconds, of the earliest trigger which has not been followed by the oplog
+    // read timestamp advancing yet, or 0 if there is none. Used to measure the visibility lag.
+    unsigned long long _earliestPendingUpdateMicros = 0;
 };
 }  // namespace mongo
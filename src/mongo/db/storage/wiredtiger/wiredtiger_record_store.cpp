@@ -551,8 +551,8 @@ void WiredTigerRecordStore::checkSize(OperationContext* opCtx) {
                            "ident"_attr = getIdent());
         sizeRecoveryState(getGlobalServiceContext())
             .markCollectionAsAlwaysNeedsSizeAdjustment(getIdent());
-        _sizeInfo->dataSize.store(0);
-        _sizeInfo->numRecords.store(0);
+        _sizeInfo->setDataSize(0);
+        _sizeInfo->setNumRecords(0);
     }
 
     if (_sizeStorer)
@@ -590,12 +590,12 @@ KeyFormat WiredTigerRecordStore::keyFormat() const {
 }
 
 long long WiredTigerRecordStore::dataSize(OperationContext* opCtx) const {
-    auto dataSize = _sizeInfo->dataSize.load();
+    auto dataSize = _sizeInfo->dataSize();
     return dataSize > 0 ? dataSize : 0;
 }
 
 long long WiredTigerRecordStore::numRecords(OperationContext* opCtx) const {
-    auto numRecords = _sizeInfo->numRecords.load();
+    auto numRecords = _sizeInfo->numRecords();
     return numRecords > 0 ? numRecords : 0;
 }
 
@@ -838,8 +838,8 @@ void WiredTigerRecordStore::reclaimOplog(OperationContext* opCtx) {
     LOGV2(22402,
           "WiredTiger record store oplog truncation finished",
           "pinnedOplogTimestamp"_attr = mayTruncateUpTo,
-          "numRecords"_attr = _sizeInfo->numRecords.load(),
-          "dataSize"_attr = _sizeInfo->dataSize.load(),
+          "numRecords"_attr = _sizeInfo->numRecords(),
+          "dataSize"_attr = _sizeInfo->dataSize(),
           "duration"_attr = Milliseconds(elapsedMillis));
 }
 
@@ -1589,8 +1589,8 @@ void WiredTigerRecordStore::updateStatsAfterRepair(OperationContext* opCtx,
     sizeRecoveryState(getGlobalServiceContext())
         .markCollectionAsAlwaysNeedsSizeAdjustment(getIdent());
 
-    _sizeInfo->numRecords.store(std::max(numRecords, 0ll));
-    _sizeInfo->dataSize.store(std::max(dataSize, 0ll));
+    _sizeInfo->setNumRecords(std::max(numRecords, 0ll));
+    _sizeInfo->setDataSize(std::max(dataSize, 0ll));
 
     // If we have a WiredTigerSizeStorer, but our size info is not currently cached, add it.
     if (_sizeStorer)
@@ -1717,8 +1717,7 @@ void WiredTigerRecordStore::_changeNumRecordsAndDataSize(OperationContext* opCtx
     }
 
     const auto updateAndStoreSizeInfo = [this](int64_t numRecordDiff, int64_t dataSizeDiff) {
-        _sizeInfo->numRecords.addAndFetch(numRecordDiff);
-        _sizeInfo->dataSize.addAndFetch(dataSizeDiff);
+        _sizeInfo->update(numRecordDiff, dataSizeDiff);
 
         if (_sizeStorer)
             _sizeStorer->store(_uri, _sizeInfo);
@@ -1737,7 +1736,7 @@ void WiredTigerRecordStore::_changeNumRecordsAndDataSize(OperationContext* opCtx
 }
 
 void WiredTigerRecordStore::setNumRecords(long long numRecords) {
-    _sizeInfo->numRecords.store(std::max(numRecords, 0ll));
+    _sizeInfo->setNumRecords(std::max(numRecords, 0ll));
 
     if (!_sizeStorer) {
         return;
@@ -1750,7 +1749,7 @@ void WiredTigerRecordStore::setNumRecords(long long numRecords) {
 }
 
 void WiredTigerRecordStore::setDataSize(long long dataSize) {
-    _sizeInfo->dataSize.store(std::max(dataSize, 0ll));
+    _sizeInfo->setDataSize(std::max(dataSize, 0ll));
 
     if (!_sizeStorer) {
         return;
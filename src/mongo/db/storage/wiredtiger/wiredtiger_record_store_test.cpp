@@ -320,6 +320,50 @@ TEST(WiredTigerRecordStoreTest, OplogDurableVisibilityOutOfOrder) {
     ASSERT(!wtrs->isOpHidden_forTest(id2));
 }
 
+/**
+ * Test that a visibility update requested while updates are paused is performed once they are
+ * unpaused, without any further commit or waiter triggering it.
+ */
+TEST(WiredTigerRecordStoreTest, OplogVisibilityUpdateRequestedWhilePausedRunsWhenUnpaused) {
+    ON_BLOCK_EXIT([] { WTPauseOplogVisibilityUpdateLoop.setMode(FailPoint::off); });
+    WTPauseOplogVisibilityUpdateLoop.setMode(FailPoint::alwaysOn);
+
+    std::unique_ptr<RecordStoreHarnessHelper> harnessHelper(newRecordStoreHarnessHelper());
+    std::unique_ptr<RecordStore> rs(harnessHelper->newOplogRecordStore());
+    auto engine = harnessHelper->getEngine();
+
+    auto wtrs = checked_cast<WiredTigerRecordStore*>(rs.get());
+
+    ServiceContext::UniqueOperationContext longLivedOp(harnessHelper->newOperationContext());
+    WriteUnitOfWork uow(longLivedOp.get());
+    RecordId id1 = oplogOrderInsertOplog(longLivedOp.get(), engine, rs, 1);
+
+    RecordId id2;
+    {
+        auto innerClient = harnessHelper->serviceContext()->getService()->makeClient("inner");
+        ServiceContext::UniqueOperationContext opCtx(
+            harnessHelper->newOperationContext(innerClient.get()));
+        WriteUnitOfWork uow(opCtx.get());
+        id2 = oplogOrderInsertOplog(opCtx.get(), engine, rs, 2);
+        uow.commit();
+    }
+
+    uow.commit();
+
+    ASSERT(wtrs->isOpHidden_forTest(id1));
+    ASSERT(wtrs->isOpHidden_forTest(id2));
+
+    WTPauseOplogVisibilityUpdateLoop.setMode(FailPoint::off);
+
+    const auto deadline = Date_t::now() + Seconds(30);
+    while (wtrs->isOpHidden_forTest(id2) && Date_t::now() < deadline) {
+        sleepmillis(10);
+    }
+
+    ASSERT(!wtrs->isOpHidden_forTest(id1));
+    ASSERT(!wtrs->isOpHidden_forTest(id2));
+}
+
 TEST(WiredTigerRecordStoreTest, AppendCustomStatsMetadata) {
     std::unique_ptr<RecordStoreHarnessHelper> harnessHelper = newRecordStoreHarnessHelper();
     std::unique_ptr<RecordStore> rs(harnessHelper->newRecordStore("a.b"));
@@ -32,6 +32,7 @@
 #include <boost/cstdint.hpp>
 #include <fmt/format.h>
 #include <string>
+#include <utility>
 #include <wiredtiger.h>
 
 #include <boost/move/utility_core.hpp>
@@ -57,7 +58,6 @@
 #include "mongo/platform/compiler.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/fail_point.h"
-#include "mongo/util/hex.h"
 #include "mongo/util/stacktrace.h"
 #include "mongo/util/str.h"
 #include "mongo/util/testing_proctor.h"
@@ -158,9 +158,12 @@ void WiredTigerRecoveryUnit::prepareUnitOfWork() {
                 "preparing transaction at time: {prepareTimestamp}",
                 "prepareTimestamp"_attr = _prepareTimestamp);
 
-    const std::string conf = "prepare_timestamp=" + unsignedHex(_prepareTimestamp.asULL());
+    // Set the prepare timestamp directly rather than through a configuration string, which
+    // WiredTiger would have to parse.
+    invariantWTOK(
+        s->timestamp_transaction_uint(s, WT_TS_TXN_TYPE_PREPARE, _prepareTimestamp.asULL()), s);
     // Prepare the transaction.
-    invariantWTOK(s->prepare_transaction(s, conf.c_str()), s);
+    invariantWTOK(s->prepare_transaction(s, nullptr), s);
 }
 
 void WiredTigerRecoveryUnit::doCommitUnitOfWork() {
@@ -176,8 +179,12 @@ void WiredTigerRecoveryUnit::doAbortUnitOfWork() {
 void WiredTigerRecoveryUnit::_ensureSession() {
     if (!_unique_session) {
         invariant(!_session);
-        _unique_session = _sessionCache->getSession();
+        _unique_session =
+            _sessionCache->getSession(std::exchange(_sessionAffinityTableId, boost::none));
         _session = _unique_session.get();
+        // Sessions are released back to the cache with their default configuration, so a new one
+        // does not pre-fetch until the recovery unit configures it.
+        _prefetching = false;
     }
 }
 
@@ -189,6 +196,7 @@ void WiredTigerRecoveryUnit::setPrefetching(bool enable) {
     StringBuilder config;
     config << "prefetch=(enabled=" << (enable ? "true" : "false") << ")";
     session->reconfigure(config.str(), "prefetch=(enabled=false)");
+    _prefetching = enable;
 }
 
 void WiredTigerRecoveryUnit::assertInActiveTxn() const {
@@ -469,6 +477,16 @@ void WiredTigerRecoveryUnit::_txnOpen() {
     ensureSnapshot();
     _ensureSession();
 
+    if (_scanPrefetchHinted && !_prefetching) {
+        auto engine = _sessionCache->getKVEngine();
+        if (engine && engine->isPrefetchAvailable()) {
+            // Ending a transaction resets all of the session's cursors, so reconfiguring it before
+            // beginning the next one cannot lose a cursor position.
+            _session->reconfigure("prefetch=(enabled=true)", "prefetch=(enabled=false)");
+            _prefetching = true;
+        }
+    }
+
     // Only start a timer for transaction's lifetime if we're going to log it.
     if (shouldLog(MONGO_LOGV2_DEFAULT_COMPONENT, kSlowTransactionSeverity)) {
         _timer.reset(new Timer());
@@ -547,14 +565,14 @@ void WiredTigerRecoveryUnit::_txnOpen() {
 }
 
 Timestamp WiredTigerRecoveryUnit::_beginTransactionAtAllDurableTimestamp() {
+    Timestamp txnTimestamp = _sessionCache->getKVEngine()->getAllDurableTimestamp();
+    fassert(50948, !txnTimestamp.isNull());
     WiredTigerBeginTxnBlock txnOpen(_session,
                                     _prepareConflictBehavior,
                                     _optionsUsedToOpenSnapshot.roundUpPreparedTimestamps,
                                     RoundUpReadTimestamp::kRound,
-                                    _untimestampedWriteAssertionLevel);
-    Timestamp txnTimestamp = _sessionCache->getKVEngine()->getAllDurableTimestamp();
-    auto status = txnOpen.setReadSnapshot(txnTimestamp);
-    fassert(50948, status);
+                                    _untimestampedWriteAssertionLevel,
+                                    txnTimestamp);
 
     // Since this is not in a critical section, we might have rounded to oldest between
     // calling getAllDurable and setReadSnapshot.  We need to get the actual read timestamp we
@@ -589,9 +607,8 @@ void WiredTigerRecoveryUnit::_beginTransactionAtLastAppliedTimestamp() {
                                     _prepareConflictBehavior,
                                     _optionsUsedToOpenSnapshot.roundUpPreparedTimestamps,
                                     RoundUpReadTimestamp::kRound,
-                                    _untimestampedWriteAssertionLevel);
-    auto status = txnOpen.setReadSnapshot(_readAtTimestamp);
-    fassert(4847501, status);
+                                    _untimestampedWriteAssertionLevel,
+                                    _readAtTimestamp);
 
     // We might have rounded to oldest between calling setTimestampReadSource and setReadSnapshot.
     // We need to get the actual read timestamp we used.
@@ -654,9 +671,8 @@ Timestamp WiredTigerRecoveryUnit::_beginTransactionAtNoOverlapTimestamp() {
                                     _prepareConflictBehavior,
                                     _optionsUsedToOpenSnapshot.roundUpPreparedTimestamps,
                                     RoundUpReadTimestamp::kRound,
-                                    _untimestampedWriteAssertionLevel);
-    auto status = txnOpen.setReadSnapshot(readTimestamp);
-    fassert(51066, status);
+                                    _untimestampedWriteAssertionLevel,
+                                    readTimestamp);
 
     // We might have rounded to oldest between calling getAllDurable and setReadSnapshot. We
     // need to get the actual read timestamp we used.
@@ -113,6 +113,10 @@ public:
      */
     void setPrefetching(bool enable) override;
 
+    void setScanPrefetchHint() override {
+        _scanPrefetchHinted = true;
+    }
+
     void allowOneUntimestampedWrite() override {
         invariant(!_isActive());
         _untimestampedWriteAssertionLevel =
@@ -175,6 +179,17 @@ public:
 
     WiredTigerSession* getSessionNoTxn();
 
+    /**
+     * Hints that the first cursor of this recovery unit will be opened on the table 'tableId', so
+     * that a session already caching a cursor on it is preferred. Has no effect once a session has
+     * been acquired.
+     */
+    void setSessionAffinity(uint64_t tableId) {
+        if (!_unique_session) {
+            _sessionAffinityTableId = tableId;
+        }
+    }
+
     WiredTigerSessionCache* getSessionCache() {
         return _sessionCache;
     }
@@ -253,6 +268,7 @@ private:
     WiredTigerOplogManager* _oplogManager;  // not owned
     UniqueWiredTigerSession _unique_session;
     WiredTigerSession* _session = nullptr;
+    boost::optional<uint64_t> _sessionAffinityTableId;
     bool _isTimestamped = false;
 
     // Helpers used to keep track of multi timestamp constraint violations on the transaction.
@@ -277,6 +293,11 @@ private:
     // When 'true', data read from disk should not be kept in the storage engine cache.
     bool _readOnce = false;
 
+    // Whether a sequential scan asked for pre-fetching, and whether the current session has it
+    // enabled. The latter is reset whenever a new session is acquired.
+    bool _scanPrefetchHinted = false;
+    bool _prefetching = false;
+
     bool _readSourcePinned = false;
 
     // The behavior of handling prepare conflicts.
@@ -222,6 +222,18 @@ TEST_F(WiredTigerRecoveryUnitTestFixture, SetReadSource) {
     ASSERT_EQ(Timestamp(1, 1), ru1->getPointInTimeReadTimestamp());
 }
 
+TEST_F(WiredTigerRecoveryUnitTestFixture, LastAppliedReadSourceRoundsUpToOldest) {
+    harnessHelper->getEngine()->setOldestTimestamp(Timestamp(5, 1), false);
+
+    ru1->setTimestampReadSource(RecoveryUnit::ReadSource::kLastApplied, Timestamp(2, 1));
+    ru1->preallocateSnapshot();
+    ASSERT_EQ(Timestamp(5, 1), ru1->getPointInTimeReadTimestamp());
+
+    ru2->setTimestampReadSource(RecoveryUnit::ReadSource::kLastApplied, Timestamp(7, 1));
+    ru2->preallocateSnapshot();
+    ASSERT_EQ(Timestamp(7, 1), ru2->getPointInTimeReadTimestamp());
+}
+
 TEST_F(WiredTigerRecoveryUnitTestFixture, NoOverlapReadSource) {
     OperationContext* opCtx1 = clientAndCtx1.second.get();
     OperationContext* opCtx2 = clientAndCtx2.second.get();
@@ -860,6 +872,77 @@ TEST_F(WiredTigerRecoveryUnitTestFixture, ReadOnceCursorsCached) {
     ASSERT(ru->getReadOnce());
 }
 
+TEST_F(WiredTigerRecoveryUnitTestFixture, ScanPrefetchHintKeepsOpenCursorPositions) {
+    auto opCtx = clientAndCtx1.second.get();
+    auto ru = shard_role_details::getRecoveryUnit(opCtx);
+    ASSERT(harnessHelper->getEngine()->isPrefetchAvailable());
+
+    std::unique_ptr<RecordStore> rs(harnessHelper->createRecordStore(opCtx, "test.prefetch"));
+    {
+        WriteUnitOfWork wuow(opCtx);
+        ASSERT_OK(rs->insertRecord(opCtx, "a", 2, Timestamp()).getStatus());
+        ASSERT_OK(rs->insertRecord(opCtx, "b", 2, Timestamp()).getStatus());
+        wuow.commit();
+    }
+
+    // The hint may arrive while a scan is positioned in an open transaction.
+    auto cursor = rs->getCursor(opCtx);
+    auto first = cursor->next();
+    ASSERT(first);
+    ru->setScanPrefetchHint();
+
+    // It is applied when the scan resumes in a new transaction.
+    cursor->save();
+    ru->abandonSnapshot();
+    ASSERT(cursor->restore());
+    auto session = checked_cast<WiredTigerRecoveryUnit*>(ru)->getSessionNoTxn();
+    ASSERT_EQ(session->getUndoConfigStrings().count("prefetch=(enabled=false)"), 1U);
+    auto second = cursor->next();
+    ASSERT(second);
+    ASSERT_GT(second->id, first->id);
+    ASSERT_FALSE(cursor->next());
+}
+
+TEST_F(WiredTigerRecoveryUnitTestFixture, ScanPrefetchHintConfiguresEachSession) {
+    ASSERT(harnessHelper->getEngine()->isPrefetchAvailable());
+    auto isPrefetching = [](WiredTigerRecoveryUnit* ru) {
+        return ru->getSessionNoTxn()->getUndoConfigStrings().count("prefetch=(enabled=false)") ==
+            1;
+    };
+
+    // The session is configured when the next transaction begins.
+    ru1->setScanPrefetchHint();
+    ASSERT_FALSE(isPrefetching(ru1));
+    ru1->getSession();
+    ASSERT(isPrefetching(ru1));
+    ru1->abandonSnapshot();
+
+    // Other recovery units are unaffected.
+    ru2->getSession();
+    ASSERT_FALSE(isPrefetching(ru2));
+    ru2->abandonSnapshot();
+
+    // Replacing the recovery unit releases its session back to the cache with the default
+    // configuration. Its replacement, which may be handed the same session, only configures it
+    // once hinted.
+    auto opCtx = clientAndCtx1.second.get();
+    for (int i = 0; i < 2; ++i) {
+        shard_role_details::setRecoveryUnit(opCtx,
+                                            harnessHelper->newRecoveryUnit(),
+                                            WriteUnitOfWork::RecoveryUnitState::kNotInUnitOfWork);
+        auto ru = checked_cast<WiredTigerRecoveryUnit*>(shard_role_details::getRecoveryUnit(opCtx));
+        ru->getSession();
+        ASSERT_FALSE(isPrefetching(ru));
+        ru->abandonSnapshot();
+
+        ru->setScanPrefetchHint();
+        ru->getSession();
+        ASSERT(isPrefetching(ru));
+        ru->abandonSnapshot();
+    }
+    ru1 = nullptr;
+}
+
 TEST_F(WiredTigerRecoveryUnitTestFixture, CacheMixedOverwrite) {
     auto opCtx = clientAndCtx1.second.get();
     std::unique_ptr<RecordStore> rs(harnessHelper->createRecordStore(opCtx, "test.A"));
@@ -40,6 +40,7 @@
 #include "mongo/db/storage/wiredtiger/wiredtiger_kv_engine.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_oplog_manager.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_server_status.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_util.h"
 #include "mongo/logv2/log.h"
 
@@ -72,6 +73,17 @@ BSONObj WiredTigerServerStatusSection::generateSection(OperationContext* opCtx,
                           Timestamp(engine->getOplogManager()->getOplogReadTimestamp()));
     }
 
+    {
+        auto stats = engine->getSessionCache()->getCursorReuseStats();
+        BSONObjBuilder subsection(bob.subobjStart("cursor reuse"));
+        subsection.append("cached cursor hits", static_cast<long long>(stats.cursorCacheHits));
+        subsection.append("cached cursor misses", static_cast<long long>(stats.cursorCacheMisses));
+        subsection.append("session affinity hits",
+                          static_cast<long long>(stats.sessionAffinityHits));
+        subsection.append("session affinity misses",
+                          static_cast<long long>(stats.sessionAffinityMisses));
+    }
+
     return bob.obj();
 }
 
@@ -28,6 +28,7 @@
  */
 
 
+#include <algorithm>
 #include <cerrno>
 #include <cstdlib>
 
@@ -44,6 +45,7 @@
 #include "mongo/logv2/log_attr.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/duration.h"
+#include "mongo/util/processinfo.h"
 #include "mongo/util/str.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kStorage
@@ -126,12 +128,20 @@ WT_CURSOR* WiredTigerSession::getCachedCursor(uint64_t id, const std::string& co
             WT_CURSOR* c = i->_cursor;
             _cursors.erase(i);
             _cursorsOut++;
+            _cursorCacheHits++;
             return c;
         }
     }
+    _cursorCacheMisses++;
     return nullptr;
 }
 
+bool WiredTigerSession::hasCachedCursor(uint64_t id) const {
+    return std::any_of(_cursors.begin(), _cursors.end(), [id](const auto& cachedCursor) {
+        return cachedCursor._id == id;
+    });
+}
+
 WT_CURSOR* WiredTigerSession::getNewCursor(const std::string& uri, const char* config) {
     WT_CURSOR* cursor = nullptr;
     _openCursor(_session, uri, config, &cursor);
@@ -225,16 +235,50 @@ uint64_t WiredTigerSession::genTableId() {
 
 // -----------------------
 
+namespace {
+/**
+ * Returns the number of session cache partitions: the number of available cores rounded up to a
+ * power of two, so that a thread's home partition can be found with a mask.
+ */
+size_t numSessionCachePartitions() {
+    // getSession() tracks the partitions it finds busy in a 64-bit mask.
+    constexpr size_t kMaxPartitions = 64;
+    const size_t numCores = ProcessInfo::getNumAvailableCores();
+    size_t numPartitions = 1;
+    while (numPartitions < numCores && numPartitions < kMaxPartitions) {
+        numPartitions <<= 1;
+    }
+    return numPartitions;
+}
+
+// The number of most recently used sessions in a partition that are searched for one with affinity
+// to a table. Bounds the time spent holding the partition lock.
+constexpr size_t kMaxSessionAffinityCandidates = 16;
+
+// Threads are assigned home partitions round-robin, in the order in which they first use a session
+// cache.
+AtomicWord<unsigned> nextHomePartition{0};
+thread_local const unsigned threadHomePartition = nextHomePartition.fetchAndAdd(1);
+}  // namespace
+
 WiredTigerSessionCache::WiredTigerSessionCache(WiredTigerKVEngine* engine)
     : WiredTigerSessionCache(engine->getConnection(), engine->getClockSource(), engine) {}
 
 WiredTigerSessionCache::WiredTigerSessionCache(WT_CONNECTION* conn,
                                                ClockSource* cs,
                                                WiredTigerKVEngine* engine)
-    : _conn(conn), _clockSource(cs), _engine(engine) {
+    : _conn(conn),
+      _clockSource(cs),
+      _engine(engine),
+      _numPartitions(numSessionCachePartitions()),
+      _partitions(std::make_unique<Partition[]>(_numPartitions)) {
     uassertStatusOK(_compiledConfigurations.compileAll(_conn));
 }
 
+WiredTigerSessionCache::Partition& WiredTigerSessionCache::_homePartition() {
+    return _partitions[threadHomePartition & (_numPartitions - 1)];
+}
+
 WiredTigerSessionCache::~WiredTigerSessionCache() {
     shuttingDown();
 }
@@ -286,15 +330,23 @@ void WiredTigerSessionCache::notifyPreparedUnitOfWorkHasCommittedOrAborted() {
 
 
 void WiredTigerSessionCache::closeAllCursors(const std::string& uri) {
-    stdx::lock_guard<stdx::mutex> lock(_cacheLock);
-    for (SessionCache::iterator i = _sessions.begin(); i != _sessions.end(); i++) {
-        (*i)->closeAllCursors(uri);
+    for (size_t p = 0; p < _numPartitions; ++p) {
+        auto& partition = _partitions[p];
+        stdx::lock_guard<stdx::mutex> lock(partition.lock);
+        for (auto session : partition.sessions) {
+            session->closeAllCursors(uri);
+        }
     }
 }
 
 size_t WiredTigerSessionCache::getIdleSessionsCount() {
-    stdx::lock_guard<stdx::mutex> lock(_cacheLock);
-    return _sessions.size();
+    size_t count = 0;
+    for (size_t p = 0; p < _numPartitions; ++p) {
+        auto& partition = _partitions[p];
+        stdx::lock_guard<stdx::mutex> lock(partition.lock);
+        count += partition.sessions.size();
+    }
+    return count;
 }
 
 void WiredTigerSessionCache::closeExpiredIdleSessions(int64_t idleTimeMillis) {
@@ -306,14 +358,15 @@ void WiredTigerSessionCache::closeExpiredIdleSessions(int64_t idleTimeMillis) {
     auto cutoffTime = _clockSource->now() - Milliseconds(idleTimeMillis);
     SessionCache sessionsToClose;
 
-    {
-        stdx::lock_guard<stdx::mutex> lock(_cacheLock);
+    for (size_t p = 0; p < _numPartitions; ++p) {
+        auto& partition = _partitions[p];
+        stdx::lock_guard<stdx::mutex> lock(partition.lock);
         // Discard all sessions that became idle before the cutoff time
-        for (auto it = _sessions.begin(); it != _sessions.end();) {
+        for (auto it = partition.sessions.begin(); it != partition.sessions.end();) {
             auto session = *it;
             invariant(session->getIdleExpireTime() != Date_t::min());
             if (session->getIdleExpireTime() < cutoffTime) {
-                it = _sessions.erase(it);
+                it = partition.sessions.erase(it);
                 sessionsToClose.push_back(session);
             } else {
                 ++it;
@@ -332,10 +385,14 @@ void WiredTigerSessionCache::closeAll() {
     // Increment the epoch as we are now closing all sessions with this epoch.
     SessionCache swap;
 
-    {
-        stdx::lock_guard<stdx::mutex> lock(_cacheLock);
-        _epoch.fetchAndAdd(1);
-        _sessions.swap(swap);
+    // Sessions released after the epoch is bumped are deleted instead of being cached, so emptying
+    // every partition afterwards leaves no sessions of the old epoch behind.
+    _epoch.fetchAndAdd(1);
+    for (size_t p = 0; p < _numPartitions; ++p) {
+        auto& partition = _partitions[p];
+        stdx::lock_guard<stdx::mutex> lock(partition.lock);
+        swap.insert(swap.end(), partition.sessions.begin(), partition.sessions.end());
+        partition.sessions.clear();
     }
 
     for (SessionCache::iterator i = swap.begin(); i != swap.end(); i++) {
@@ -347,21 +404,72 @@ bool WiredTigerSessionCache::isEphemeral() {
     return _engine && _engine->isEphemeral();
 }
 
-UniqueWiredTigerSession WiredTigerSessionCache::getSession() {
+UniqueWiredTigerSession WiredTigerSessionCache::getSession(
+    boost::optional<uint64_t> affinityTableId) {
     // We should never be able to get here after _shuttingDown is set, because no new
     // operations should be allowed to start.
     invariant(!(_shuttingDown.load() & kShuttingDownMask));
 
+    // Get the most recently used session so that if we discard sessions, we're discarding older
+    // ones.
+    auto takeSession = [](Partition& partition, SessionCache::iterator it) {
+        WiredTigerSession* cachedSession = *it;
+        partition.sessions.erase(it);
+        // Reset the idle time
+        cachedSession->setIdleExpireTime(Date_t::min());
+        return UniqueWiredTigerSession(cachedSession);
+    };
+
+    auto& home = _homePartition();
     {
-        stdx::lock_guard<stdx::mutex> lock(_cacheLock);
-        if (!_sessions.empty()) {
-            // Get the most recently used session so that if we discard sessions, we're
-            // discarding older ones
-            WiredTigerSession* cachedSession = _sessions.back();
-            _sessions.pop_back();
-            // Reset the idle time
-            cachedSession->setIdleExpireTime(Date_t::min());
-            return UniqueWiredTigerSession(cachedSession);
+        stdx::lock_guard<stdx::mutex> lock(home.lock);
+        if (!home.sessions.empty()) {
+            if (affinityTableId) {
+                // Prefer a recently used session which already caches a cursor on the table. The
+                // erase keeps the remaining sessions ordered by the time they became idle.
+                auto& sessions = home.sessions;
+                const size_t numCandidates =
+                    std::min(sessions.size(), kMaxSessionAffinityCandidates);
+                for (auto it = sessions.end(); it != sessions.end() - numCandidates;) {
+                    --it;
+                    if ((*it)->hasCachedCursor(*affinityTableId)) {
+                        _sessionAffinityHits.fetchAndAddRelaxed(1);
+                        return takeSession(home, it);
+                    }
+                }
+                _sessionAffinityMisses.fetchAndAddRelaxed(1);
+            }
+            return takeSession(home, home.sessions.end() - 1);
+        }
+    }
+
+    // The home partition is empty, so steal a session from another partition. Partitions which are
+    // busy are skipped on the first pass rather than waited on.
+    const size_t homeIndex = &home - _partitions.get();
+    uint64_t busyPartitions = 0;
+    for (size_t i = 1; i < _numPartitions; ++i) {
+        const size_t index = (homeIndex + i) & (_numPartitions - 1);
+        auto& partition = _partitions[index];
+        stdx::unique_lock<stdx::mutex> lock(partition.lock, stdx::try_to_lock);
+        if (!lock.owns_lock()) {
+            busyPartitions |= uint64_t{1} << index;
+        } else if (!partition.sessions.empty()) {
+            return takeSession(partition, partition.sessions.end() - 1);
+        }
+    }
+
+    // Busy partitions are then waited on, so that a new session is only opened when every
+    // partition was found empty. Otherwise contention alone would keep opening sessions, and the
+    // number of cached sessions would grow without bound.
+    for (size_t i = 1; busyPartitions && i < _numPartitions; ++i) {
+        const size_t index = (homeIndex + i) & (_numPartitions - 1);
+        if (!(busyPartitions & (uint64_t{1} << index))) {
+            continue;
+        }
+        auto& partition = _partitions[index];
+        stdx::lock_guard<stdx::mutex> lock(partition.lock);
+        if (!partition.sessions.empty()) {
+            return takeSession(partition, partition.sessions.end() - 1);
         }
     }
 
@@ -376,6 +484,15 @@ void WiredTigerSessionCache::releaseSession(WiredTigerSession* session) {
 
     BlockShutdown blockShutdown(this);
 
+    if (session->_cursorCacheHits) {
+        _cursorCacheHits.fetchAndAddRelaxed(session->_cursorCacheHits);
+        session->_cursorCacheHits = 0;
+    }
+    if (session->_cursorCacheMisses) {
+        _cursorCacheMisses.fetchAndAddRelaxed(session->_cursorCacheMisses);
+        session->_cursorCacheMisses = 0;
+    }
+
     if (isShuttingDown()) {
         // There is a race condition with clean shutdown, where the storage engine is ripped from
         // underneath OperationContexts, which are not "active" (i.e., do not have any locks), but
@@ -413,10 +530,11 @@ void WiredTigerSessionCache::releaseSession(WiredTigerSession* session) {
     session->setIdleExpireTime(_clockSource->now());
 
     if (session->_getEpoch() == currentEpoch) {  // check outside of lock to reduce contention
-        stdx::lock_guard<stdx::mutex> lock(_cacheLock);
+        auto& home = _homePartition();
+        stdx::lock_guard<stdx::mutex> lock(home.lock);
         if (session->_getEpoch() == _epoch.load()) {  // recheck inside the lock for correctness
             returnedToCache = true;
-            _sessions.push_back(session);
+            home.sessions.push_back(session);
         }
     } else
         invariant(session->_getEpoch() < currentEpoch);
@@ -429,6 +547,15 @@ void WiredTigerSessionCache::releaseSession(WiredTigerSession* session) {
     }
 }
 
+WiredTigerSessionCache::CursorReuseStats WiredTigerSessionCache::getCursorReuseStats() const {
+    CursorReuseStats stats;
+    stats.cursorCacheHits = _cursorCacheHits.loadRelaxed();
+    stats.cursorCacheMisses = _cursorCacheMisses.loadRelaxed();
+    stats.sessionAffinityHits = _sessionAffinityHits.loadRelaxed();
+    stats.sessionAffinityMisses = _sessionAffinityMisses.loadRelaxed();
+    return stats;
+}
+
 bool WiredTigerSessionCache::isEngineCachingCursors() {
     return gWiredTigerCursorCacheSize.load() <= 0;
 }
@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <boost/optional/optional.hpp>
 #include <cstddef>
 #include <cstdint>
 #include <list>
@@ -154,6 +155,11 @@ public:
         return _cursors.size();
     }
 
+    /**
+     * Returns true if the cursor cache holds a cursor on the table id 'id', of any configuration.
+     */
+    bool hasCachedCursor(uint64_t id) const;
+
     static uint64_t genTableId();
 
     /**
@@ -223,6 +229,11 @@ private:
 
     Date_t _idleExpireTime;
 
+    // Lookups in the cursor cache since this session was last released into the session cache.
+    // These are folded into the session cache's counters on release.
+    uint64_t _cursorCacheHits = 0;
+    uint64_t _cursorCacheMisses = 0;
+
     // A set that contains the undo config strings for any reconfigurations we might have performed
     // on a session during the lifetime of this recovery unit. We use these to reset the session to
     // its default configuration before returning it to the session cache.
@@ -232,6 +243,16 @@ private:
 /**
  *  This cache implements a shared pool of WiredTiger sessions with the goal to amortize the
  *  cost of session creation and destruction over multiple uses.
+ *
+ *  The pool is split into partitions, each with its own mutex, so that threads getting and
+ *  releasing sessions concurrently do not serialize on a single lock. Every thread is assigned a
+ *  home partition on first use, which it takes sessions from and releases them into. A thread whose
+ *  home partition is empty steals a session from another partition, waiting on partitions which
+ *  are busy, before opening a new one.
+ *
+ *  Callers that know which table they are about to open a cursor on can ask for a session with
+ *  affinity to that table. The most recently used sessions of the home partition are then searched
+ *  for one which already caches a cursor on the table, to avoid the cost of opening a new one.
  */
 class WiredTigerSessionCache {
 public:
@@ -269,12 +290,25 @@ public:
      */
     static bool isEngineCachingCursors();
 
+    /**
+     * Counters describing how often cursors and sessions were reused, reported in serverStatus.
+     */
+    struct CursorReuseStats {
+        uint64_t cursorCacheHits = 0;
+        uint64_t cursorCacheMisses = 0;
+        uint64_t sessionAffinityHits = 0;
+        uint64_t sessionAffinityMisses = 0;
+    };
+
     /**
      * Returns a smart pointer to a previously released session for reuse, or creates a new session.
+     * If 'affinityTableId' is set, a cached session which holds a cursor on that table is preferred
+     * over the most recently used one.
      * This method must only be called while holding the global lock to avoid races with
      * shuttingDown, but otherwise is thread safe.
      */
-    std::unique_ptr<WiredTigerSession, WiredTigerSessionDeleter> getSession();
+    std::unique_ptr<WiredTigerSession, WiredTigerSessionDeleter> getSession(
+        boost::optional<uint64_t> affinityTableId = boost::none);
 
     /**
      * Get a count of idle sessions in the session cache.
@@ -361,6 +395,8 @@ public:
         return &_compiledConfigurations;
     }
 
+    CursorReuseStats getCursorReuseStats() const;
+
 private:
     WT_CONNECTION* _conn;             // not owned
     ClockSource* const _clockSource;  // not owned
@@ -374,9 +410,23 @@ private:
     AtomicWord<unsigned> _shuttingDown{0};
     static const uint32_t kShuttingDownMask = 1 << 31;
 
-    stdx::mutex _cacheLock;
     typedef std::vector<WiredTigerSession*> SessionCache;
-    SessionCache _sessions;
+
+    // A partition of the session pool. Aligned to avoid false sharing between partitions which are
+    // used by different threads.
+    struct alignas(64) Partition {
+        stdx::mutex lock;
+        SessionCache sessions;
+    };
+
+    /**
+     * Returns the partition that the calling thread gets sessions from and releases them into.
+     */
+    Partition& _homePartition();
+
+    // The number of partitions is a power of two.
+    const size_t _numPartitions;
+    std::unique_ptr<Partition[]> _partitions;
 
     // Bumped when all open sessions need to be closed
     AtomicWord<unsigned long long> _epoch;  // atomic so we can check it outside of the lock
@@ -386,6 +436,11 @@ private:
     stdx::condition_variable _prepareCommittedOrAbortedCond;
     AtomicWord<std::uint64_t> _prepareCommitOrAbortCounter{0};
 
+    AtomicWord<std::uint64_t> _cursorCacheHits{0};
+    AtomicWord<std::uint64_t> _cursorCacheMisses{0};
+    AtomicWord<std::uint64_t> _sessionAffinityHits{0};
+    AtomicWord<std::uint64_t> _sessionAffinityMisses{0};
+
     /**
      * Returns a session to the cache for later reuse. If closeAll was called between getting this
      * session and releasing it, the session is directly released. This method is thread safe.
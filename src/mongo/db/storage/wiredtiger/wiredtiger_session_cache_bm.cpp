@@ -0,0 +1,106 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include <wiredtiger.h>
+
+#include "mongo/base/string_data.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_error_util.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
+#include "mongo/unittest/temp_dir.h"
+#include "mongo/util/assert_util_core.h"
+#include "mongo/util/clock_source_mock.h"
+
+namespace mongo {
+namespace {
+
+class WiredTigerConnection {
+public:
+    WiredTigerConnection(StringData dbpath, StringData extraStrings) : _conn(nullptr) {
+        std::stringstream ss;
+        ss << "create,";
+        ss << extraStrings;
+        std::string config = ss.str();
+        int ret = wiredtiger_open(dbpath.toString().c_str(), nullptr, config.c_str(), &_conn);
+        invariant(wtRCToStatus(ret, nullptr));
+    }
+    ~WiredTigerConnection() {
+        _conn->close(_conn, nullptr);
+    }
+    WT_CONNECTION* getConnection() const {
+        return _conn;
+    }
+
+private:
+    WT_CONNECTION* _conn;
+};
+
+class WiredTigerSessionCacheHelper {
+public:
+    WiredTigerSessionCache* sessionCache() {
+        return &_sessionCache;
+    }
+
+private:
+    unittest::TempDir _dbpath{"wt_session_cache_bm"};
+    WiredTigerConnection _connection{_dbpath.path(), ""};
+    ClockSourceMock _clockSource;
+    WiredTigerSessionCache _sessionCache{_connection.getConnection(), &_clockSource};
+};
+
+// Every operation gets a session from the cache when it starts and releases it when it ends, so
+// this measures how the cache scales with the number of concurrent operations.
+void BM_GetAndReleaseSession(benchmark::State& state) {
+    static WiredTigerSessionCacheHelper* helper = nullptr;
+    if (state.thread_index == 0) {
+        helper = new WiredTigerSessionCacheHelper();
+    }
+
+    for (auto _ : state) {
+        auto session = helper->sessionCache()->getSession();
+        benchmark::DoNotOptimize(session.get());
+    }
+
+    if (state.thread_index == 0) {
+        // All threads have released their sessions by now, so this is the number of sessions the
+        // benchmark opened. It should not grow beyond the number of threads.
+        state.counters["sessions"] = helper->sessionCache()->getIdleSessionsCount();
+        delete helper;
+        helper = nullptr;
+    }
+}
+
+BENCHMARK(BM_GetAndReleaseSession)->ThreadRange(1, 64);
+
+}  // namespace
+}  // namespace mongo
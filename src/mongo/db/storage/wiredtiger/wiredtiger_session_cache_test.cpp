@@ -37,6 +37,7 @@
 #include "mongo/db/storage/wiredtiger/wiredtiger_oplog_manager.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_recovery_unit.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/framework.h"
 #include "mongo/unittest/temp_dir.h"
@@ -116,6 +117,74 @@ TEST(WiredTigerSessionCacheTest, CheckSessionCacheCleanup) {
     ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 0U);
 }
 
+TEST(WiredTigerSessionCacheTest, SessionsAreSharedBetweenThreads) {
+    WiredTigerSessionCacheHarnessHelper harnessHelper("");
+    WiredTigerSessionCache* sessionCache = harnessHelper.getSessionCache();
+    WiredTigerSession* released = nullptr;
+    {
+        UniqueWiredTigerSession session = sessionCache->getSession();
+        released = session.get();
+    }
+    ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 1U);
+
+    // A thread with a different home partition reuses the cached session rather than opening a
+    // new one.
+    WiredTigerSession* reused = nullptr;
+    stdx::thread([&] {
+        UniqueWiredTigerSession session = sessionCache->getSession();
+        reused = session.get();
+    }).join();
+    ASSERT_EQUALS(reused, released);
+    ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 1U);
+
+    // Sessions cached by either thread are closed by closeAll().
+    sessionCache->closeAll();
+    ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 0U);
+}
+
+TEST(WiredTigerSessionCacheTest, SessionAffinityPrefersCachedCursor) {
+    WiredTigerSessionCacheHarnessHelper harnessHelper("");
+    WiredTigerSessionCache* sessionCache = harnessHelper.getSessionCache();
+    const std::string uri = "table:affinity";
+    const auto tableId = WiredTigerSession::genTableId();
+
+    WiredTigerSession* withCursor = nullptr;
+    {
+        UniqueWiredTigerSession first = sessionCache->getSession();
+        UniqueWiredTigerSession second = sessionCache->getSession();
+        WT_SESSION* wtSession = first->getSession();
+        ASSERT_OK(wtRCToStatus(
+            wtSession->create(wtSession, uri.c_str(), "key_format=q,value_format=q"), wtSession));
+        first->releaseCursor(tableId, first->getNewCursor(uri), "");
+        withCursor = first.get();
+        // Release the session holding the cursor first, so that it is not the most recently used.
+        first.reset();
+    }
+    ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 2U);
+
+    {
+        UniqueWiredTigerSession session = sessionCache->getSession(tableId);
+        ASSERT_EQUALS(session.get(), withCursor);
+        WT_CURSOR* cursor = session->getCachedCursor(tableId, "");
+        ASSERT(cursor);
+        session->releaseCursor(tableId, cursor, "");
+    }
+
+    auto stats = sessionCache->getCursorReuseStats();
+    ASSERT_EQUALS(stats.sessionAffinityHits, 1U);
+    ASSERT_EQUALS(stats.sessionAffinityMisses, 0U);
+    ASSERT_EQUALS(stats.cursorCacheHits, 1U);
+    ASSERT_EQUALS(stats.cursorCacheMisses, 0U);
+
+    // Without a session caching a cursor on the table, the most recently used session is returned.
+    {
+        UniqueWiredTigerSession session =
+            sessionCache->getSession(WiredTigerSession::genTableId());
+        ASSERT_EQUALS(session.get(), withCursor);
+    }
+    ASSERT_EQUALS(sessionCache->getCursorReuseStats().sessionAffinityMisses, 1U);
+}
+
 TEST(WiredTigerSessionCacheTest, ReleaseCursorDuringShutdown) {
     WiredTigerSessionCacheHarnessHelper harnessHelper("");
     WiredTigerSessionCache* sessionCache = harnessHelper.getSessionCache();
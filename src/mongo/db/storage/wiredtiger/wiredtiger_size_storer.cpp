@@ -30,6 +30,7 @@
 
 #include <absl/container/flat_hash_map.h>
 #include <absl/meta/type_traits.h>
+#include <algorithm>
 #include <utility>
 #include <wiredtiger.h>
 
@@ -49,6 +50,7 @@
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/redaction.h"
 #include "mongo/util/duration.h"
+#include "mongo/util/processinfo.h"
 #include "mongo/util/scopeguard.h"
 #include "mongo/util/timer.h"
 
@@ -56,6 +58,97 @@
 
 
 namespace mongo {
+namespace {
+// Number of contended updates after which a SizeInfo starts using per-thread delta counters.
+constexpr int kContendedUpdatesBeforeStriping = 16;
+
+// Upper bound on the number of delta counters kept by a single SizeInfo.
+constexpr size_t kMaxDeltaStripes = 64;
+
+size_t deltaStripeCount() {
+    static const size_t count = [] {
+        auto cores = static_cast<size_t>(std::max(ProcessInfo::getNumAvailableCores(), 1U));
+        size_t stripes = 1;
+        while (stripes < cores && stripes < kMaxDeltaStripes)
+            stripes <<= 1;
+        return stripes;
+    }();
+    return count;
+}
+
+// Threads are assigned delta counters round-robin, so that threads updating the same SizeInfo
+// concurrently are unlikely to share one.
+size_t deltaStripeForThisThread() {
+    static AtomicWord<unsigned> nextStripe{0};
+    thread_local const size_t stripe = nextStripe.fetchAndAddRelaxed(1);
+    return stripe & (deltaStripeCount() - 1);
+}
+}  // namespace
+
+bool WiredTigerSizeStorer::SizeInfo::_addDetectingContention(AtomicWord<long long>& counter,
+                                                             long long diff) {
+    auto expected = counter.loadRelaxed();
+    if (counter.compareAndSwap(&expected, expected + diff))
+        return false;
+    counter.fetchAndAdd(diff);
+    return true;
+}
+
+long long WiredTigerSizeStorer::SizeInfo::numRecords() const {
+    auto result = _numRecords.load();
+    if (auto deltas = _deltas.load()) {
+        for (size_t i = 0; i < deltaStripeCount(); ++i)
+            result += deltas[i].numRecords.load();
+    }
+    return result;
+}
+
+long long WiredTigerSizeStorer::SizeInfo::dataSize() const {
+    auto result = _dataSize.load();
+    if (auto deltas = _deltas.load()) {
+        for (size_t i = 0; i < deltaStripeCount(); ++i)
+            result += deltas[i].dataSize.load();
+    }
+    return result;
+}
+
+// Setting a value discards the deltas by exchanging each with zero before storing the new base, so
+// an update racing with the set is either discarded with its delta or applied on top of the new
+// value, but never half of each.
+void WiredTigerSizeStorer::SizeInfo::setNumRecords(long long numRecords) {
+    if (auto deltas = _deltas.load()) {
+        for (size_t i = 0; i < deltaStripeCount(); ++i)
+            deltas[i].numRecords.swap(0);
+    }
+    _numRecords.store(numRecords);
+}
+
+void WiredTigerSizeStorer::SizeInfo::setDataSize(long long dataSize) {
+    if (auto deltas = _deltas.load()) {
+        for (size_t i = 0; i < deltaStripeCount(); ++i)
+            deltas[i].dataSize.swap(0);
+    }
+    _dataSize.store(dataSize);
+}
+
+void WiredTigerSizeStorer::SizeInfo::update(long long numRecordsDiff, long long dataSizeDiff) {
+    if (auto deltas = _deltas.load()) {
+        auto& delta = deltas[deltaStripeForThisThread()];
+        delta.numRecords.fetchAndAdd(numRecordsDiff);
+        delta.dataSize.fetchAndAdd(dataSizeDiff);
+        return;
+    }
+
+    bool contended = _addDetectingContention(_numRecords, numRecordsDiff);
+    contended |= _addDetectingContention(_dataSize, dataSizeDiff);
+    if (!contended || _contendedUpdates.addAndFetch(1) != kContendedUpdatesBeforeStriping)
+        return;
+
+    // Exactly one thread observes the threshold being reached, so the delta counters are only
+    // ever allocated once. Updates racing with the allocation still go to the shared counters.
+    _ownedDeltas = std::make_unique<Deltas[]>(deltaStripeCount());
+    _deltas.store(_ownedDeltas.get());
+}
 
 WiredTigerSizeStorer::WiredTigerSizeStorer(WT_CONNECTION* conn, const std::string& storageUri)
     : _conn(conn), _storageUri(storageUri), _tableId(WiredTigerSession::genTableId()) {
@@ -68,7 +161,7 @@ WiredTigerSizeStorer::WiredTigerSizeStorer(WT_CONNECTION* conn, const std::strin
         session.getSession());
 }
 
-void WiredTigerSizeStorer::store(StringData uri, std::shared_ptr<SizeInfo> sizeInfo) {
+void WiredTigerSizeStorer::store(StringData uri, const std::shared_ptr<SizeInfo>& sizeInfo) {
     // If the SizeInfo is still dirty, we're done.
     if (sizeInfo->_dirty.load())
         return;
@@ -86,8 +179,8 @@ void WiredTigerSizeStorer::store(StringData uri, std::shared_ptr<SizeInfo> sizeI
                 2,
                 "WiredTigerSizeStorer::store",
                 "uri"_attr = uri,
-                "numRecords"_attr = sizeInfo->numRecords.load(),
-                "dataSize"_attr = sizeInfo->dataSize.load(),
+                "numRecords"_attr = sizeInfo->numRecords(),
+                "dataSize"_attr = sizeInfo->dataSize(),
                 "entryUseCount"_attr = entry.use_count());
 }
 
@@ -190,8 +283,8 @@ void WiredTigerSizeStorer::flush(bool syncToDisk) {
                 // is dirty and it returns true, the current values of numRecords and dataSize must
                 // still be written back. So, the required order is to clear the dirty flag first.
                 sizeInfo->_dirty.store(false);
-                auto data = BSON("numRecords" << sizeInfo->numRecords.load() << "dataSize"
-                                              << sizeInfo->dataSize.load());
+                auto data = BSON("numRecords" << sizeInfo->numRecords() << "dataSize"
+                                              << sizeInfo->dataSize());
 
                 LOGV2_DEBUG(22425,
                             2,
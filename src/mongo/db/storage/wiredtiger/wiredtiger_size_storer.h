@@ -60,19 +60,54 @@ public:
      * ownership. The SizeInfo may still be updated after it is stored in the SizeStorer.
      * The 'dirty' field is used by the size storer to cheaply merge duplicate stores of the same
      * SizeInfo.
+     *
+     * Updates are applied to a single pair of counters until concurrent updates are observed to
+     * contend on them. From then on, each thread adds its updates to one of several cache-line
+     * sized delta counters, which reads fold into the result. Reads therefore reflect every update
+     * which completed before them.
      */
-    struct SizeInfo {
+    class SizeInfo {
+    public:
         SizeInfo() = default;
-        SizeInfo(long long records, long long size) : numRecords(records), dataSize(size) {}
+        SizeInfo(long long records, long long size) : _numRecords(records), _dataSize(size) {}
 
         ~SizeInfo() {
             invariant(!_dirty.load());
         }
-        AtomicWord<long long> numRecords;
-        AtomicWord<long long> dataSize;
+
+        long long numRecords() const;
+        long long dataSize() const;
+
+        void setNumRecords(long long numRecords);
+        void setDataSize(long long dataSize);
+
+        /**
+         * Adds the given differences to the number of records and the data size.
+         */
+        void update(long long numRecordsDiff, long long dataSizeDiff);
 
     private:
         friend WiredTigerSizeStorer;
+
+        // Delta counters are aligned to avoid false sharing between threads using different ones.
+        struct alignas(64) Deltas {
+            AtomicWord<long long> numRecords;
+            AtomicWord<long long> dataSize;
+        };
+
+        // Adds 'diff' to 'counter', returning whether another thread updated it concurrently.
+        static bool _addDetectingContention(AtomicWord<long long>& counter, long long diff);
+
+        AtomicWord<long long> _numRecords;
+        AtomicWord<long long> _dataSize;
+
+        // Number of updates which found the counters above contended. Only written on contention.
+        AtomicWord<int> _contendedUpdates;
+
+        // Allocated once updates become contended, and never released before destruction.
+        AtomicWord<Deltas*> _deltas{nullptr};
+        std::unique_ptr<Deltas[]> _ownedDeltas;
+
         AtomicWord<bool> _dirty;
     };
 
@@ -83,7 +118,7 @@ public:
      * Ensure that the shared SizeInfo will be stored by the next call to flush.
      * Values stored are no older than the values at time of this call, but may be newer.
      */
-    void store(StringData uri, std::shared_ptr<SizeInfo> sizeInfo);
+    void store(StringData uri, const std::shared_ptr<SizeInfo>& sizeInfo);
 
     /**
      * Returns the size info for the given URI. Creates a default-initialized SizeInfo if there is
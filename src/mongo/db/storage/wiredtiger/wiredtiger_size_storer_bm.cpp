@@ -0,0 +1,107 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <benchmark/benchmark.h>
+#include <limits>
+#include <memory>
+
+#include "mongo/db/storage/wiredtiger/wiredtiger_size_storer.h"
+#include "mongo/platform/atomic_word.h"
+
+namespace mongo {
+namespace {
+
+// Limits of the modeled capped collection, never reached by the benchmarks.
+constexpr long long kCappedSize = std::numeric_limits<long long>::max();
+constexpr long long kCappedMax = std::numeric_limits<long long>::max();
+
+// Models a single collection receiving inserts from many threads, without any striping of the
+// size counters.
+void BM_SizeInfoSharedCounters(benchmark::State& state) {
+    static AtomicWord<long long> numRecords;
+    static AtomicWord<long long> dataSize;
+    for (auto _ : state) {
+        numRecords.addAndFetch(1);
+        dataSize.addAndFetch(100);
+    }
+}
+
+void BM_SizeInfoUpdate(benchmark::State& state) {
+    static std::unique_ptr<WiredTigerSizeStorer::SizeInfo> sizeInfo;
+    if (state.thread_index == 0) {
+        sizeInfo = std::make_unique<WiredTigerSizeStorer::SizeInfo>();
+    }
+
+    for (auto _ : state) {
+        sizeInfo->update(1, 100);
+    }
+
+    if (state.thread_index == 0) {
+        benchmark::DoNotOptimize(sizeInfo->numRecords());
+        sizeInfo.reset();
+    }
+}
+
+// Models inserts into a capped collection, which check the collection's size and count against
+// its limits after every insert, without any striping of the size counters.
+void BM_CappedInsertSharedCounters(benchmark::State& state) {
+    static AtomicWord<long long> numRecords;
+    static AtomicWord<long long> dataSize;
+    for (auto _ : state) {
+        numRecords.addAndFetch(1);
+        dataSize.addAndFetch(100);
+        benchmark::DoNotOptimize(dataSize.load() > kCappedSize || numRecords.load() > kCappedMax);
+    }
+}
+
+// Same as above, with the reads folding in the delta counters once the updates are striped.
+void BM_CappedInsertSizeInfo(benchmark::State& state) {
+    static std::unique_ptr<WiredTigerSizeStorer::SizeInfo> sizeInfo;
+    if (state.thread_index == 0) {
+        sizeInfo = std::make_unique<WiredTigerSizeStorer::SizeInfo>();
+    }
+
+    for (auto _ : state) {
+        sizeInfo->update(1, 100);
+        benchmark::DoNotOptimize(sizeInfo->dataSize() > kCappedSize ||
+                                 sizeInfo->numRecords() > kCappedMax);
+    }
+
+    if (state.thread_index == 0) {
+        sizeInfo.reset();
+    }
+}
+
+BENCHMARK(BM_SizeInfoSharedCounters)->ThreadRange(1, 64);
+BENCHMARK(BM_SizeInfoUpdate)->ThreadRange(1, 64);
+BENCHMARK(BM_CappedInsertSharedCounters)->ThreadRange(1, 64);
+BENCHMARK(BM_CappedInsertSizeInfo)->ThreadRange(1, 64);
+
+}  // namespace
+}  // namespace mongo
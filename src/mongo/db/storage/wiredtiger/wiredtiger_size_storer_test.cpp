@@ -27,11 +27,13 @@
  *    it in the license file.
  */
 
+#include <vector>
 #include <wiredtiger.h>
 
 #include "mongo/db/service_context_test_fixture.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_error_util.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_size_storer.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/temp_dir.h"
 
@@ -65,28 +67,28 @@ TEST_F(WiredTigerSizeStorerTest, Store) {
     auto loaded = sizeStorer1.load(uri);
     ASSERT(loaded);
     ASSERT_EQ(loaded, sizeInfo);
-    ASSERT_EQ(loaded->numRecords.load(), sizeInfo->numRecords.load());
-    ASSERT_EQ(loaded->dataSize.load(), sizeInfo->dataSize.load());
+    ASSERT_EQ(loaded->numRecords(), sizeInfo->numRecords());
+    ASSERT_EQ(loaded->dataSize(), sizeInfo->dataSize());
 
     loaded = sizeStorer2.load(uri);
     ASSERT(loaded);
     ASSERT_NE(loaded, sizeInfo);
-    ASSERT_EQ(loaded->numRecords.load(), 0);
-    ASSERT_EQ(loaded->dataSize.load(), 0);
+    ASSERT_EQ(loaded->numRecords(), 0);
+    ASSERT_EQ(loaded->dataSize(), 0);
 
     sizeStorer1.flush(false);
 
     loaded = sizeStorer1.load(uri);
     ASSERT(loaded);
     ASSERT_NE(loaded, sizeInfo);
-    ASSERT_EQ(loaded->numRecords.load(), sizeInfo->numRecords.load());
-    ASSERT_EQ(loaded->dataSize.load(), sizeInfo->dataSize.load());
+    ASSERT_EQ(loaded->numRecords(), sizeInfo->numRecords());
+    ASSERT_EQ(loaded->dataSize(), sizeInfo->dataSize());
 
     loaded = sizeStorer2.load(uri);
     ASSERT(loaded);
     ASSERT_NE(loaded, sizeInfo);
-    ASSERT_EQ(loaded->numRecords.load(), sizeInfo->numRecords.load());
-    ASSERT_EQ(loaded->dataSize.load(), sizeInfo->dataSize.load());
+    ASSERT_EQ(loaded->numRecords(), sizeInfo->numRecords());
+    ASSERT_EQ(loaded->dataSize(), sizeInfo->dataSize());
 }
 
 TEST_F(WiredTigerSizeStorerTest, RemoveBeforeFlush) {
@@ -99,24 +101,24 @@ TEST_F(WiredTigerSizeStorerTest, RemoveBeforeFlush) {
     auto loaded = sizeStorer.load(uri);
     ASSERT(loaded);
     ASSERT_EQ(loaded, sizeInfo);
-    ASSERT_EQ(loaded->numRecords.load(), sizeInfo->numRecords.load());
-    ASSERT_EQ(loaded->dataSize.load(), sizeInfo->dataSize.load());
+    ASSERT_EQ(loaded->numRecords(), sizeInfo->numRecords());
+    ASSERT_EQ(loaded->dataSize(), sizeInfo->dataSize());
 
     sizeStorer.remove(uri);
 
     loaded = sizeStorer.load(uri);
     ASSERT(loaded);
     ASSERT_NE(loaded, sizeInfo);
-    ASSERT_EQ(loaded->numRecords.load(), 0);
-    ASSERT_EQ(loaded->dataSize.load(), 0);
+    ASSERT_EQ(loaded->numRecords(), 0);
+    ASSERT_EQ(loaded->dataSize(), 0);
 
     sizeStorer.flush(false);
 
     loaded = sizeStorer.load(uri);
     ASSERT(loaded);
     ASSERT_NE(loaded, sizeInfo);
-    ASSERT_EQ(loaded->numRecords.load(), 0);
-    ASSERT_EQ(loaded->dataSize.load(), 0);
+    ASSERT_EQ(loaded->numRecords(), 0);
+    ASSERT_EQ(loaded->dataSize(), 0);
 }
 
 TEST_F(WiredTigerSizeStorerTest, RemoveAfterFlush) {
@@ -130,24 +132,24 @@ TEST_F(WiredTigerSizeStorerTest, RemoveAfterFlush) {
     auto loaded = sizeStorer.load(uri);
     ASSERT(loaded);
     ASSERT_NE(loaded, sizeInfo);
-    ASSERT_EQ(loaded->numRecords.load(), sizeInfo->numRecords.load());
-    ASSERT_EQ(loaded->dataSize.load(), sizeInfo->dataSize.load());
+    ASSERT_EQ(loaded->numRecords(), sizeInfo->numRecords());
+    ASSERT_EQ(loaded->dataSize(), sizeInfo->dataSize());
 
     sizeStorer.remove(uri);
 
     loaded = sizeStorer.load(uri);
     ASSERT(loaded);
     ASSERT_NE(loaded, sizeInfo);
-    ASSERT_EQ(loaded->numRecords.load(), 0);
-    ASSERT_EQ(loaded->dataSize.load(), 0);
+    ASSERT_EQ(loaded->numRecords(), 0);
+    ASSERT_EQ(loaded->dataSize(), 0);
 
     sizeStorer.flush(false);
 
     loaded = sizeStorer.load(uri);
     ASSERT(loaded);
     ASSERT_NE(loaded, sizeInfo);
-    ASSERT_EQ(loaded->numRecords.load(), 0);
-    ASSERT_EQ(loaded->dataSize.load(), 0);
+    ASSERT_EQ(loaded->numRecords(), 0);
+    ASSERT_EQ(loaded->dataSize(), 0);
 }
 
 TEST_F(WiredTigerSizeStorerTest, RemoveNonexistent) {
@@ -160,24 +162,56 @@ TEST_F(WiredTigerSizeStorerTest, RemoveNonexistent) {
     auto loaded = sizeStorer.load(uri);
     ASSERT(loaded);
     ASSERT_NE(loaded, sizeInfo);
-    ASSERT_EQ(loaded->numRecords.load(), 0);
-    ASSERT_EQ(loaded->dataSize.load(), 0);
+    ASSERT_EQ(loaded->numRecords(), 0);
+    ASSERT_EQ(loaded->dataSize(), 0);
 
     sizeStorer.store(uri, sizeInfo);
 
     loaded = sizeStorer.load(uri);
     ASSERT(loaded);
     ASSERT_EQ(loaded, sizeInfo);
-    ASSERT_EQ(loaded->numRecords.load(), sizeInfo->numRecords.load());
-    ASSERT_EQ(loaded->dataSize.load(), sizeInfo->dataSize.load());
+    ASSERT_EQ(loaded->numRecords(), sizeInfo->numRecords());
+    ASSERT_EQ(loaded->dataSize(), sizeInfo->dataSize());
 
     sizeStorer.flush(false);
 
     loaded = sizeStorer.load(uri);
     ASSERT(loaded);
     ASSERT_NE(loaded, sizeInfo);
-    ASSERT_EQ(loaded->numRecords.load(), sizeInfo->numRecords.load());
-    ASSERT_EQ(loaded->dataSize.load(), sizeInfo->dataSize.load());
+    ASSERT_EQ(loaded->numRecords(), sizeInfo->numRecords());
+    ASSERT_EQ(loaded->dataSize(), sizeInfo->dataSize());
+}
+
+TEST(WiredTigerSizeStorerSizeInfoTest, ConcurrentUpdatesAreAccurate) {
+    constexpr int kThreads = 16;
+    constexpr int kUpdatesPerThread = 10000;
+    WiredTigerSizeStorer::SizeInfo sizeInfo(5, 50);
+
+    std::vector<stdx::thread> threads;
+    for (int i = 0; i < kThreads; ++i) {
+        threads.emplace_back([&] {
+            for (int j = 0; j < kUpdatesPerThread; ++j) {
+                sizeInfo.update(1, 10);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(sizeInfo.numRecords(), 5 + kThreads * kUpdatesPerThread);
+    ASSERT_EQ(sizeInfo.dataSize(), 50 + 10 * kThreads * kUpdatesPerThread);
+
+    // Setting the values replaces the result of all prior updates, regardless of where they were
+    // applied.
+    sizeInfo.setNumRecords(3);
+    sizeInfo.setDataSize(30);
+    ASSERT_EQ(sizeInfo.numRecords(), 3);
+    ASSERT_EQ(sizeInfo.dataSize(), 30);
+
+    sizeInfo.update(-1, -10);
+    ASSERT_EQ(sizeInfo.numRecords(), 2);
+    ASSERT_EQ(sizeInfo.dataSize(), 20);
 }
 
 }  // namespace
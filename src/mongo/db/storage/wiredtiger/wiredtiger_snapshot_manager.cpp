@@ -105,9 +105,8 @@ Timestamp WiredTigerSnapshotManager::beginTransactionOnCommittedSnapshot(
                                     prepareConflictBehavior,
                                     roundUpPreparedTimestamps,
                                     RoundUpReadTimestamp::kRound,
-                                    untimestampedWriteAssertion);
-    auto status = txnOpen.setReadSnapshot(committedSnapshot);
-    fassert(30635, status);
+                                    untimestampedWriteAssertion,
+                                    committedSnapshot);
 
     txnOpen.done();
     return committedSnapshot;
@@ -0,0 +1,110 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/transaction/committed_statement_index.h"
+
+#include <limits>
+
+namespace mongo {
+
+std::pair<repl::OpTime, bool> CommittedStatementIndex::insert(StmtId stmtId,
+                                                              const repl::OpTime& opTime) {
+    if (auto existingOpTime = find(stmtId)) {
+        return {*existingOpTime, false};
+    }
+
+    // Bounds of the run 'stmtId' ends up in, after absorbing the adjacent statements written at
+    // the same optime. Since 'stmtId' is not recorded yet, a run holding the statement just below
+    // it must end there, and one holding the statement just above it must start there.
+    StmtId first = stmtId;
+    StmtId last = stmtId;
+    auto runBelow = _runs.end();
+    auto runAbove = _runs.end();
+
+    if (stmtId > std::numeric_limits<StmtId>::min()) {
+        const StmtId below = stmtId - 1;
+        if (auto it = _singleStatements.find(below); it != _singleStatements.end()) {
+            if (it->second == opTime) {
+                first = below;
+                _singleStatements.erase(it);
+            }
+        } else if (auto it = _runs.find(below); it != _runs.end() && it->second.opTime == opTime) {
+            first = it->second.first;
+            runBelow = it;
+        }
+    }
+
+    if (stmtId < std::numeric_limits<StmtId>::max()) {
+        const StmtId above = stmtId + 1;
+        if (auto it = _singleStatements.find(above); it != _singleStatements.end()) {
+            if (it->second == opTime) {
+                last = above;
+                _singleStatements.erase(it);
+            }
+        } else if (auto it = _runs.lower_bound(above); it != _runs.end() &&
+                   it->second.first == above && it->second.opTime == opTime) {
+            last = it->first;
+            runAbove = it;
+        }
+    }
+
+    if (runAbove != _runs.end()) {
+        runAbove->second.first = first;
+        if (runBelow != _runs.end()) {
+            _runs.erase(runBelow);
+        }
+    } else if (runBelow != _runs.end()) {
+        // The key of 'runBelow' grows to 'last', which does not change its position relative to
+        // any other run.
+        auto node = _runs.extract(runBelow);
+        node.key() = last;
+        _runs.insert(std::move(node));
+    } else if (first != last) {
+        _runs.emplace(last, Run{first, opTime});
+    } else {
+        _singleStatements.emplace(stmtId, opTime);
+    }
+
+    ++_numStatements;
+    return {opTime, true};
+}
+
+boost::optional<repl::OpTime> CommittedStatementIndex::find(StmtId stmtId) const {
+    if (auto it = _singleStatements.find(stmtId); it != _singleStatements.end()) {
+        return it->second;
+    }
+
+    auto it = _runs.lower_bound(stmtId);
+    if (it == _runs.end() || it->second.first > stmtId) {
+        return boost::none;
+    }
+    return it->second.opTime;
+}
+
+}  // namespace mongo
@@ -0,0 +1,132 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <absl/container/flat_hash_map.h>
+#include <boost/optional/optional.hpp>
+#include <cstddef>
+#include <map>
+#include <utility>
+
+#include "mongo/db/repl/optime.h"
+#include "mongo/db/session/logical_session_id.h"
+
+namespace mongo {
+
+/**
+ * Records which statements of a retryable write or retryable internal transaction have been
+ * executed, together with the optime of the oplog entry which contains each of them.
+ *
+ * Statements are stored as runs of contiguous statement ids which were written by the same oplog
+ * entry, rather than one entry per statement. A batched retryable write, or a retryable internal
+ * transaction, logs all of its statements in a single applyOps entry with consecutive statement
+ * ids, so rebuilding the history for such a session costs one run per oplog entry instead of one
+ * hash table entry per statement.
+ *
+ * Retryable writes which log one oplog entry per statement only produce runs of one statement.
+ * Those are kept in a hash map, so that such writes pay for a single hash lookup per statement,
+ * exactly as before runs were introduced. Only runs of two or more statements go to an ordered
+ * map which, like IntegerIntervalSet, keys them by their highest statement id so that a lookup is
+ * a single lower_bound.
+ */
+class CommittedStatementIndex {
+public:
+    /**
+     * Records that 'stmtId' was written at 'opTime'. Returns the optime already recorded for
+     * 'stmtId' and false if the statement was already present, or 'opTime' and true otherwise.
+     */
+    std::pair<repl::OpTime, bool> insert(StmtId stmtId, const repl::OpTime& opTime);
+
+    /**
+     * Returns the optime of the oplog entry which wrote 'stmtId', or boost::none if the statement
+     * has not been recorded.
+     */
+    boost::optional<repl::OpTime> find(StmtId stmtId) const;
+
+    /**
+     * Calls 'callback' with the statement id and optime of every recorded statement, in no
+     * particular order.
+     */
+    template <typename Callback>
+    void forEach(Callback&& callback) const {
+        for (const auto& [stmtId, opTime] : _singleStatements) {
+            callback(stmtId, opTime);
+        }
+        for (const auto& [last, run] : _runs) {
+            for (StmtId stmtId = run.first;; ++stmtId) {
+                callback(stmtId, run.opTime);
+                if (stmtId == last) {
+                    break;
+                }
+            }
+        }
+    }
+
+    void clear() {
+        _singleStatements.clear();
+        _runs.clear();
+        _numStatements = 0;
+    }
+
+    bool empty() const {
+        return _singleStatements.empty() && _runs.empty();
+    }
+
+    /**
+     * Returns the number of statements recorded.
+     */
+    std::size_t numStatements() const {
+        return _numStatements;
+    }
+
+    /**
+     * Returns the number of runs the statements are stored as, including runs of one statement.
+     */
+    std::size_t numRuns() const {
+        return _singleStatements.size() + _runs.size();
+    }
+
+private:
+    struct Run {
+        StmtId first;
+        repl::OpTime opTime;
+    };
+
+    // Statements which do not share their optime with an adjacent statement id
+    absl::flat_hash_map<StmtId, repl::OpTime> _singleStatements;
+
+    // Maps the last statement id of each run of two or more statements to the run. Runs never
+    // overlap each other or the single statements.
+    std::map<StmtId, Run> _runs;
+
+    std::size_t _numStatements{0};
+};
+
+}  // namespace mongo
@@ -0,0 +1,116 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <absl/container/flat_hash_map.h>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+#include "mongo/bson/timestamp.h"
+#include "mongo/db/repl/optime.h"
+#include "mongo/db/transaction/committed_statement_index.h"
+
+namespace mongo {
+namespace {
+
+// Returns the optime of the oplog entry which wrote 'stmtId' when every oplog entry holds
+// 'stmtsPerEntry' consecutive statements.
+repl::OpTime opTimeForStmt(int64_t stmtId, int64_t stmtsPerEntry) {
+    return repl::OpTime(Timestamp(100, static_cast<uint32_t>(stmtId / stmtsPerEntry + 1)), 1);
+}
+
+}  // namespace
+
+// First arg is the number of statements in the session's history. Second arg is the number of
+// statements per oplog entry: 1 for plain retryable writes, larger for batched writes and retryable
+// internal transactions. The history is inserted newest first, as when it is rebuilt from the
+// oplog after a failover or migration.
+void BM_RebuildCommittedStatementsHashMap(benchmark::State& state) {
+    const auto numStmts = state.range(0);
+    const auto stmtsPerEntry = state.range(1);
+    for (auto _ : state) {
+        absl::flat_hash_map<StmtId, repl::OpTime> committedStatements;
+        for (auto stmtId = numStmts - 1; stmtId >= 0; --stmtId) {
+            committedStatements.emplace(stmtId, opTimeForStmt(stmtId, stmtsPerEntry));
+        }
+        benchmark::DoNotOptimize(committedStatements);
+    }
+}
+
+void BM_RebuildCommittedStatementIndex(benchmark::State& state) {
+    const auto numStmts = state.range(0);
+    const auto stmtsPerEntry = state.range(1);
+    for (auto _ : state) {
+        CommittedStatementIndex committedStatements;
+        for (auto stmtId = numStmts - 1; stmtId >= 0; --stmtId) {
+            committedStatements.insert(stmtId, opTimeForStmt(stmtId, stmtsPerEntry));
+        }
+        benchmark::DoNotOptimize(committedStatements);
+    }
+}
+
+// The lookup done for every statement of a retryable write, to check whether it has already been
+// executed.
+void BM_FindCommittedStatementHashMap(benchmark::State& state) {
+    const auto numStmts = state.range(0);
+    const auto stmtsPerEntry = state.range(1);
+    absl::flat_hash_map<StmtId, repl::OpTime> committedStatements;
+    for (auto stmtId = 0; stmtId < numStmts; ++stmtId) {
+        committedStatements.emplace(stmtId, opTimeForStmt(stmtId, stmtsPerEntry));
+    }
+
+    int64_t stmtId = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(committedStatements.find(stmtId));
+        stmtId = (stmtId + 1) % numStmts;
+    }
+}
+
+void BM_FindCommittedStatement(benchmark::State& state) {
+    const auto numStmts = state.range(0);
+    const auto stmtsPerEntry = state.range(1);
+    CommittedStatementIndex committedStatements;
+    for (auto stmtId = 0; stmtId < numStmts; ++stmtId) {
+        committedStatements.insert(stmtId, opTimeForStmt(stmtId, stmtsPerEntry));
+    }
+
+    int64_t stmtId = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(committedStatements.find(stmtId));
+        stmtId = (stmtId + 1) % numStmts;
+    }
+}
+
+// A single statement per oplog entry is the common case of plain retryable writes, which must not
+// get slower than with the hash map.
+BENCHMARK(BM_RebuildCommittedStatementsHashMap)->ArgsProduct({{10, 1'000, 100'000}, {1, 1'000}});
+BENCHMARK(BM_RebuildCommittedStatementIndex)->ArgsProduct({{10, 1'000, 100'000}, {1, 1'000}});
+BENCHMARK(BM_FindCommittedStatementHashMap)->ArgsProduct({{10, 1'000, 100'000}, {1, 1'000}});
+BENCHMARK(BM_FindCommittedStatement)->ArgsProduct({{10, 1'000, 100'000}, {1, 1'000}});
+
+}  // namespace mongo
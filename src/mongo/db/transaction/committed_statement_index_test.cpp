@@ -0,0 +1,172 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/unittest/unittest.h"
+
+#include <limits>
+#include <map>
+
+#include "mongo/bson/timestamp.h"
+#include "mongo/db/repl/optime.h"
+#include "mongo/db/transaction/committed_statement_index.h"
+
+namespace mongo {
+namespace {
+
+const repl::OpTime kOpTime1(Timestamp(100, 1), 1);
+const repl::OpTime kOpTime2(Timestamp(100, 2), 1);
+
+TEST(CommittedStatementIndex, FindOnEmptyIndex) {
+    CommittedStatementIndex index;
+    ASSERT(index.empty());
+    ASSERT_FALSE(index.find(0));
+    ASSERT_EQ(index.numStatements(), 0U);
+}
+
+TEST(CommittedStatementIndex, StatementsFromOneOplogEntryFormOneRun) {
+    CommittedStatementIndex index;
+    // Insert out of order, as the oplog history is walked from newest to oldest.
+    for (StmtId stmtId : {5, 3, 4, 7, 6}) {
+        auto [opTime, inserted] = index.insert(stmtId, kOpTime1);
+        ASSERT(inserted);
+        ASSERT_EQ(opTime, kOpTime1);
+    }
+    ASSERT_EQ(index.numStatements(), 5U);
+    ASSERT_EQ(index.numRuns(), 1U);
+
+    for (StmtId stmtId = 3; stmtId <= 7; ++stmtId) {
+        ASSERT_EQ(index.find(stmtId).value_or(repl::OpTime()), kOpTime1);
+    }
+    ASSERT_FALSE(index.find(2));
+    ASSERT_FALSE(index.find(8));
+}
+
+TEST(CommittedStatementIndex, DifferentOpTimesDoNotCoalesce) {
+    CommittedStatementIndex index;
+    ASSERT(index.insert(0, kOpTime1).second);
+    ASSERT(index.insert(1, kOpTime2).second);
+    ASSERT(index.insert(2, kOpTime1).second);
+    ASSERT_EQ(index.numRuns(), 3U);
+
+    ASSERT_EQ(index.find(0).value_or(repl::OpTime()), kOpTime1);
+    ASSERT_EQ(index.find(1).value_or(repl::OpTime()), kOpTime2);
+    ASSERT_EQ(index.find(2).value_or(repl::OpTime()), kOpTime1);
+}
+
+TEST(CommittedStatementIndex, FillingGapMergesRuns) {
+    CommittedStatementIndex index;
+    ASSERT(index.insert(10, kOpTime1).second);
+    ASSERT(index.insert(12, kOpTime1).second);
+    ASSERT_EQ(index.numRuns(), 2U);
+
+    ASSERT(index.insert(11, kOpTime1).second);
+    ASSERT_EQ(index.numRuns(), 1U);
+    ASSERT_EQ(index.numStatements(), 3U);
+    ASSERT_EQ(index.find(11).value_or(repl::OpTime()), kOpTime1);
+}
+
+TEST(CommittedStatementIndex, FillingGapBetweenTwoRunsMergesThem) {
+    CommittedStatementIndex index;
+    for (StmtId stmtId : {0, 1, 3, 4}) {
+        ASSERT(index.insert(stmtId, kOpTime1).second);
+    }
+    ASSERT_EQ(index.numRuns(), 2U);
+
+    ASSERT(index.insert(2, kOpTime1).second);
+    ASSERT_EQ(index.numRuns(), 1U);
+    for (StmtId stmtId = 0; stmtId <= 4; ++stmtId) {
+        ASSERT_EQ(index.find(stmtId).value_or(repl::OpTime()), kOpTime1);
+    }
+    ASSERT_FALSE(index.find(5));
+}
+
+TEST(CommittedStatementIndex, RunDoesNotAbsorbAdjacentStatementWithDifferentOpTime) {
+    CommittedStatementIndex index;
+    ASSERT(index.insert(1, kOpTime1).second);
+    ASSERT(index.insert(2, kOpTime1).second);
+    ASSERT(index.insert(3, kOpTime2).second);
+    ASSERT(index.insert(0, kOpTime2).second);
+    ASSERT_EQ(index.numRuns(), 3U);
+
+    ASSERT_EQ(index.find(0).value_or(repl::OpTime()), kOpTime2);
+    ASSERT_EQ(index.find(2).value_or(repl::OpTime()), kOpTime1);
+    ASSERT_EQ(index.find(3).value_or(repl::OpTime()), kOpTime2);
+}
+
+TEST(CommittedStatementIndex, RepeatedInsertReturnsExistingOpTime) {
+    CommittedStatementIndex index;
+    ASSERT(index.insert(1, kOpTime1).second);
+
+    auto [opTime, inserted] = index.insert(1, kOpTime2);
+    ASSERT_FALSE(inserted);
+    ASSERT_EQ(opTime, kOpTime1);
+    ASSERT_EQ(index.numStatements(), 1U);
+    ASSERT_EQ(index.find(1).value_or(repl::OpTime()), kOpTime1);
+}
+
+TEST(CommittedStatementIndex, StatementIdBoundsDoNotOverflow) {
+    CommittedStatementIndex index;
+    const auto maxStmtId = std::numeric_limits<StmtId>::max();
+    ASSERT(index.insert(maxStmtId, kOpTime1).second);
+    ASSERT(index.insert(maxStmtId - 1, kOpTime1).second);
+    ASSERT(index.insert(0, kOpTime1).second);
+    ASSERT_EQ(index.numRuns(), 2U);
+    ASSERT_EQ(index.find(maxStmtId).value_or(repl::OpTime()), kOpTime1);
+    ASSERT_FALSE(index.find(1));
+}
+
+TEST(CommittedStatementIndex, Clear) {
+    CommittedStatementIndex index;
+    ASSERT(index.insert(1, kOpTime1).second);
+    index.clear();
+    ASSERT(index.empty());
+    ASSERT_EQ(index.numStatements(), 0U);
+    ASSERT_FALSE(index.find(1));
+}
+
+TEST(CommittedStatementIndex, ForEachVisitsEveryStatement) {
+    CommittedStatementIndex index;
+    for (StmtId stmtId : {0, 1, 2}) {
+        ASSERT(index.insert(stmtId, kOpTime1).second);
+    }
+    ASSERT(index.insert(3, kOpTime2).second);
+    ASSERT(index.insert(std::numeric_limits<StmtId>::max(), kOpTime2).second);
+
+    std::map<StmtId, repl::OpTime> visited;
+    index.forEach([&](StmtId stmtId, const repl::OpTime& opTime) {
+        ASSERT(visited.emplace(stmtId, opTime).second);
+    });
+    ASSERT_EQ(visited.size(), index.numStatements());
+    for (const auto& [stmtId, opTime] : visited) {
+        ASSERT_EQ(index.find(stmtId).value_or(repl::OpTime()), opTime);
+    }
+}
+
+}  // namespace
+}  // namespace mongo
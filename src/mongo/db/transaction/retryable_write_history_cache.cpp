@@ -0,0 +1,157 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/transaction/retryable_write_history_cache.h"
+
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "mongo/db/session/logical_session_id_helpers.h"
+#include "mongo/db/transaction/retryable_write_history_cache_gen.h"
+#include "mongo/util/decorable.h"
+
+namespace mongo {
+namespace {
+const auto retryableWriteHistoryCacheDecoration =
+    ServiceContext::declareDecoration<RetryableWriteHistoryCache>();
+}  // namespace
+
+RetryableWriteHistoryCache* RetryableWriteHistoryCache::get(ServiceContext* service) {
+    return &retryableWriteHistoryCacheDecoration(service);
+}
+
+RetryableWriteHistoryCache* RetryableWriteHistoryCache::get(OperationContext* opCtx) {
+    return get(opCtx->getServiceContext());
+}
+
+void RetryableWriteHistoryCache::observeOplogEntry(const repl::OplogEntry& entry) {
+    const auto& lsid = entry.getSessionId();
+    const auto& txnNumber = entry.getTxnNumber();
+    if (!lsid || !txnNumber || !isParentSessionId(*lsid)) {
+        return;
+    }
+
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+
+    // Transactions, applyOps and dead end sentinels are left to the oplog walk on session load, and
+    // so is everything which follows them in the chain.
+    const auto& stmtIds = entry.getStatementIds();
+    if (entry.isInTransaction() ||
+        entry.getCommandType() == repl::OplogEntry::CommandType::kApplyOps || stmtIds.empty() ||
+        stmtIds.front() == kIncompleteHistoryStmtId) {
+        _cache.erase(*lsid);
+        return;
+    }
+
+    const auto prevOpTime = entry.getPrevWriteOpTimeInTransaction().value_or(repl::OpTime());
+    auto it = _cache.find(*lsid);
+    if (prevOpTime.isNull()) {
+        // This is the first write of 'txnNumber', which starts a new chain.
+        if (gRetryableWriteHistoryCacheMaxSessions.load() <= 0) {
+            return;
+        }
+        _cache.add(*lsid, Entry{*txnNumber, repl::OpTime(), {}, {}});
+        it = _cache.begin();
+    } else if (it == _cache.end() || it->second.txnNumber != *txnNumber ||
+               it->second.lastWriteOpTime != prevOpTime) {
+        // The cached chain is not a prefix of the one this entry extends.
+        if (it != _cache.end()) {
+            _cache.erase(it);
+        }
+        return;
+    }
+
+    auto& cached = it->second;
+    for (auto stmtId : stmtIds) {
+        if (stmtId < 0 || !cached.committedStatements.insert(stmtId, entry.getOpTime()).second) {
+            // Leave reporting the invalid history to the session load, which walks the oplog.
+            _cache.erase(it);
+            return;
+        }
+    }
+
+    if (!entry.getNss().isEmpty()) {
+        cached.affectedNamespaces.emplace(entry.getNss());
+    }
+    cached.lastWriteOpTime = entry.getOpTime();
+
+    _evictIfNeeded(lk);
+}
+
+void RetryableWriteHistoryCache::record(const LogicalSessionId& lsid, Entry entry) {
+    if (!isParentSessionId(lsid)) {
+        return;
+    }
+
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+
+    // A secondary caches entries as soon as it batches them, so a session load which reads
+    // config.transactions before the batch is applied can find a newer chain in the cache.
+    if (auto it = _cache.find(lsid); it != _cache.end() &&
+        (it->second.txnNumber > entry.txnNumber ||
+         (it->second.txnNumber == entry.txnNumber &&
+          it->second.lastWriteOpTime > entry.lastWriteOpTime))) {
+        return;
+    }
+
+    _cache.add(lsid, std::move(entry));
+    _evictIfNeeded(lk);
+}
+
+boost::optional<RetryableWriteHistoryCache::Entry> RetryableWriteHistoryCache::find(
+    const LogicalSessionId& lsid, TxnNumber txnNumber) {
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    auto it = _cache.find(lsid);
+    if (it == _cache.end() || it->second.txnNumber != txnNumber) {
+        return boost::none;
+    }
+    return it->second;
+}
+
+void RetryableWriteHistoryCache::clear() {
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    _cache.clear();
+}
+
+std::size_t RetryableWriteHistoryCache::size() const {
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    return _cache.size();
+}
+
+void RetryableWriteHistoryCache::_evictIfNeeded(WithLock) {
+    const auto maxSessions = gRetryableWriteHistoryCacheMaxSessions.load();
+    while (!_cache.empty() && _cache.size() > static_cast<std::size_t>(std::max(maxSessions, 0))) {
+        _cache.erase(std::prev(_cache.end()));
+    }
+}
+
+}  // namespace mongo
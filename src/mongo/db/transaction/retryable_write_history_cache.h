@@ -0,0 +1,117 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <absl/container/flat_hash_set.h>
+#include <boost/optional/optional.hpp>
+#include <cstddef>
+#include <limits>
+
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/repl/oplog_entry.h"
+#include "mongo/db/repl/optime.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/session/logical_session_id.h"
+#include "mongo/db/transaction/committed_statement_index.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/util/concurrency/with_lock.h"
+#include "mongo/util/lru_cache.h"
+
+namespace mongo {
+
+/**
+ * Node-local cache of the committed statements of recent retryable writes, keyed by session.
+ *
+ * Loading a session from storage normally walks the oplog chain of its active retryable write,
+ * from the lastWriteOpTime in config.transactions back to the first write of that txnNumber. A
+ * secondary already reads each of those oplog entries once while applying them, so it records
+ * their statements here. A secondary which steps up can then load a session from the cached
+ * history, and only needs to read the oplog entries written after the last one it cached.
+ *
+ * An entry is only ever a prefix of the oplog chain of its session: it is extended by an oplog
+ * entry whose prevWriteOpTimeInTransaction is the entry's lastWriteOpTime, and is dropped when
+ * anything else is seen for the session. Since optimes are unique, a session load which reaches
+ * that lastWriteOpTime while walking back from config.transactions has found the cached chain.
+ *
+ * Only retryable writes on parent sessions are cached. Internal sessions and transactions are
+ * always loaded from the oplog. The number of sessions is bounded by
+ * 'retryableWriteHistoryCacheMaxSessions', evicting the least recently used session first.
+ */
+class RetryableWriteHistoryCache {
+public:
+    struct Entry {
+        TxnNumber txnNumber;
+        repl::OpTime lastWriteOpTime;
+        CommittedStatementIndex committedStatements;
+        absl::flat_hash_set<NamespaceString> affectedNamespaces;
+    };
+
+    static RetryableWriteHistoryCache* get(ServiceContext* service);
+    static RetryableWriteHistoryCache* get(OperationContext* opCtx);
+
+    /**
+     * Updates the cached history of the session of 'entry', which must be applied in oplog order.
+     * Called by the oplog applier for every operation it applies.
+     */
+    void observeOplogEntry(const repl::OplogEntry& entry);
+
+    /**
+     * Replaces the cached history of 'lsid' with the complete history loaded from the oplog, unless
+     * a newer history is already cached.
+     */
+    void record(const LogicalSessionId& lsid, Entry entry);
+
+    /**
+     * Returns a copy of the cached history of 'lsid' if it is for 'txnNumber', or boost::none.
+     */
+    boost::optional<Entry> find(const LogicalSessionId& lsid, TxnNumber txnNumber);
+
+    /**
+     * Drops the cached history of every session. Called when the oplog may have diverged from the
+     * cached chains, such as on rollback.
+     */
+    void clear();
+
+    std::size_t size() const;
+
+private:
+    using Cache = LRUCache<LogicalSessionId, Entry, LogicalSessionIdHash>;
+
+    void _evictIfNeeded(WithLock);
+
+    mutable stdx::mutex _mutex;
+
+    // The limit can change at runtime, so it is enforced by _evictIfNeeded() rather than by the
+    // LRUCache itself.
+    Cache _cache{std::numeric_limits<std::size_t>::max()};
+};
+
+}  // namespace mongo
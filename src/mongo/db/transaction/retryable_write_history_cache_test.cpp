@@ -0,0 +1,211 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/unittest/unittest.h"
+
+#include <utility>
+#include <vector>
+
+#include "mongo/bson/bsonmisc.h"
+#include "mongo/bson/timestamp.h"
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/repl/oplog_entry.h"
+#include "mongo/db/repl/optime.h"
+#include "mongo/db/session/logical_session_id.h"
+#include "mongo/db/transaction/retryable_write_history_cache.h"
+#include "mongo/idl/server_parameter_test_util.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+namespace {
+
+const NamespaceString kNss = NamespaceString::createNamespaceString_forTest("TestDB", "TestColl");
+
+repl::OpTime makeOpTime(unsigned inc) {
+    return repl::OpTime(Timestamp(100, inc), 1);
+}
+
+repl::OplogEntry makeRetryableWriteEntry(const LogicalSessionId& lsid,
+                                         TxnNumber txnNumber,
+                                         const repl::OpTime& opTime,
+                                         const std::vector<StmtId>& stmtIds,
+                                         const repl::OpTime& prevOpTime) {
+    repl::MutableOplogEntry entry;
+    entry.setOpType(repl::OpTypeEnum::kInsert);
+    entry.setNss(kNss);
+    entry.setObject(BSON("_id" << 0));
+    entry.setOpTime(opTime);
+    entry.setWallClockTime(Date_t::now());
+    entry.setSessionId(lsid);
+    entry.setTxnNumber(txnNumber);
+    entry.setStatementIds(stmtIds);
+    entry.setPrevWriteOpTimeInTransaction(prevOpTime);
+    return uassertStatusOK(repl::OplogEntry::parse(entry.toBSON()));
+}
+
+TEST(RetryableWriteHistoryCache, CachesChainOfAppliedRetryableWrites) {
+    RetryableWriteHistoryCache cache;
+    const auto lsid = makeLogicalSessionIdForTest();
+
+    cache.observeOplogEntry(makeRetryableWriteEntry(lsid, 1, makeOpTime(1), {0, 1}, {}));
+    cache.observeOplogEntry(makeRetryableWriteEntry(lsid, 1, makeOpTime(2), {2}, makeOpTime(1)));
+
+    auto cached = cache.find(lsid, 1);
+    ASSERT(cached);
+    ASSERT_EQ(cached->lastWriteOpTime, makeOpTime(2));
+    ASSERT_EQ(cached->committedStatements.numStatements(), 3U);
+    ASSERT_EQ(cached->committedStatements.find(0).value_or(repl::OpTime()), makeOpTime(1));
+    ASSERT_EQ(cached->committedStatements.find(2).value_or(repl::OpTime()), makeOpTime(2));
+    ASSERT(cached->affectedNamespaces.contains(kNss));
+
+    ASSERT_FALSE(cache.find(lsid, 2));
+}
+
+TEST(RetryableWriteHistoryCache, DoesNotCacheChainWhoseStartWasNotApplied) {
+    RetryableWriteHistoryCache cache;
+    const auto lsid = makeLogicalSessionIdForTest();
+
+    cache.observeOplogEntry(makeRetryableWriteEntry(lsid, 1, makeOpTime(2), {1}, makeOpTime(1)));
+    ASSERT_FALSE(cache.find(lsid, 1));
+    ASSERT_EQ(cache.size(), 0U);
+}
+
+TEST(RetryableWriteHistoryCache, NewTxnNumberReplacesCachedChain) {
+    RetryableWriteHistoryCache cache;
+    const auto lsid = makeLogicalSessionIdForTest();
+
+    cache.observeOplogEntry(makeRetryableWriteEntry(lsid, 1, makeOpTime(1), {0}, {}));
+    cache.observeOplogEntry(makeRetryableWriteEntry(lsid, 2, makeOpTime(2), {0}, {}));
+
+    ASSERT_FALSE(cache.find(lsid, 1));
+    auto cached = cache.find(lsid, 2);
+    ASSERT(cached);
+    ASSERT_EQ(cached->committedStatements.find(0).value_or(repl::OpTime()), makeOpTime(2));
+}
+
+TEST(RetryableWriteHistoryCache, EntryWhichDoesNotExtendCachedChainDropsIt) {
+    RetryableWriteHistoryCache cache;
+    const auto lsid = makeLogicalSessionIdForTest();
+
+    cache.observeOplogEntry(makeRetryableWriteEntry(lsid, 1, makeOpTime(1), {0}, {}));
+    cache.observeOplogEntry(makeRetryableWriteEntry(lsid, 1, makeOpTime(3), {1}, makeOpTime(2)));
+    ASSERT_FALSE(cache.find(lsid, 1));
+
+    // Nothing is cached again until the next txnNumber starts a chain.
+    cache.observeOplogEntry(makeRetryableWriteEntry(lsid, 1, makeOpTime(4), {2}, makeOpTime(3)));
+    ASSERT_FALSE(cache.find(lsid, 1));
+}
+
+TEST(RetryableWriteHistoryCache, RepeatedStatementDropsCachedChain) {
+    RetryableWriteHistoryCache cache;
+    const auto lsid = makeLogicalSessionIdForTest();
+
+    cache.observeOplogEntry(makeRetryableWriteEntry(lsid, 1, makeOpTime(1), {0}, {}));
+    cache.observeOplogEntry(makeRetryableWriteEntry(lsid, 1, makeOpTime(2), {0}, makeOpTime(1)));
+    ASSERT_FALSE(cache.find(lsid, 1));
+}
+
+TEST(RetryableWriteHistoryCache, DeadEndSentinelDropsCachedChain) {
+    RetryableWriteHistoryCache cache;
+    const auto lsid = makeLogicalSessionIdForTest();
+
+    cache.observeOplogEntry(makeRetryableWriteEntry(lsid, 1, makeOpTime(1), {0}, {}));
+    cache.observeOplogEntry(makeRetryableWriteEntry(
+        lsid, 1, makeOpTime(2), {kIncompleteHistoryStmtId}, makeOpTime(1)));
+    ASSERT_FALSE(cache.find(lsid, 1));
+}
+
+TEST(RetryableWriteHistoryCache, DoesNotCacheInternalSessions) {
+    RetryableWriteHistoryCache cache;
+    const auto lsid = makeLogicalSessionIdWithTxnNumberAndUUIDForTest();
+
+    cache.observeOplogEntry(makeRetryableWriteEntry(lsid, 1, makeOpTime(1), {0}, {}));
+    ASSERT_EQ(cache.size(), 0U);
+}
+
+TEST(RetryableWriteHistoryCache, EvictsLeastRecentlyUsedSession) {
+    RAIIServerParameterControllerForTest maxSessions("retryableWriteHistoryCacheMaxSessions", 2);
+    RetryableWriteHistoryCache cache;
+    const auto lsid1 = makeLogicalSessionIdForTest();
+    const auto lsid2 = makeLogicalSessionIdForTest();
+    const auto lsid3 = makeLogicalSessionIdForTest();
+
+    cache.observeOplogEntry(makeRetryableWriteEntry(lsid1, 1, makeOpTime(1), {0}, {}));
+    cache.observeOplogEntry(makeRetryableWriteEntry(lsid2, 1, makeOpTime(2), {0}, {}));
+    ASSERT(cache.find(lsid1, 1));
+    cache.observeOplogEntry(makeRetryableWriteEntry(lsid3, 1, makeOpTime(3), {0}, {}));
+
+    ASSERT_EQ(cache.size(), 2U);
+    ASSERT(cache.find(lsid1, 1));
+    ASSERT_FALSE(cache.find(lsid2, 1));
+    ASSERT(cache.find(lsid3, 1));
+}
+
+TEST(RetryableWriteHistoryCache, DisabledWhenMaxSessionsIsZero) {
+    RAIIServerParameterControllerForTest maxSessions("retryableWriteHistoryCacheMaxSessions", 0);
+    RetryableWriteHistoryCache cache;
+    const auto lsid = makeLogicalSessionIdForTest();
+
+    cache.observeOplogEntry(makeRetryableWriteEntry(lsid, 1, makeOpTime(1), {0}, {}));
+    cache.record(lsid, {1, makeOpTime(1), {}, {}});
+    ASSERT_EQ(cache.size(), 0U);
+}
+
+TEST(RetryableWriteHistoryCache, RecordDoesNotReplaceNewerHistory) {
+    RetryableWriteHistoryCache cache;
+    const auto lsid = makeLogicalSessionIdForTest();
+
+    cache.observeOplogEntry(makeRetryableWriteEntry(lsid, 1, makeOpTime(1), {0}, {}));
+    cache.observeOplogEntry(makeRetryableWriteEntry(lsid, 1, makeOpTime(2), {1}, makeOpTime(1)));
+
+    // A session load which read config.transactions before the second entry was applied.
+    RetryableWriteHistoryCache::Entry loaded{1, makeOpTime(1), {}, {}};
+    loaded.committedStatements.insert(0, makeOpTime(1));
+    cache.record(lsid, std::move(loaded));
+
+    auto cached = cache.find(lsid, 1);
+    ASSERT(cached);
+    ASSERT_EQ(cached->lastWriteOpTime, makeOpTime(2));
+
+    cache.record(lsid, {2, makeOpTime(3), {}, {}});
+    ASSERT(cache.find(lsid, 2));
+}
+
+TEST(RetryableWriteHistoryCache, Clear) {
+    RetryableWriteHistoryCache cache;
+    const auto lsid = makeLogicalSessionIdForTest();
+
+    cache.record(lsid, {1, makeOpTime(1), {}, {}});
+    ASSERT(cache.find(lsid, 1));
+    cache.clear();
+    ASSERT_FALSE(cache.find(lsid, 1));
+}
+
+}  // namespace
+}  // namespace mongo
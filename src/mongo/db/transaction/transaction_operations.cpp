@@ -36,6 +36,7 @@
 #include <fmt/format.h>
 #include <memory>
 #include <string>
+#include <utility>
 
 #include <boost/optional/optional.hpp>
 
@@ -160,6 +161,11 @@ void TransactionOperations::clear() {
 
 Status TransactionOperations::addOperation(const TransactionOperation& operation,
                                            boost::optional<std::size_t> transactionSizeLimitBytes) {
+    return addOperation(TransactionOperation(operation), transactionSizeLimitBytes);
+}
+
+Status TransactionOperations::addOperation(TransactionOperation&& operation,
+                                           boost::optional<std::size_t> transactionSizeLimitBytes) {
     const auto& stmtIdsToInsert = operation.getStatementIds();
     auto nextStmtIdToInsert = stmtIdsToInsert.begin();
 
@@ -204,7 +210,7 @@ Status TransactionOperations::addOperation(const TransactionOperation& operation
                                   *transactionSizeLimitBytes));
     }
 
-    _transactionOperations.push_back(operation);
+    _transactionOperations.push_back(std::move(operation));
     _totalOperationBytes += opSize;
     _numberOfPrePostImagesToWrite += numberOfPrePostImagesToWrite;
     stmtIdRemover.dismiss();
@@ -203,6 +203,14 @@ public:
     Status addOperation(const TransactionOperation& operation,
                         boost::optional<std::size_t> transactionSizeLimitBytes = boost::none);
 
+    /**
+     * Same as above, but takes ownership of 'operation' so that callers which build the
+     * operation only to hand it over (for example, the OpObserver write paths) do not pay for
+     * copying its document, pre-image and post-image into this container.
+     */
+    Status addOperation(TransactionOperation&& operation,
+                        boost::optional<std::size_t> transactionSizeLimitBytes = boost::none);
+
     /**
      * Returns a set of collection UUIDs for the operations stored in this container.
      *
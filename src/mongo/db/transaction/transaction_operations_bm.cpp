@@ -28,6 +28,11 @@
  */
 
 #include <benchmark/benchmark.h>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/op_observer/batched_write_context.h"
@@ -76,4 +81,68 @@ BENCHMARK(BM_AddOperations)
     ->Args({100, 20})
     ->Args({1000, 50})
     ->Args({10000, 1000});
+
+// Builds 'nops' insert operations with contiguous statement IDs whose documents are roughly
+// 'docSize' bytes.
+std::vector<repl::ReplOperation> makeInsertOperations(int64_t nops, int64_t docSize) {
+    const NamespaceString nss =
+        NamespaceString::createNamespaceString_forTest(boost::none, "test", "coll");
+    const auto uuid = UUID::gen();
+    const std::string payload(docSize, 'x');
+    std::vector<repl::ReplOperation> ops;
+    ops.reserve(nops);
+    for (int i = 0; i < nops; i++) {
+        auto doc = BSON("_id" << i << "payload" << payload);
+        auto op = repl::MutableOplogEntry::makeInsertOperation(nss, uuid, doc, BSON("_id" << i));
+        op.setInitializedStatementIds({i});
+        ops.emplace_back(std::move(op));
+    }
+    return ops;
+}
+
+// First arg is the number of operations. Second arg is the approximate document size in bytes.
+// Compares handing operations over by copy, as the OpObserver write paths used to, against
+// moving them into the container.
+void BM_AddOperationsByCopy(benchmark::State& state) {
+    const auto ops = makeInsertOperations(state.range(0), state.range(1));
+    for (auto _ : state) {
+        state.PauseTiming();
+        TransactionOperations transactionOperations;
+        state.ResumeTiming();
+        for (const auto& op : ops)
+            invariantStatusOK(transactionOperations.addOperation(op));
+    }
+}
+
+void BM_AddOperationsByMove(benchmark::State& state) {
+    const auto ops = makeInsertOperations(state.range(0), state.range(1));
+    for (auto _ : state) {
+        state.PauseTiming();
+        TransactionOperations transactionOperations;
+        auto opsToMove = ops;
+        state.ResumeTiming();
+        for (auto& op : opsToMove)
+            invariantStatusOK(transactionOperations.addOperation(std::move(op)));
+    }
+}
+
+BENCHMARK(BM_AddOperationsByCopy)->ArgsProduct({{1, 10, 100}, {16, 1024, 16 * 1024}});
+BENCHMARK(BM_AddOperationsByMove)->ArgsProduct({{1, 10, 100}, {16, 1024, 16 * 1024}});
+
+// First arg is the number of operations. Measures the applyOps packing done when committing a
+// small unprepared transaction, which is the common case for transactions that target a single
+// shard.
+void BM_GetApplyOpsInfoSmallTransaction(benchmark::State& state) {
+    TransactionOperations transactionOperations;
+    for (auto&& op : makeInsertOperations(state.range(0), 64))
+        invariantStatusOK(transactionOperations.addOperation(std::move(op)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            transactionOperations.getApplyOpsInfo(std::numeric_limits<std::size_t>::max(),
+                                                  static_cast<std::size_t>(BSONObjMaxUserSize),
+                                                  /*prepare=*/false));
+    }
+}
+
+BENCHMARK(BM_GetApplyOpsInfoSmallTransaction)->Arg(1)->Arg(2)->Arg(5)->Arg(10);
 }  // namespace mongo
@@ -34,6 +34,7 @@
 #include <memory>
 #include <ostream>
 #include <string>
+#include <utility>
 
 #include <boost/optional/optional.hpp>
 
@@ -224,6 +225,32 @@ TEST(TransactionOperationsTest, AddTransactionIncludesPreAndPostImageStatistics)
     ASSERT_EQ(ops.getNumberOfPrePostImagesToWrite(), 0);
 }
 
+TEST(TransactionOperationsTest, AddTransactionByMoveMatchesAddByCopy) {
+    TransactionOperations::TransactionOperation op;
+    op.setStatementIds({1});
+    op.setObject(BSON("_id" << 1 << "x" << 1));
+    op.setPostImage(BSON("a" << 123));
+
+    TransactionOperations copied;
+    ASSERT_OK(copied.addOperation(op));
+
+    TransactionOperations moved;
+    auto toMove = op;
+    ASSERT_OK(moved.addOperation(std::move(toMove)));
+
+    ASSERT_EQ(moved.numOperations(), copied.numOperations());
+    ASSERT_EQ(moved.getTotalOperationBytes(), copied.getTotalOperationBytes());
+    ASSERT_EQ(moved.getNumberOfPrePostImagesToWrite(), copied.getNumberOfPrePostImagesToWrite());
+    ASSERT_BSONOBJ_EQ(moved.getOperationsForOpObserver()[0].toBSON(),
+                      copied.getOperationsForOpObserver()[0].toBSON());
+
+    // Statement ID conflicts are still detected and leave the container unchanged.
+    TransactionOperations::TransactionOperation duplicate;
+    duplicate.setStatementIds({1});
+    ASSERT_EQ(5875600, moved.addOperation(std::move(duplicate)).code());
+    ASSERT_EQ(moved.numOperations(), 1U);
+}
+
 TEST(TransactionOperationsTest, AddTransactionEnforceTotalOperationSizeLimit) {
     TransactionOperations::TransactionOperation op1;
     auto opSize1 = repl::DurableOplogEntry::getDurableReplOperationSize(op1);
@@ -111,6 +111,7 @@
 #include "mongo/db/storage/record_store.h"
 #include "mongo/db/storage/snapshot.h"
 #include "mongo/db/storage/storage_stats.h"
+#include "mongo/db/transaction/retryable_write_history_cache.h"
 #include "mongo/db/transaction/retryable_writes_stats.h"
 #include "mongo/db/transaction/server_transactions_metrics.h"
 #include "mongo/db/transaction/transaction_history_iterator.h"
@@ -264,7 +265,7 @@ void rethrowPartialIndexQueryBadValueWithContext(const DBException& ex) {
 
 struct ActiveTransactionHistory {
     boost::optional<SessionTxnRecord> lastTxnRecord;
-    TransactionParticipant::CommittedStatementTimestampMap committedStatements;
+    CommittedStatementIndex committedStatements;
     absl::flat_hash_set<NamespaceString> affectedNamespaces;
     bool hasIncompleteHistory{false};
 };
@@ -326,6 +327,16 @@ ActiveTransactionHistory fetchActiveTransactionHistory(OperationContext* opCtx,
         return result;
     }
 
+    // Registers that 'stmtId' was written at 'opTime', and crashes the server if it was already
+    // written by another oplog entry.
+    auto insertStmtId = [&](StmtId stmtId, const repl::OpTime& opTime) {
+        const auto [existingOpTime, inserted] = result.committedStatements.insert(stmtId, opTime);
+        if (!inserted) {
+            fassertOnRepeatedExecution(
+                lsid, result.lastTxnRecord->getTxnNum(), stmtId, existingOpTime, opTime);
+        }
+    };
+
     // Helper for registering statement ids of an oplog entry for a retryable write or a retryable
     // internal transaction.
     auto insertStmtIdsForOplogEntry = [&](const repl::OplogEntry& entry) {
@@ -334,15 +345,7 @@ ActiveTransactionHistory fetchActiveTransactionHistory(OperationContext* opCtx,
                     str::stream() << "Found an oplog entry with an invalid stmtId "
                                   << entry.toBSONForLogging(),
                     stmtId >= 0);
-            const auto insertRes = result.committedStatements.emplace(stmtId, entry.getOpTime());
-            if (!insertRes.second) {
-                const auto& existingOpTime = insertRes.first->second;
-                fassertOnRepeatedExecution(lsid,
-                                           result.lastTxnRecord->getTxnNum(),
-                                           stmtId,
-                                           existingOpTime,
-                                           entry.getOpTime());
-            }
+            insertStmtId(stmtId, entry.getOpTime());
         }
 
         if (!entry.getNss().isEmpty()) {
@@ -357,6 +360,23 @@ ActiveTransactionHistory fetchActiveTransactionHistory(OperationContext* opCtx,
         std::exchange(repl::ReadConcernArgs::get(opCtx), repl::ReadConcernArgs());
     ON_BLOCK_EXIT([&] { repl::ReadConcernArgs::get(opCtx) = std::move(originalReadConcern); });
 
+    // The history of a retryable write may already be cached, either because this node applied
+    // its oplog entries as a secondary or because it loaded the session before. If the cached
+    // chain ends at the last write there is nothing to read, otherwise only the oplog entries
+    // written after it are.
+    auto historyCache = RetryableWriteHistoryCache::get(opCtx);
+    boost::optional<RetryableWriteHistoryCache::Entry> cachedHistory;
+    if (isParentSessionId(lsid)) {
+        cachedHistory = historyCache->find(lsid, result.lastTxnRecord->getTxnNum());
+    }
+    if (cachedHistory &&
+        cachedHistory->lastWriteOpTime == result.lastTxnRecord->getLastWriteOpTime()) {
+        result.committedStatements = std::move(cachedHistory->committedStatements);
+        result.affectedNamespaces = std::move(cachedHistory->affectedNamespaces);
+        return result;
+    }
+    bool reachedCachedHistory = false;
+
     auto it = TransactionHistoryIterator(result.lastTxnRecord->getLastWriteOpTime());
     while (it.hasNext()) {
         try {
@@ -400,6 +420,12 @@ ActiveTransactionHistory fetchActiveTransactionHistory(OperationContext* opCtx,
                 }
 
                 insertStmtIdsForOplogEntry(entry);
+
+                if (cachedHistory &&
+                    entry.getPrevWriteOpTimeInTransaction() == cachedHistory->lastWriteOpTime) {
+                    reachedCachedHistory = true;
+                    break;
+                }
             }
         } catch (const DBException& ex) {
             if (ErrorCodes::isIDLParseError(ex.code()) || ex.code() == ErrorCodes::FailedToParse ||
@@ -420,6 +446,23 @@ ActiveTransactionHistory fetchActiveTransactionHistory(OperationContext* opCtx,
         }
     }
 
+    if (reachedCachedHistory) {
+        // Everything older than the oplog entries walked above is in the cached history.
+        auto newerStatements = std::exchange(result.committedStatements,
+                                             std::move(cachedHistory->committedStatements));
+        newerStatements.forEach(insertStmtId);
+        result.affectedNamespaces.insert(cachedHistory->affectedNamespaces.begin(),
+                                         cachedHistory->affectedNamespaces.end());
+    }
+
+    if (isParentSessionId(lsid) && !result.hasIncompleteHistory) {
+        historyCache->record(lsid,
+                             {result.lastTxnRecord->getTxnNum(),
+                              result.lastTxnRecord->getLastWriteOpTime(),
+                              result.committedStatements,
+                              result.affectedNamespaces});
+    }
+
     return result;
 }
 
@@ -1947,6 +1990,11 @@ repl::OpTime TransactionParticipant::Participant::getPrepareOpTimeForRecovery()
 
 void TransactionParticipant::Participant::addTransactionOperation(
     OperationContext* opCtx, const repl::ReplOperation& operation) {
+    addTransactionOperation(opCtx, repl::ReplOperation(operation));
+}
+
+void TransactionParticipant::Participant::addTransactionOperation(
+    OperationContext* opCtx, repl::ReplOperation&& operation) {
     // Ensure that we only ever add operations to an in progress transaction.
     if (!o().txnState.isInProgress() && _isInternalSessionForRetryableWrite()) {
         // Throw a uassert error instead of an invariant error if this is a retryable internal
@@ -1962,10 +2010,13 @@ void TransactionParticipant::Participant::addTransactionOperation(
               o().activeTxnNumberAndRetryCounter.getTxnNumber() != kUninitializedTxnNumber);
     invariant(shard_role_details::getLocker(opCtx)->inAWriteUnitOfWork());
 
+    // The operation is moved into the transaction's operations below, so hold on to its namespace.
+    auto nss = operation.getNss();
     auto transactionSizeLimitBytes = static_cast<std::size_t>(gTransactionSizeLimitBytes.load());
-    uassertStatusOK(p().transactionOperations.addOperation(operation, transactionSizeLimitBytes));
+    uassertStatusOK(p().transactionOperations.addOperation(std::move(operation),
+                                                           transactionSizeLimitBytes));
 
-    addToAffectedNamespaces(opCtx, operation.getNss());
+    addToAffectedNamespaces(opCtx, nss);
 }
 
 TransactionOperations* TransactionParticipant::Participant::retrieveCompletedTransactionOperations(
@@ -3652,8 +3703,8 @@ boost::optional<repl::OpTime> TransactionParticipant::Participant::_checkStateme
         invariant(!transactionIsAborted());
     }
 
-    const auto it = p().activeTxnCommittedStatements.find(stmtId);
-    if (it == p().activeTxnCommittedStatements.end()) {
+    const auto opTime = p().activeTxnCommittedStatements.find(stmtId);
+    if (!opTime) {
         uassert(ErrorCodes::IncompleteTransactionHistory,
                 str::stream() << "Incomplete history detected for transaction "
                               << o().activeTxnNumberAndRetryCounter.getTxnNumber() << " on session "
@@ -3663,7 +3714,7 @@ boost::optional<repl::OpTime> TransactionParticipant::Participant::_checkStateme
         return boost::none;
     }
 
-    return it->second;
+    return opTime;
 }
 
 void TransactionParticipant::Participant::addCommittedStmtIds(
@@ -3672,7 +3723,7 @@ void TransactionParticipant::Participant::addCommittedStmtIds(
     const repl::OpTime& writeOpTime) {
     stdx::lock_guard<Client> lg(*opCtx->getClient());
     for (auto stmtId : stmtIdsCommitted) {
-        p().activeTxnCommittedStatements.emplace(stmtId, writeOpTime);
+        p().activeTxnCommittedStatements.insert(stmtId, writeOpTime);
     }
 }
 
@@ -3727,7 +3778,7 @@ void TransactionParticipant::Participant::handleWouldChangeOwningShardError(
         // transaction.
         operation.setInitializedStatementIds({0});
 
-        addTransactionOperation(opCtx, operation);
+        addTransactionOperation(opCtx, std::move(operation));
     }
 }
 
@@ -3756,10 +3807,10 @@ void TransactionParticipant::Participant::_registerUpdateCacheOnCommit(
                     continue;
                 }
 
-                const auto insertRes = participant.p().activeTxnCommittedStatements.emplace(
-                    stmtId, lastStmtIdWriteOpTime);
-                if (!insertRes.second) {
-                    const auto& existingOpTime = insertRes.first->second;
+                const auto [existingOpTime, inserted] =
+                    participant.p().activeTxnCommittedStatements.insert(stmtId,
+                                                                        lastStmtIdWriteOpTime);
+                if (!inserted) {
                     fassertOnRepeatedExecution(participant._sessionId(),
                                                participant.o().activeTxnNumberAndRetryCounter,
                                                stmtId,
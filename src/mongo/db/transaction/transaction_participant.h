@@ -72,6 +72,7 @@
 #include "mongo/db/storage/recovery_unit.h"
 #include "mongo/db/storage/storage_engine.h"
 #include "mongo/db/storage/write_unit_of_work.h"
+#include "mongo/db/transaction/committed_statement_index.h"
 #include "mongo/db/transaction/transaction_metrics_observer.h"
 #include "mongo/db/transaction/transaction_operations.h"
 #include "mongo/db/transaction_resources.h"
@@ -303,8 +304,6 @@ public:
         OperationContext* _opCtx;
     };  // class SideTransactionBlock
 
-    using CommittedStatementTimestampMap = absl::flat_hash_map<StmtId, repl::OpTime>;
-
     static const BSONObj kDeadEndSentinel;
 
     /**
@@ -685,6 +684,7 @@ public:
          * transaction is in progress.
          */
         void addTransactionOperation(OperationContext* opCtx, const repl::ReplOperation& operation);
+        void addTransactionOperation(OperationContext* opCtx, repl::ReplOperation&& operation);
 
         /**
          * Returns a reference to the stored operations for a completed multi-document
@@ -1320,7 +1320,7 @@ private:
         // For the active txn, tracks which statement ids have been committed and at which oplog
         // opTime. Used for fast retryability check and retrieving the previous write's data without
         // having to scan through the oplog.
-        CommittedStatementTimestampMap activeTxnCommittedStatements;
+        CommittedStatementIndex activeTxnCommittedStatements;
 
         // Set to true if we need to write an "abort" oplog entry in the case of an abort.  This
         // is the case when we have (or may have) written or replicated an oplog entry for the
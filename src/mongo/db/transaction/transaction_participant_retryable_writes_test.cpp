@@ -79,6 +79,7 @@
 #include "mongo/db/session/session_txn_record_gen.h"
 #include "mongo/db/shard_id.h"
 #include "mongo/db/storage/write_unit_of_work.h"
+#include "mongo/db/transaction/retryable_write_history_cache.h"
 #include "mongo/db/transaction/session_catalog_mongod_transaction_interface_impl.h"
 #include "mongo/db/transaction/transaction_operations.h"
 #include "mongo/db/transaction/transaction_participant.h"
@@ -1027,6 +1028,140 @@ TEST_F(TransactionParticipantRetryableWritesTest,
     ASSERT(txnParticipant.checkStatementExecuted(opCtx(), 5));
 }
 
+/**
+ * Builds a chain of three retryable write oplog entries for statements 0 to 3. None of them are
+ * written to the oplog.
+ */
+std::vector<repl::OplogEntry> makeRetryableWriteChain(const LogicalSessionId& sessionId,
+                                                      TxnNumber txnNum) {
+    OperationSessionInfo osi;
+    osi.setSessionId(sessionId);
+    osi.setTxnNumber(txnNum);
+
+    std::vector<repl::OplogEntry> entries;
+    entries.push_back(makeOplogEntry(repl::OpTime(Timestamp(100, 0), 0),
+                                     repl::OpTypeEnum::kInsert,
+                                     BSON("x" << 0),
+                                     osi,
+                                     Date_t::now(),
+                                     {0, 1},
+                                     repl::OpTime()));
+    entries.push_back(makeOplogEntry(repl::OpTime(Timestamp(100, 1), 0),
+                                     repl::OpTypeEnum::kInsert,
+                                     BSON("x" << 1),
+                                     osi,
+                                     Date_t::now(),
+                                     {2},
+                                     entries[0].getOpTime()));
+    entries.push_back(makeOplogEntry(repl::OpTime(Timestamp(100, 2), 0),
+                                     repl::OpTypeEnum::kInsert,
+                                     BSON("x" << 2),
+                                     osi,
+                                     Date_t::now(),
+                                     {3},
+                                     entries[1].getOpTime()));
+    return entries;
+}
+
+void insertTxnRecordForChain(OperationContext* opCtx,
+                             const LogicalSessionId& sessionId,
+                             TxnNumber txnNum,
+                             const repl::OplogEntry& lastEntry) {
+    DBDirectClient client(opCtx);
+    client.insert(NamespaceString::kSessionTransactionsTableNamespace, [&] {
+        SessionTxnRecord sessionRecord;
+        sessionRecord.setSessionId(sessionId);
+        sessionRecord.setTxnNum(txnNum);
+        sessionRecord.setLastWriteOpTime(lastEntry.getOpTime());
+        sessionRecord.setLastWriteDate(lastEntry.getWallClockTime());
+        return sessionRecord.toBSON();
+    }());
+}
+
+TEST_F(TransactionParticipantRetryableWritesTest,
+       RefreshAfterFailoverUsesHistoryCachedWhileApplyingAsSecondary) {
+    const auto sessionId = *opCtx()->getLogicalSessionId();
+    const TxnNumber txnNum = 2;
+
+    // Apply the whole chain as a secondary would before stepping up. The oplog entries are not
+    // written, so the session can only be loaded without incomplete history if it does not walk
+    // the oplog.
+    const auto entries = makeRetryableWriteChain(sessionId, txnNum);
+    for (const auto& entry : entries) {
+        RetryableWriteHistoryCache::get(opCtx())->observeOplogEntry(entry);
+    }
+    insertTxnRecordForChain(opCtx(), sessionId, txnNum, entries.back());
+
+    auto txnParticipant = TransactionParticipant::get(opCtx());
+    txnParticipant.refreshFromStorageIfNeeded(opCtx());
+
+    for (StmtId stmtId = 0; stmtId <= 3; ++stmtId) {
+        ASSERT(txnParticipant.checkStatementExecuted(opCtx(), stmtId));
+    }
+    ASSERT_FALSE(txnParticipant.checkStatementExecuted(opCtx(), 4));
+}
+
+TEST_F(TransactionParticipantRetryableWritesTest,
+       RefreshAfterFailoverOnlyReadsOplogWrittenAfterCachedHistory) {
+    const auto sessionId = *opCtx()->getLogicalSessionId();
+    const TxnNumber txnNum = 2;
+
+    // Only the first two entries were applied before stepping up. The last one is in the oplog, as
+    // if it was written by this node as primary.
+    const auto entries = makeRetryableWriteChain(sessionId, txnNum);
+    RetryableWriteHistoryCache::get(opCtx())->observeOplogEntry(entries[0]);
+    RetryableWriteHistoryCache::get(opCtx())->observeOplogEntry(entries[1]);
+    insertOplogEntry(entries[2]);
+    insertTxnRecordForChain(opCtx(), sessionId, txnNum, entries.back());
+
+    auto txnParticipant = TransactionParticipant::get(opCtx());
+    txnParticipant.refreshFromStorageIfNeeded(opCtx());
+
+    for (StmtId stmtId = 0; stmtId <= 3; ++stmtId) {
+        ASSERT(txnParticipant.checkStatementExecuted(opCtx(), stmtId));
+    }
+    ASSERT(txnParticipant.checkStatementExecutedAndFetchOplogEntry(opCtx(), 3));
+
+    // The loaded history is cached up to the last write, so the next load reads nothing.
+    auto cached = RetryableWriteHistoryCache::get(opCtx())->find(sessionId, txnNum);
+    ASSERT(cached);
+    ASSERT_EQ(cached->lastWriteOpTime, entries[2].getOpTime());
+    ASSERT_EQ(cached->committedStatements.numStatements(), 4U);
+}
+
+TEST_F(TransactionParticipantRetryableWritesTest, RefreshIgnoresCachedHistoryOfAnotherChain) {
+    const auto sessionId = *opCtx()->getLogicalSessionId();
+    const TxnNumber txnNum = 2;
+
+    // The cached chain has the same txnNumber but is not a prefix of the chain in the oplog, which
+    // is missing its first entry.
+    OperationSessionInfo osi;
+    osi.setSessionId(sessionId);
+    osi.setTxnNumber(txnNum);
+    RetryableWriteHistoryCache::get(opCtx())->observeOplogEntry(
+        makeOplogEntry(repl::OpTime(Timestamp(90, 0), 0),
+                       repl::OpTypeEnum::kInsert,
+                       BSON("x" << 0),
+                       osi,
+                       Date_t::now(),
+                       {0, 1},
+                       repl::OpTime()));
+
+    const auto entries = makeRetryableWriteChain(sessionId, txnNum);
+    insertOplogEntry(entries[1]);
+    insertOplogEntry(entries[2]);
+    insertTxnRecordForChain(opCtx(), sessionId, txnNum, entries.back());
+
+    auto txnParticipant = TransactionParticipant::get(opCtx());
+    txnParticipant.refreshFromStorageIfNeeded(opCtx());
+
+    ASSERT_THROWS_CODE(txnParticipant.checkStatementExecuted(opCtx(), 0),
+                       AssertionException,
+                       ErrorCodes::IncompleteTransactionHistory);
+    ASSERT(txnParticipant.checkStatementExecuted(opCtx(), 2));
+    ASSERT(txnParticipant.checkStatementExecuted(opCtx(), 3));
+}
+
 TEST_F(TransactionParticipantRetryableWritesTest, ErrorOnlyWhenStmtIdBeingCheckedIsNotInCache) {
     const auto uuid = UUID::gen();
     const auto sessionId = *opCtx()->getLogicalSessionId();
@@ -45,6 +45,7 @@
 #include "mongo/bson/bsonmisc.h"
 #include "mongo/bson/bsonobj.h"
 #include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/json.h"
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/catalog/index_catalog.h"
 #include "mongo/db/client.h"
@@ -271,5 +272,62 @@ TEST_F(QueryStageNearTest, EmptyResults) {
     assertAscendingAndValid(results);
 }
 
+// Returns the first stage of type 'stageName' found by walking down the 'inputStage' chain of an
+// explain stage tree.
+BSONObj findStage(BSONObj stage, StringData stageName) {
+    while (!stage.isEmpty() && stage["stage"].str() != stageName) {
+        const auto inputStage = stage["inputStage"];
+        stage = inputStage.isABSONObj() ? inputStage.Obj() : BSONObj();
+    }
+    return stage;
+}
+
+TEST(QueryStageNearExplainTest, GeoNear2DSphereReportsAnnuliAndDocsExamined) {
+    const auto opCtxHolder = cc().makeOperationContext();
+    OperationContext* const opCtx = opCtxHolder.get();
+    DBDirectClient client(opCtx);
+
+    const auto nss = NamespaceString::createNamespaceString_forTest("test.geoNearExplain");
+    client.dropCollection(nss);
+    ASSERT_OK(dbtests::createIndex(opCtx, nss.ns_forTest(), fromjson("{loc: '2dsphere'}")));
+    for (int x = -10; x <= 10; ++x) {
+        for (int y = -10; y <= 10; ++y) {
+            const auto point = BSON_ARRAY(x * 0.01 << y * 0.01);
+            client.insert(nss,
+                          BSON("loc" << BSON("type"
+                                             << "Point"
+                                             << "coordinates" << point)));
+        }
+    }
+
+    BSONObj explain;
+    ASSERT(client.runCommand(
+        nss.dbName(),
+        BSON("explain" << BSON("find" << nss.coll() << "filter"
+                                      << fromjson("{loc: {$near: {$geometry: {type: 'Point', "
+                                                  "coordinates: [0, 0]}}}}")
+                                      << "limit" << 10)
+                       << "verbosity"
+                       << "executionStats"),
+        explain))
+        << explain;
+
+    const auto executionStats = explain["executionStats"].Obj();
+    ASSERT_EQ(executionStats["nReturned"].numberLong(), 10) << explain;
+
+    const auto nearStage = findStage(executionStats["executionStages"].Obj(), "GEO_NEAR_2DSPHERE");
+    ASSERT_FALSE(nearStage.isEmpty()) << explain;
+    ASSERT_TRUE(nearStage.hasField("annuliExamined")) << nearStage;
+    ASSERT_TRUE(nearStage.hasField("docsExamined")) << nearStage;
+
+    const long long annuliExamined = nearStage["annuliExamined"].numberLong();
+    ASSERT_GTE(annuliExamined, 1) << nearStage;
+    ASSERT_EQ(annuliExamined,
+              static_cast<long long>(nearStage["searchIntervals"].Array().size()))
+        << nearStage;
+    ASSERT_GTE(nearStage["docsExamined"].numberLong(), 10) << nearStage;
+    ASSERT_LTE(nearStage["docsExamined"].numberLong(), 21 * 21) << nearStage;
+}
+
 }  // namespace
 }  // namespace mongo
@@ -0,0 +1,203 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+/**
+ * This file tests the top-K mode of db/exec/text_or.cpp against the default mode.
+ */
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/json.h"
+#include "mongo/client/dbclient_cursor.h"
+#include "mongo/db/client.h"
+#include "mongo/db/dbdirectclient.h"
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/query/find_command.h"
+#include "mongo/db/service_context.h"
+#include "mongo/dbtests/dbtests.h"  // IWYU pragma: keep
+#include "mongo/idl/server_parameter_test_util.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/framework.h"
+
+namespace mongo {
+namespace {
+
+const NamespaceString kTestNamespace =
+    NamespaceString::createNamespaceString_forTest("unittests.QueryStageTextOr");
+
+// Several documents share each text, so that their scores tie.
+const std::vector<std::pair<std::string, int>> kTexts = {
+    {"apple apple apple", 3},
+    {"apple banana", 4},
+    {"apple banana cherry date", 5},
+    {"banana cherry", 2},
+    {"cherry date elderberry fig", 3},
+    {"grape", 2},
+};
+
+using Result = std::pair<int, double>;  // _id and text score.
+
+class QueryStageTextOrTest : public unittest::Test {
+public:
+    void setUp() override {
+        _client.dropCollection(kTestNamespace);
+        ASSERT_OK(
+            dbtests::createIndex(_opCtx, kTestNamespace.ns_forTest(), fromjson("{text: 'text'}")));
+
+        int id = 0;
+        for (auto&& [text, copies] : kTexts) {
+            for (int i = 0; i < copies; ++i) {
+                _client.insert(kTestNamespace, BSON("_id" << id++ << "text" << text));
+            }
+        }
+    }
+
+protected:
+    /**
+     * Runs a $text query for 'search' sorted by text score, limited to 'limit' results if given,
+     * and returns the results in order.
+     */
+    std::vector<Result> runQuery(StringData search, bool topKEnabled, int limit = 0) {
+        RAIIServerParameterControllerForTest topK("internalQueryTextOrTopKEnabled", topKEnabled);
+
+        FindCommandRequest findRequest{kTestNamespace};
+        findRequest.setFilter(BSON("$text" << BSON("$search" << search)));
+        findRequest.setProjection(fromjson("{score: {$meta: 'textScore'}}"));
+        findRequest.setSort(fromjson("{score: {$meta: 'textScore'}}"));
+        if (limit) {
+            findRequest.setLimit(limit);
+        }
+
+        std::vector<Result> results;
+        auto cursor = _client.find(std::move(findRequest));
+        while (cursor->more()) {
+            auto obj = cursor->next();
+            results.emplace_back(obj["_id"].numberInt(), obj["score"].numberDouble());
+        }
+        return results;
+    }
+
+    /**
+     * Returns the topK reported by the TEXT_OR stage of a limited $text query for 'search'.
+     */
+    long long explainTopK(StringData search, int limit) {
+        RAIIServerParameterControllerForTest topK("internalQueryTextOrTopKEnabled", true);
+
+        BSONObj explain;
+        ASSERT(_client.runCommand(
+            kTestNamespace.dbName(),
+            BSON("explain" << BSON("find" << kTestNamespace.coll() << "filter"
+                                          << BSON("$text" << BSON("$search" << search)) << "sort"
+                                          << fromjson("{score: {$meta: 'textScore'}}") << "limit"
+                                          << limit)
+                           << "verbosity"
+                           << "queryPlanner"),
+            explain))
+            << explain;
+
+        BSONObj stage = explain["queryPlanner"]["winningPlan"].Obj();
+        while (stage["stage"].str() != "TEXT_OR") {
+            const auto inputStage = stage["inputStage"];
+            ASSERT_TRUE(inputStage.isABSONObj()) << explain;
+            stage = inputStage.Obj();
+        }
+        return stage["topK"].numberLong();
+    }
+
+    /**
+     * Checks that the top-K mode returns the same scores as the default mode for every limit up to
+     * past the number of matches, and that every document it returns has the score the default
+     * mode gives it. Documents whose scores tie may come back in a different order, or a different
+     * subset of them may make the limit, in either mode.
+     */
+    void assertTopKMatchesDefault(StringData search) {
+        const auto allResults = runQuery(search, false /* topKEnabled */);
+        ASSERT_FALSE(allResults.empty());
+        const std::map<int, double> scoreById(allResults.begin(), allResults.end());
+
+        for (int limit = 1; limit <= static_cast<int>(allResults.size()) + 2; ++limit) {
+            const auto expected = runQuery(search, false /* topKEnabled */, limit);
+            const auto actual = runQuery(search, true /* topKEnabled */, limit);
+            ASSERT_EQ(expected.size(), actual.size()) << search << " limit " << limit;
+
+            for (size_t i = 0; i < actual.size(); ++i) {
+                ASSERT_EQ(expected[i].second, actual[i].second)
+                    << search << " limit " << limit << " position " << i;
+
+                auto it = scoreById.find(actual[i].first);
+                ASSERT(it != scoreById.end()) << search << " returned _id " << actual[i].first;
+                ASSERT_EQ(it->second, actual[i].second) << search << " _id " << actual[i].first;
+            }
+        }
+    }
+
+    const ServiceContext::UniqueOperationContext _uniqOpCtx = cc().makeOperationContext();
+    OperationContext* const _opCtx = _uniqOpCtx.get();
+    DBDirectClient _client{_opCtx};
+
+    RAIIServerParameterControllerForTest _classicEngine{"internalQueryFrameworkControl",
+                                                        "forceClassicEngine"};
+};
+
+TEST_F(QueryStageTextOrTest, LimitedTextScoreSortUsesTopK) {
+    ASSERT_EQ(explainTopK("apple", 3), 3);
+}
+
+TEST_F(QueryStageTextOrTest, SingleTermMatchesDefault) {
+    assertTopKMatchesDefault("apple");
+}
+
+TEST_F(QueryStageTextOrTest, MultipleTermsMatchDefault) {
+    assertTopKMatchesDefault("apple banana");
+    assertTopKMatchesDefault("banana cherry fig");
+}
+
+TEST_F(QueryStageTextOrTest, LimitLargerThanMatchesReturnsEveryMatch) {
+    const auto allResults = runQuery("grape", false /* topKEnabled */);
+    ASSERT_EQ(allResults.size(), 2u);
+
+    const auto topKResults = runQuery("grape", true /* topKEnabled */, 100);
+    ASSERT_EQ(topKResults.size(), 2u);
+    for (auto&& [id, score] : topKResults) {
+        ASSERT_EQ(score, allResults[0].second) << id;
+    }
+}
+
+TEST_F(QueryStageTextOrTest, NoMatchesReturnsNothing) {
+    ASSERT_TRUE(runQuery("kiwi", true /* topKEnabled */, 5).empty());
+}
+
+}  // namespace
+}  // namespace mongo
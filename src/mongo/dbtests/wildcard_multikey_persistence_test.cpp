@@ -46,6 +46,7 @@
 #include "mongo/bson/json.h"
 #include "mongo/bson/ordering.h"
 #include "mongo/bson/timestamp.h"
+#include "mongo/db/catalog/catalog_control.h"
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/catalog/collection_options.h"
 #include "mongo/db/catalog/index_catalog.h"
@@ -56,10 +57,14 @@
 #include "mongo/db/concurrency/d_concurrency.h"
 #include "mongo/db/concurrency/lock_manager_defs.h"
 #include "mongo/db/db_raii.h"
+#include "mongo/db/dbdirectclient.h"
 #include "mongo/db/field_ref.h"
 #include "mongo/db/index/index_access_method.h"
 #include "mongo/db/index/index_descriptor.h"
 #include "mongo/db/index/multikey_metadata_access_stats.h"
+#include "mongo/db/index/wildcard_access_method.h"
+#include "mongo/db/index/wildcard_path_statistics.h"
+#include "mongo/db/index/wildcard_path_statistics_flusher.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/pipeline/dependencies.h"
@@ -75,9 +80,11 @@
 #include "mongo/db/storage/snapshot.h"
 #include "mongo/db/storage/sorted_data_interface.h"
 #include "mongo/db/storage/write_unit_of_work.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
+#include "mongo/stdx/unordered_set.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/bson_test_util.h"
 #include "mongo/unittest/framework.h"
@@ -204,6 +211,39 @@ protected:
         ASSERT(expectedFieldRefs == multikeyPathSet);
     }
 
+    /**
+     * Returns the multikey paths among 'fields' reported by the index access method associated
+     * with 'indexName', as the query planner looks them up, and stores the access stats in 'stats'.
+     */
+    std::set<FieldRef> getMultikeyPathSetForFields(
+        const stdx::unordered_set<std::string>& fields,
+        MultikeyMetadataAccessStats* stats,
+        const NamespaceString& nss = kDefaultNSS,
+        const std::string& indexName = kDefaultIndexName) {
+        AutoGetCollectionForRead collection(opCtx(), nss);
+        auto indexEntry = getIndexCatalogEntry(collection.getCollection(), indexName);
+        return getWildcardMultikeyPathSet(opCtx(), indexEntry, fields, stats);
+    }
+
+    void assertDropIndex(const NamespaceString& nss = kDefaultNSS,
+                         const std::string& indexName = kDefaultIndexName) {
+        DBDirectClient client(opCtx());
+        client.dropIndex(nss, indexName);
+    }
+
+    /**
+     * Simulates a restart by closing and reopening the catalog, which discards all in-memory index
+     * state.
+     */
+    void restartCatalog() {
+        auto stableTimestamp =
+            _storage.getLastStableRecoveryTimestamp(opCtx()->getServiceContext());
+
+        Lock::GlobalLock globalLk(opCtx(), MODE_X);
+        auto catalogState = catalog::closeCatalog(opCtx());
+        catalog::openCatalog(opCtx(), catalogState, stableTimestamp.value_or(Timestamp()));
+    }
+
     void assertRecreateCollection(const NamespaceString& nss) {
         ASSERT_OK(_storage.dropCollection(opCtx(), nss));
         ASSERT_OK(_storage.createCollection(opCtx(), nss, collOptions()));
@@ -298,6 +338,32 @@ protected:
             ->newCursor(opCtx());
     }
 
+    const WildcardPathStatistics& getPathStatistics(const CollectionPtr& collection,
+                                                    const StringData indexName) {
+        return static_cast<const WildcardAccessMethod*>(
+                   getIndexCatalogEntry(collection, indexName)->accessMethod())
+            ->getPathStatistics();
+    }
+
+    /**
+     * Returns the statistics of 'path' in the index 'indexName' after persisting the statistics of
+     * every wildcard index.
+     */
+    boost::optional<WildcardPathStatistics::PathSummary> flushAndGetPathStatistics(
+        StringData path,
+        const NamespaceString& nss = kDefaultNSS,
+        const std::string& indexName = kDefaultIndexName) {
+        flushWildcardPathStatistics(opCtx());
+        AutoGetCollectionForRead collection(opCtx(), nss);
+        return getPathStatistics(collection.getCollection(), indexName).getPath(path);
+    }
+
+    std::string getIndexIdent(const NamespaceString& nss = kDefaultNSS,
+                              const std::string& indexName = kDefaultIndexName) {
+        AutoGetCollectionForRead collection(opCtx(), nss);
+        return getIndexCatalogEntry(collection.getCollection(), indexName)->getIdent();
+    }
+
     CollectionOptions collOptions() {
         CollectionOptions collOpts;
         collOpts.uuid = UUID::gen();
@@ -852,5 +918,192 @@ TEST_F(WildcardMultikeyPersistenceTestFixture, IndexShouldBecomeMultikeyIfArrayI
     assertMultikeyPathSetEquals({"g.h"});
 }
 
+std::set<FieldRef> toFieldRefs(const std::vector<std::string>& paths) {
+    return {paths.begin(), paths.end()};
+}
+
+TEST_F(WildcardMultikeyPersistenceTestFixture, MultikeyPathSummaryServesLookupsAfterFirstScan) {
+    RAIIServerParameterControllerForTest summaryEnabled(
+        "internalQueryWildcardMultikeyPathCacheEnabled", true);
+    assertSetupEnvironment(false, makeDocs({"{a: [1], b: {c: [2], d: 3}}"}));
+
+    // The first lookup seeds the summary with a scan of the metadata keys.
+    MultikeyMetadataAccessStats stats;
+    ASSERT(toFieldRefs({"a", "b.c"}) ==
+           getMultikeyPathSetForFields({"a", "b.c", "b.d"}, &stats));
+    ASSERT_GT(stats.keysExamined, 0u);
+
+    // Later lookups are answered from the summary without touching the index.
+    stats = {};
+    ASSERT(toFieldRefs({"b.c"}) == getMultikeyPathSetForFields({"b.c", "b.d"}, &stats));
+    ASSERT_EQ(stats.keysExamined, 0u);
+    ASSERT_EQ(stats.numSeeks, 0u);
+
+    // A numeric path component makes every multikey path below the non-numeric prefix relevant,
+    // as it does for the index bounds.
+    stats = {};
+    ASSERT(toFieldRefs({"b.c"}) == getMultikeyPathSetForFields({"b.0"}, &stats));
+    ASSERT_EQ(stats.keysExamined, 0u);
+}
+
+TEST_F(WildcardMultikeyPersistenceTestFixture, MultikeyPathSummaryIncludesNewMultikeyPaths) {
+    RAIIServerParameterControllerForTest summaryEnabled(
+        "internalQueryWildcardMultikeyPathCacheEnabled", true);
+    assertSetupEnvironment(false, makeDocs({"{a: [1], b: {c: 2}}"}));
+
+    MultikeyMetadataAccessStats stats;
+    ASSERT(toFieldRefs({"a"}) == getMultikeyPathSetForFields({"a", "b.c", "d"}, &stats));
+
+    // An insert and an update each make a new path multikey once the summary has been seeded.
+    assertInsertDocuments(makeDocs({"{d: [1, 2]}"}));
+    assertUpdateDocuments({{fromjson("{_id: 1}"), fromjson("{$set: {'b.c': [2, 3]}}")}});
+
+    stats = {};
+    ASSERT(toFieldRefs({"a", "b.c", "d"}) ==
+           getMultikeyPathSetForFields({"a", "b.c", "d"}, &stats));
+    ASSERT_EQ(stats.keysExamined, 0u);
+
+    // The summary agrees with a full scan of the metadata keys.
+    assertMultikeyPathSetEquals({"a", "b.c", "d"});
+}
+
+TEST_F(WildcardMultikeyPersistenceTestFixture, MultikeyPathSummaryIsDiscardedWhenIndexIsDropped) {
+    RAIIServerParameterControllerForTest summaryEnabled(
+        "internalQueryWildcardMultikeyPathCacheEnabled", true);
+    const auto docs = makeDocs({"{a: [1], b: 2}"});
+    assertSetupEnvironment(false, docs);
+
+    MultikeyMetadataAccessStats stats;
+    ASSERT(toFieldRefs({"a"}) == getMultikeyPathSetForFields({"a", "b"}, &stats));
+
+    // Rebuild the index after replacing the only array with a scalar. The rebuilt index starts
+    // with an empty summary, so 'a' must not be reported as multikey any more.
+    assertDropIndex();
+    assertRemoveDocuments(docs);
+    assertInsertDocuments(makeDocs({"{a: 1, b: [2]}"}));
+    assertCreateIndexForColl(
+        kDefaultNSS, kDefaultIndexName, kDefaultIndexKey, kDefaultPathProjection, false);
+
+    stats = {};
+    ASSERT(toFieldRefs({"b"}) == getMultikeyPathSetForFields({"a", "b"}, &stats));
+    ASSERT_GT(stats.keysExamined, 0u);
+    assertMultikeyPathSetEquals({"b"});
+}
+
+TEST_F(WildcardMultikeyPersistenceTestFixture, MultikeyPathSummaryIsRebuiltAfterRestart) {
+    RAIIServerParameterControllerForTest summaryEnabled(
+        "internalQueryWildcardMultikeyPathCacheEnabled", true);
+    assertSetupEnvironment(false, makeDocs({"{a: [1]}"}));
+
+    MultikeyMetadataAccessStats stats;
+    ASSERT(toFieldRefs({"a"}) == getMultikeyPathSetForFields({"a", "b"}, &stats));
+    assertInsertDocuments(makeDocs({"{b: [1]}"}));
+
+    restartCatalog();
+
+    // The summary does not survive the restart, so the first lookup scans the metadata keys
+    // again, and finds both the paths recorded before and after the summary was seeded.
+    stats = {};
+    ASSERT(toFieldRefs({"a", "b"}) == getMultikeyPathSetForFields({"a", "b"}, &stats));
+    ASSERT_GT(stats.keysExamined, 0u);
+
+    stats = {};
+    ASSERT(toFieldRefs({"a", "b"}) == getMultikeyPathSetForFields({"a", "b"}, &stats));
+    ASSERT_EQ(stats.keysExamined, 0u);
+}
+
+TEST_F(WildcardMultikeyPersistenceTestFixture, MultikeyPathSummaryUnusedWhenDisabled) {
+    RAIIServerParameterControllerForTest summaryEnabled(
+        "internalQueryWildcardMultikeyPathCacheEnabled", false);
+    assertSetupEnvironment(false, makeDocs({"{a: [1], b: 2}"}));
+
+    for (int i = 0; i < 2; ++i) {
+        MultikeyMetadataAccessStats stats;
+        ASSERT(toFieldRefs({"a"}) == getMultikeyPathSetForFields({"a", "b"}, &stats));
+        ASSERT_GT(stats.keysExamined, 0u);
+    }
+}
+
+TEST_F(WildcardMultikeyPersistenceTestFixture, PathStatisticsCountIndexBuildAndWrites) {
+    assertSetupEnvironment(false, makeDocs({"{a: 2, b: [1, 2]}", "{a: 2, b: [2]}"}));
+    assertInsertDocuments(makeDocs({"{a: 2, c: 'x'}"}));
+    assertUpdateDocuments({{BSON(kIdField << 2), fromjson("{$set: {b: [3, 3, 4]}}")}});
+    assertRemoveDocuments({BSON(kIdField << 1)});
+
+    auto a = flushAndGetPathStatistics("a");
+    ASSERT(a);
+    ASSERT_EQ(a->numKeys, 2);
+    ASSERT_EQ(a->numDistinctValues, 1);
+    ASSERT_FALSE(a->multikey);
+
+    // Equal values of one document are a single index key.
+    auto b = flushAndGetPathStatistics("b");
+    ASSERT(b);
+    ASSERT_EQ(b->numKeys, 2);
+    ASSERT(b->multikey);
+
+    auto c = flushAndGetPathStatistics("c");
+    ASSERT(c);
+    ASSERT_EQ(c->numKeys, 1);
+    ASSERT_EQ(c->numDistinctValues, 1);
+    ASSERT_FALSE(flushAndGetPathStatistics("d"));
+}
+
+TEST_F(WildcardMultikeyPersistenceTestFixture, PathStatisticsArePersistedAndLoaded) {
+    assertSetupEnvironment(false, makeDocs({"{a: 1, b: [1, 2]}", "{a: 2, c: 1}"}));
+    ASSERT(flushAndGetPathStatistics("a"));
+
+    const auto ident = getIndexIdent();
+    DBDirectClient client(opCtx());
+    ASSERT_EQ(3,
+              client.count(NamespaceString::kWildcardPathStatisticsNamespace,
+                           BSON("_id.ident" << ident)));
+
+    // Statistics loaded from disk are added to the changes recorded before loading.
+    WildcardPathStatistics loaded;
+    loaded.recordKeys({{"a", 0}}, -1);
+    loadWildcardPathStatistics(opCtx(), ident, loaded);
+    ASSERT(loaded.isLoaded());
+    loaded.fold();
+
+    auto a = loaded.getPath("a");
+    ASSERT(a);
+    ASSERT_EQ(a->numKeys, 1);
+    auto b = loaded.getPath("b");
+    ASSERT(b);
+    ASSERT_EQ(b->numKeys, 2);
+    ASSERT_GTE(b->numDistinctValues, 1);
+    ASSERT_LTE(b->numDistinctValues, 2);
+    ASSERT(b->multikey);
+
+    // A path left without keys is removed from disk.
+    assertRemoveDocuments({BSON("c" << BSON("$exists" << true))});
+    ASSERT_FALSE(flushAndGetPathStatistics("c"));
+    ASSERT_EQ(0,
+              client.count(NamespaceString::kWildcardPathStatisticsNamespace,
+                           BSON("_id.ident" << ident << "_id.path"
+                                            << "c")));
+}
+
+TEST_F(WildcardMultikeyPersistenceTestFixture, PathStatisticsSurviveCatalogRestart) {
+    assertSetupEnvironment(false, makeDocs({"{a: 1}"}));
+    restartCatalog();
+    assertInsertDocuments(makeDocs({"{a: 1}"}));
+
+    auto a = flushAndGetPathStatistics("a");
+    ASSERT(a);
+    ASSERT_EQ(a->numKeys, 2);
+    ASSERT_EQ(a->numDistinctValues, 1);
+}
+
+TEST_F(WildcardMultikeyPersistenceTestFixture, PathStatisticsNotCountedWhenDisabled) {
+    RAIIServerParameterControllerForTest statisticsEnabled(
+        "internalWildcardIndexPathStatisticsEnabled", false);
+    assertSetupEnvironment(false, makeDocs({"{a: 1}"}));
+    assertInsertDocuments(makeDocs({"{a: 2}"}));
+
+    ASSERT_FALSE(flushAndGetPathStatistics("a"));
+}
+
 }  // namespace
 }  // namespace mongo
@@ -764,6 +764,22 @@ bool ChunkManager::keyBelongsToShard(const BSONObj& shardKey, const ShardId& sha
     return (*it)->getShardIdAt(_clusterTime) == shardId;
 }
 
+boost::optional<Chunk> ChunkManager::findChunkContainingKey(const BSONObj& shardKey) const {
+    tassert(9886600, "Expected routing table to be initialized", _rt->optRt);
+
+    if (shardKey.isEmpty()) {
+        return boost::none;
+    }
+
+    const auto& chunkMap = _rt->optRt->_chunkMap;
+    auto it = chunkMap.find(shardKey);
+    if (it == chunkMap.end()) {
+        return boost::none;
+    }
+
+    return Chunk(*(*it).get(), _clusterTime);
+}
+
 ChunkManager::ChunkOwnership ChunkManager::nearestOwnedChunk(const BSONObj& shardKey,
                                                              const ShardId& shardId,
                                                              ChunkMap::Direction direction) const {
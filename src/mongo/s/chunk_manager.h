@@ -839,6 +839,13 @@ public:
      */
     bool keyBelongsToShard(const BSONObj& shardKey, const ShardId& shardId) const;
 
+    /**
+     * Returns the chunk which contains "shardKey", or boost::none if "shardKey" is empty or no
+     * chunk contains it. Unlike findIntersectingChunk(), this ignores collation and does not throw.
+     * If "shardKey" is not a valid shard key, the behaviour is undefined.
+     */
+    boost::optional<Chunk> findChunkContainingKey(const BSONObj& shardKey) const;
+
     struct ChunkOwnership {
         bool containsShardKey;
         boost::optional<Chunk> nearestOwnedChunk;
@@ -0,0 +1,158 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <functional>
+#include <string>
+#include <utility>
+
+#include <boost/optional/optional.hpp>
+
+#include "mongo/base/error_codes.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/admission/execution_admission_context.h"
+#include "mongo/db/auth/action_type.h"
+#include "mongo/db/auth/authorization_session.h"
+#include "mongo/db/auth/resource_pattern.h"
+#include "mongo/db/commands.h"
+#include "mongo/db/curop.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/service_context.h"
+#include "mongo/s/commands/cluster_topology_subscription_cmd_gen.h"
+#include "mongo/s/topology_subscription.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/clock_source.h"
+#include "mongo/util/concurrency/admission_context.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/scopeguard.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+namespace {
+
+class TopologySubscriptionCommand : public TypedCommand<TopologySubscriptionCommand> {
+public:
+    using Request = ClusterTopologySubscription;
+
+    class Invocation final : public InvocationBase {
+    public:
+        using InvocationBase::InvocationBase;
+
+        /**
+         * Copies the topology, which is serialized once per topology change and shared by every
+         * waiting request, into the reply.
+         */
+        class Response {
+        public:
+            Response(BSONObj obj) : _obj(std::move(obj)) {}
+
+            void serialize(BSONObjBuilder* builder) const {
+                builder->appendElements(_obj);
+            }
+
+        private:
+            const BSONObj _obj;
+        };
+
+        Response typedRun(OperationContext* opCtx) {
+            // Like hello, this is how clients monitor the cluster, so it must not queue behind
+            // regular operations.
+            ScopedAdmissionPriority<ExecutionAdmissionContext> skipAdmissionControl(
+                opCtx, AdmissionContext::Priority::kExempt);
+
+            CommandHelpers::handleMarkKillOnClientDisconnect(opCtx);
+
+            // maxAwaitTimeMS must be present if and only if topologyVersion is, as for the
+            // awaitable hello protocol.
+            const auto& clientTopologyVersion = request().getTopologyVersion();
+            const auto maxAwaitTimeMS = request().getMaxAwaitTimeMS();
+            uassert(9886617,
+                    (clientTopologyVersion
+                         ? "A request with a 'topologyVersion' must include 'maxAwaitTimeMS'"
+                         : "A request with 'maxAwaitTimeMS' must include a 'topologyVersion'"),
+                    clientTopologyVersion.has_value() == maxAwaitTimeMS.has_value());
+
+            boost::optional<Date_t> deadline;
+            boost::optional<ScopeGuard<std::function<void()>>> timerGuard;
+            if (clientTopologyVersion) {
+                uassert(9886618,
+                        "topologyVersion must have a non-negative counter",
+                        clientTopologyVersion->getCounter() >= 0);
+
+                deadline = opCtx->getServiceContext()->getPreciseClockSource()->now() +
+                    Milliseconds(*maxAwaitTimeMS);
+
+                // Time spent waiting for a topology change is not time spent executing.
+                auto curOp = CurOp::get(opCtx);
+                curOp->pauseTimer();
+                timerGuard.emplace([curOp]() { curOp->resumeTimer(); });
+            }
+
+            return Response(TopologySubscription::get(opCtx)->awaitTopology(
+                opCtx, clientTopologyVersion, deadline));
+        }
+
+    private:
+        NamespaceString ns() const override {
+            return NamespaceString(request().getDbName());
+        }
+
+        bool supportsWriteConcern() const override {
+            return false;
+        }
+
+        void doCheckAuthorization(OperationContext* opCtx) const override {
+            // The reply lists the hosts of every shard, which listShards also reveals.
+            auto authorizationSession = AuthorizationSession::get(opCtx->getClient());
+            uassert(
+                ErrorCodes::Unauthorized,
+                "Unauthorized",
+                authorizationSession->isAuthorizedForActionsOnResource(
+                    ResourcePattern::forClusterResource(authorizationSession->getUserTenantId()),
+                    ActionType::listShards));
+        }
+    };
+
+    AllowedOnSecondary secondaryAllowed(ServiceContext*) const override {
+        return AllowedOnSecondary::kAlways;
+    }
+
+    bool adminOnly() const override {
+        return true;
+    }
+
+    std::string help() const override {
+        return "Returns the topology of every replica set monitored by this mongos. With "
+               "topologyVersion and maxAwaitTimeMS, waits for the topology to change first.";
+    }
+};
+MONGO_REGISTER_COMMAND(TopologySubscriptionCommand).forRouter();
+
+}  // namespace
+}  // namespace mongo
@@ -126,11 +126,13 @@
 #include "mongo/s/read_write_concern_defaults_cache_lookup_mongos.h"
 #include "mongo/s/resource_yielders.h"
 #include "mongo/s/router_uptime_reporter.h"
+#include "mongo/s/routing_table_change_listener.h"
 #include "mongo/s/service_entry_point_router_role.h"
 #include "mongo/s/session_catalog_router.h"
 #include "mongo/s/sessions_collection_sharded.h"
 #include "mongo/s/sharding_initialization.h"
 #include "mongo/s/sharding_state.h"
+#include "mongo/s/topology_subscription.h"
 #include "mongo/s/transaction_router.h"
 #include "mongo/s/version_mongos.h"
 #include "mongo/scripting/engine.h"
@@ -573,6 +575,10 @@ Status initializeSharding(
     OperationContext* opCtx,
     std::shared_ptr<ReplicaSetChangeNotifier::Listener>* replicaSetChangeListener,
     BSONObjBuilder* startupTimeElapsedBuilder) {
+    // The notifier does not replay the sets it already knows about to new listeners, so the
+    // topology subscription must listen before the first replica set monitor is created.
+    TopologySubscription::get(opCtx)->startListening(ReplicaSetMonitor::getNotifier());
+
     auto targeterFactory = std::make_unique<RemoteCommandTargeterFactoryImpl>();
     auto targeterFactoryPtr = targeterFactory.get();
 
@@ -908,6 +914,7 @@ ExitCode runMongosServer(ServiceContext* serviceContext) {
     // Construct the router uptime reporter after the startup parameters have been parsed in order
     // to ensure that it picks up the server port instead of reporting the default value.
     RouterUptimeReporter::get(serviceContext).startPeriodicThread(serviceContext);
+    RoutingTableChangeListener::get(serviceContext).startPeriodicThread(serviceContext);
 
     clusterCursorCleanupJob.go();
 
@@ -0,0 +1,223 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/s/routing_table_change_listener.h"
+
+#include <boost/optional/optional.hpp>
+
+#include "mongo/base/error_codes.h"
+#include "mongo/base/status.h"
+#include "mongo/bson/oid.h"
+#include "mongo/client/read_preference.h"
+#include "mongo/db/client.h"
+#include "mongo/db/commands/server_status_metric.h"
+#include "mongo/db/database_name.h"
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/server_options.h"
+#include "mongo/idl/idl_parser.h"
+#include "mongo/logv2/log.h"
+#include "mongo/s/catalog_cache.h"
+#include "mongo/s/client/shard.h"
+#include "mongo/s/grid.h"
+#include "mongo/s/mongod_and_mongos_server_parameters_gen.h"
+#include "mongo/s/request_types/routing_table_changes_gen.h"
+#include "mongo/s/sharding_feature_flags_gen.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/concurrency/idle_thread_block.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/exit.h"
+#include "mongo/util/fail_point.h"
+#include "mongo/util/time_support.h"
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kSharding
+
+
+namespace mongo {
+namespace {
+
+MONGO_FAIL_POINT_DEFINE(hangBeforeApplyingRoutingTableChanges);
+
+const auto getRoutingTableChangeListener =
+    ServiceContext::declareDecoration<RoutingTableChangeListener>();
+
+// How long the config server is asked to hold each request when there are no changes to report.
+const Milliseconds kMaxAwaitTime(10 * 1000);
+
+// How long to wait before asking again after a failed request or while the listener is disabled.
+const Seconds kRetryInterval(1);
+
+// How long to wait before asking again when the config server does not support the request, which
+// only changes once it is upgraded.
+const Minutes kUnsupportedRetryInterval(1);
+
+auto& routingTableChangesReceived =
+    *MetricBuilder<Counter64>("routingTableChangeListener.changesReceived");
+auto& routingTableRefreshesTriggered =
+    *MetricBuilder<Counter64>("routingTableChangeListener.refreshesTriggered");
+auto& routingTableIncompleteHistories =
+    *MetricBuilder<Counter64>("routingTableChangeListener.incompleteHistories");
+
+/**
+ * Marks the cached routing table of the collection as stale if it is older than the pushed version
+ * and refreshes it. Collections which this router has not cached are left to be loaded on first
+ * use. This method is best-effort and never throws.
+ */
+void applyChange(OperationContext* opCtx, const GossipedRoutingCache& change) {
+    const auto& nss = change.getNss();
+    const auto catalogCache = Grid::get(opCtx)->catalogCache();
+
+    const auto cachedVersion = catalogCache->peekCollectionCacheVersion(nss);
+    if (!cachedVersion || !cachedVersion->isOlderThan(change.getCollectionVersion())) {
+        return;
+    }
+
+    catalogCache->advanceCollectionTimeInStore(nss, change.getCollectionVersion());
+    routingTableRefreshesTriggered.increment();
+
+    // The refresh is only done so that the next request for this collection does not have to wait
+    // for it. Failing to do it is not a problem since the entry is already marked as stale.
+    const auto status = catalogCache->getCollectionRoutingInfo(opCtx, nss).getStatus();
+    if (!status.isOK()) {
+        LOGV2_DEBUG(9886603,
+                    1,
+                    "Failed to refresh the routing table after it was pushed by the config server",
+                    logAttrs(nss),
+                    "error"_attr = redact(status));
+    }
+}
+
+/**
+ * Waits for the config server to report the routing table changes after 'sequenceNumber' of the
+ * history identified by 'historyId', applies them and advances both to the returned values.
+ */
+void waitForAndApplyChanges(OperationContext* opCtx,
+                            boost::optional<OID>& historyId,
+                            long long& sequenceNumber) {
+    ConfigsvrGetRoutingTableChanges request;
+    request.setDbName(DatabaseName::kAdmin);
+    request.setHistoryId(historyId);
+    request.setAfterSequenceNumber(sequenceNumber);
+    request.setMaxAwaitTimeMS(durationCount<Milliseconds>(kMaxAwaitTime));
+
+    const auto configShard = Grid::get(opCtx)->shardRegistry()->getConfigShard();
+    auto cmdResponse = uassertStatusOK(configShard->runCommandWithFixedRetryAttempts(
+        opCtx,
+        ReadPreferenceSetting{ReadPreference::PrimaryOnly},
+        DatabaseName::kAdmin,
+        request.toBSON(),
+        Shard::RetryPolicy::kIdempotent));
+    uassertStatusOK(cmdResponse.commandStatus);
+
+    const auto response = ConfigsvrGetRoutingTableChangesResponse::parse(
+        IDLParserContext("ConfigsvrGetRoutingTableChangesResponse"), cmdResponse.response);
+
+    // The first response of every history only establishes where to start listening from, so there
+    // is nothing to apply from it. Changes which were missed while switching histories, or which
+    // the config server no longer remembers, will be found through the usual stale version checks.
+    if (!response.getComplete() && historyId) {
+        routingTableIncompleteHistories.increment();
+    }
+
+    if (historyId == response.getHistoryId()) {
+        hangBeforeApplyingRoutingTableChanges.pauseWhileSet(opCtx);
+
+        routingTableChangesReceived.increment(response.getChanges().size());
+        for (const auto& change : response.getChanges()) {
+            applyChange(opCtx, change);
+        }
+    }
+
+    historyId = response.getHistoryId();
+    sequenceNumber = response.getSequenceNumber();
+}
+
+}  // namespace
+
+RoutingTableChangeListener& RoutingTableChangeListener::get(ServiceContext* serviceContext) {
+    return getRoutingTableChangeListener(serviceContext);
+}
+
+void RoutingTableChangeListener::startPeriodicThread(ServiceContext* serviceContext) {
+    invariant(!_thread.joinable());
+
+    _thread = stdx::thread([serviceContext] {
+        Client::initThread("RoutingTableChangeListener",
+                           serviceContext->getService(ClusterRole::RouterServer));
+
+        {
+            stdx::lock_guard<Client> lk(cc());
+            cc().setSystemOperationUnkillableByStepdown(lk);
+        }
+
+        boost::optional<OID> historyId;
+        long long sequenceNumber = 0;
+
+        while (!globalInShutdownDeprecated()) {
+            if (!gRoutingTableChangeListenerEnabled.load() ||
+                !feature_flags::gRoutingTableChangeNotifications.isEnabled(
+                    serverGlobalParams.featureCompatibility.acquireFCVSnapshot())) {
+                // Changes pushed while disabled are not applied, so start over once re-enabled.
+                historyId = boost::none;
+                sequenceNumber = 0;
+
+                MONGO_IDLE_THREAD_BLOCK;
+                sleepFor(kRetryInterval);
+                continue;
+            }
+
+            try {
+                auto opCtx = cc().makeOperationContext();
+                waitForAndApplyChanges(opCtx.get(), historyId, sequenceNumber);
+            } catch (const DBException& ex) {
+                if (ex.code() == ErrorCodes::CommandNotFound ||
+                    ex.code() == ErrorCodes::CommandNotSupported) {
+                    LOGV2_DEBUG(9886611,
+                                1,
+                                "The config server does not push routing table changes",
+                                "error"_attr = redact(ex));
+
+                    MONGO_IDLE_THREAD_BLOCK;
+                    sleepFor(kUnsupportedRetryInterval);
+                    continue;
+                }
+
+                LOGV2_DEBUG(9886604,
+                            1,
+                            "Failed to wait for routing table changes from the config server",
+                            "error"_attr = redact(ex));
+
+                MONGO_IDLE_THREAD_BLOCK;
+                sleepFor(kRetryInterval);
+            }
+        }
+    });
+}
+
+}  // namespace mongo
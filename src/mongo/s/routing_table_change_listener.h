@@ -0,0 +1,68 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include "mongo/db/service_context.h"
+#include "mongo/stdx/thread.h"
+
+namespace mongo {
+
+/**
+ * Keeps the routing table cache of a router up to date with the routing table changes the config
+ * server commits, by long-polling the config server for them with _configsvrGetRoutingTableChanges
+ * and refreshing the affected collections which the router has already cached. Otherwise a router
+ * only finds out that a collection's routing table changed when a shard rejects one of its
+ * requests as stale.
+ *
+ * Only runs while featureFlagRoutingTableChangeNotifications and the
+ * routingTableChangeListenerEnabled server parameter are both enabled.
+ */
+class RoutingTableChangeListener {
+    RoutingTableChangeListener(const RoutingTableChangeListener&) = delete;
+    RoutingTableChangeListener& operator=(const RoutingTableChangeListener&) = delete;
+
+public:
+    RoutingTableChangeListener() = default;
+    ~RoutingTableChangeListener() = default;
+
+    static RoutingTableChangeListener& get(ServiceContext* serviceContext);
+
+    /**
+     * Starts polling the config server for routing table changes on a dedicated thread, which
+     * keeps doing so until shutdown. Must be called at most once.
+     */
+    void startPeriodicThread(ServiceContext* serviceContext);
+
+private:
+    // Polls the config server and applies the changes it returns, once started.
+    stdx::thread _thread;
+};
+
+}  // namespace mongo
@@ -0,0 +1,199 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/s/topology_subscription.h"
+
+#include <mutex>
+#include <utility>
+
+#include "mongo/base/error_codes.h"
+#include "mongo/base/status.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/oid.h"
+#include "mongo/logv2/log.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/decorable.h"
+#include "mongo/util/str.h"
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kNetwork
+
+namespace mongo {
+namespace {
+
+const auto getTopologySubscription = ServiceContext::declareDecoration<TopologySubscription>();
+
+}  // namespace
+
+/**
+ * Forwards the notifications of the ReplicaSetMonitors to the TopologySubscription.
+ */
+class TopologySubscription::Listener final : public ReplicaSetChangeNotifier::Listener {
+public:
+    explicit Listener(TopologySubscription* subscription) : _subscription(subscription) {}
+
+    void onFoundSet(const Key& key) noexcept final {}
+
+    void onPossibleSet(const State& state) noexcept final {
+        _subscription->_update(state.connStr.getSetName(), state);
+    }
+
+    void onConfirmedSet(const State& state) noexcept final {
+        _subscription->_update(state.connStr.getSetName(), state);
+    }
+
+    void onDroppedSet(const Key& key) noexcept final {
+        _subscription->_update(key, boost::none);
+    }
+
+private:
+    TopologySubscription* const _subscription;
+};
+
+TopologySubscription* TopologySubscription::get(ServiceContext* service) {
+    return &getTopologySubscription(service);
+}
+
+TopologySubscription* TopologySubscription::get(OperationContext* opCtx) {
+    return get(opCtx->getServiceContext());
+}
+
+TopologySubscription::TopologySubscription()
+    : _topologyVersion(OID::gen(), 0), _promise(std::make_shared<SharedPromise<void>>()) {}
+
+void TopologySubscription::startListening(ReplicaSetChangeNotifier& notifier) {
+    invariant(!_listener);
+    _listener = notifier.makeListener<Listener>(this);
+}
+
+BSONObj TopologySubscription::awaitTopology(
+    OperationContext* opCtx,
+    const boost::optional<TopologyVersion>& clientTopologyVersion,
+    boost::optional<Date_t> deadline) {
+    stdx::unique_lock lk(_mutex);
+
+    if (!clientTopologyVersion ||
+        clientTopologyVersion->getProcessId() != _topologyVersion.getProcessId() ||
+        clientTopologyVersion->getCounter() < _topologyVersion.getCounter()) {
+        return _getSerializedTopology(lk);
+    }
+    uassert(9886615,
+            str::stream() << "Received a topology version with counter: "
+                          << clientTopologyVersion->getCounter()
+                          << " which is greater than the topology subscription counter: "
+                          << _topologyVersion.getCounter(),
+            clientTopologyVersion->getCounter() == _topologyVersion.getCounter());
+    invariant(deadline);
+
+    auto future = _promise->getFuture();
+    lk.unlock();
+
+    try {
+        opCtx->runWithDeadline(
+            *deadline, ErrorCodes::ExceededTimeLimit, [&] { future.get(opCtx); });
+    } catch (const ExceptionFor<ErrorCodes::ExceededTimeLimit>&) {
+        // Like an awaitable hello, respond with the unchanged topology once the deadline passes.
+        LOGV2_DEBUG(9886616, 2, "Topology subscription request reached its deadline");
+    }
+
+    lk.lock();
+    return _getSerializedTopology(lk);
+}
+
+TopologyVersion TopologySubscription::getTopologyVersion() const {
+    stdx::lock_guard lk(_mutex);
+    return _topologyVersion;
+}
+
+void TopologySubscription::_update(const std::string& setName,
+                                   boost::optional<ReplicaSetChangeNotifier::State> state) {
+    stdx::lock_guard lk(_mutex);
+
+    auto it = _replicaSets.find(setName);
+    if (!state) {
+        if (it == _replicaSets.end()) {
+            return;
+        }
+        _replicaSets.erase(it);
+    } else if (it == _replicaSets.end()) {
+        _replicaSets.emplace(setName, std::move(*state));
+    } else {
+        const bool changed = it->second.connStr.toString() != state->connStr.toString() ||
+            it->second.primary != state->primary || it->second.passives != state->passives;
+        it->second = std::move(*state);
+        if (!changed) {
+            return;
+        }
+    }
+
+    _topologyVersion.setCounter(_topologyVersion.getCounter() + 1);
+    _serializedTopology.reset();
+
+    _promise->emplaceValue();
+    _promise = std::make_shared<SharedPromise<void>>();
+}
+
+BSONObj TopologySubscription::_getSerializedTopology(WithLock) {
+    if (_serializedTopology) {
+        return *_serializedTopology;
+    }
+
+    BSONObjBuilder builder;
+    {
+        BSONObjBuilder topologyVersionBuilder(builder.subobjStart("topologyVersion"));
+        _topologyVersion.serialize(&topologyVersionBuilder);
+    }
+
+    BSONArrayBuilder replicaSetsBuilder(builder.subarrayStart("replicaSets"));
+    for (const auto& [setName, state] : _replicaSets) {
+        BSONObjBuilder setBuilder(replicaSetsBuilder.subobjStart());
+        setBuilder.append("setName", setName);
+
+        BSONArrayBuilder hostsBuilder(setBuilder.subarrayStart("hosts"));
+        for (const auto& host : state.connStr.getServers()) {
+            hostsBuilder.append(host.toString());
+        }
+        hostsBuilder.doneFast();
+
+        if (!state.primary.empty()) {
+            setBuilder.append("primary", state.primary.toString());
+        }
+
+        BSONArrayBuilder passivesBuilder(setBuilder.subarrayStart("passives"));
+        for (const auto& host : state.passives) {
+            passivesBuilder.append(host.toString());
+        }
+        passivesBuilder.doneFast();
+    }
+    replicaSetsBuilder.doneFast();
+
+    _serializedTopology = builder.obj();
+    return *_serializedTopology;
+}
+
+}  // namespace mongo
@@ -0,0 +1,119 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <boost/optional/optional.hpp>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "mongo/bson/bsonobj.h"
+#include "mongo/client/replica_set_change_notifier.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/service_context.h"
+#include "mongo/rpc/topology_version_gen.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/util/concurrency/with_lock.h"
+#include "mongo/util/future.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+
+/**
+ * Multiplexes the topology of every replica set monitored by this mongos onto a single awaitable
+ * request, so that a client process can follow all the shards of a cluster through one connection
+ * instead of running an awaitable hello against every host.
+ *
+ * The state of each replica set is taken from the ReplicaSetMonitor notifications mongos already
+ * receives for routing. Every notification increments a TopologyVersion, which clients pass back
+ * in the same way as for the awaitable hello protocol. The serialized topology is built at most
+ * once per version and shared by every request which returns it.
+ */
+class TopologySubscription {
+public:
+    static TopologySubscription* get(ServiceContext* service);
+    static TopologySubscription* get(OperationContext* opCtx);
+
+    TopologySubscription();
+
+    /**
+     * Starts following the replica sets reported to 'notifier'. Must be called at most once.
+     */
+    void startListening(ReplicaSetChangeNotifier& notifier);
+
+    /**
+     * Returns the current topology, in the form
+     *
+     *     {topologyVersion: {processId, counter},
+     *      replicaSets: [{setName, hosts, primary, passives}, ...]}
+     *
+     * If 'clientTopologyVersion' is the current version, first waits until the topology changes
+     * or 'deadline' passes, whichever comes first. Returns immediately if 'clientTopologyVersion'
+     * is not set, is older, or comes from another process.
+     */
+    BSONObj awaitTopology(OperationContext* opCtx,
+                          const boost::optional<TopologyVersion>& clientTopologyVersion,
+                          boost::optional<Date_t> deadline);
+
+    TopologyVersion getTopologyVersion() const;
+
+private:
+    class Listener;
+
+    /**
+     * Records the new state of a replica set, or its removal if 'state' is not set. Wakes up every
+     * waiting request if the hosts or the primary of the set changed.
+     */
+    void _update(const std::string& setName,
+                 boost::optional<ReplicaSetChangeNotifier::State> state);
+
+    /**
+     * Returns the serialized topology for the current version, building it if needed.
+     */
+    BSONObj _getSerializedTopology(WithLock);
+
+    mutable stdx::mutex _mutex;
+
+    TopologyVersion _topologyVersion;
+
+    // Last known state of each replica set, ordered by set name so that the serialized topology
+    // does not depend on the order of notifications.
+    std::map<std::string, ReplicaSetChangeNotifier::State> _replicaSets;
+
+    // Serialized form of the current version, reset whenever the version changes.
+    boost::optional<BSONObj> _serializedTopology;
+
+    // Fulfilled and replaced whenever the version changes.
+    std::shared_ptr<SharedPromise<void>> _promise;
+
+    std::shared_ptr<Listener> _listener;
+};
+
+}  // namespace mongo
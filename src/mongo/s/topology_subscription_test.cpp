@@ -0,0 +1,231 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <memory>
+#include <set>
+#include <vector>
+
+#include <boost/none.hpp>
+
+#include "mongo/base/error_codes.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/oid.h"
+#include "mongo/client/connection_string.h"
+#include "mongo/client/replica_set_change_notifier.h"
+#include "mongo/db/client.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/service_context_test_fixture.h"
+#include "mongo/rpc/topology_version_gen.h"
+#include "mongo/s/topology_subscription.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/framework.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/clock_source_mock.h"
+#include "mongo/util/net/hostandport.h"
+#include "mongo/util/time_support.h"
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kTest
+
+namespace mongo {
+namespace {
+
+class TopologySubscriptionTest : public ServiceContextTest {
+public:
+    void setUp() override {
+        // The fast clock is used by OperationContext::hasDeadlineExpired.
+        getServiceContext()->setFastClockSource(
+            std::make_unique<SharedClockSourceAdapter>(_clkSource));
+        // The precise clock is used by waitForConditionOrInterruptNoAssertUntil.
+        getServiceContext()->setPreciseClockSource(
+            std::make_unique<SharedClockSourceAdapter>(_clkSource));
+
+        subscription()->startListening(_notifier);
+    }
+
+protected:
+    TopologySubscription* subscription() {
+        return TopologySubscription::get(getServiceContext());
+    }
+
+    ReplicaSetChangeNotifier& notifier() {
+        return _notifier;
+    }
+
+    void confirmSet(StringData connStr, StringData primary) {
+        _notifier.onConfirmedSet(
+            uassertStatusOK(ConnectionString::parse(connStr.toString())),
+            HostAndPort(primary),
+            std::set<HostAndPort>{});
+    }
+
+    void advanceTime(Milliseconds millis) {
+        _clkSource->advance(millis);
+    }
+
+    Date_t now() {
+        return _clkSource->now();
+    }
+
+private:
+    ReplicaSetChangeNotifier _notifier;
+    std::shared_ptr<ClockSourceMock> _clkSource = std::make_shared<ClockSourceMock>();
+};
+
+TEST_F(TopologySubscriptionTest, TopologyVersionCounterInitializedAtStartup) {
+    ASSERT_EQ(0, subscription()->getTopologyVersion().getCounter());
+
+    auto opCtx = makeOperationContext();
+    auto topology = subscription()->awaitTopology(opCtx.get(), boost::none, boost::none);
+    ASSERT_BSONOBJ_EQ(BSON("topologyVersion"
+                           << subscription()->getTopologyVersion().toBSON() << "replicaSets"
+                           << BSONArray()),
+                      topology);
+}
+
+TEST_F(TopologySubscriptionTest, ConfirmedSetIncrementsTopologyVersion) {
+    confirmSet("rs0/a:1,b:1", "a:1");
+    ASSERT_EQ(1, subscription()->getTopologyVersion().getCounter());
+
+    auto opCtx = makeOperationContext();
+    auto topology = subscription()->awaitTopology(opCtx.get(), boost::none, boost::none);
+    ASSERT_BSONOBJ_EQ(BSON("topologyVersion"
+                           << subscription()->getTopologyVersion().toBSON() << "replicaSets"
+                           << BSON_ARRAY(BSON("setName"
+                                              << "rs0"
+                                              << "hosts" << BSON_ARRAY("a:1" << "b:1")
+                                              << "primary"
+                                              << "a:1"
+                                              << "passives" << BSONArray()))),
+                      topology);
+}
+
+TEST_F(TopologySubscriptionTest, UnchangedSetDoesNotIncrementTopologyVersion) {
+    confirmSet("rs0/a:1,b:1", "a:1");
+    confirmSet("rs0/a:1,b:1", "a:1");
+    ASSERT_EQ(1, subscription()->getTopologyVersion().getCounter());
+
+    // A new primary is a change.
+    confirmSet("rs0/a:1,b:1", "b:1");
+    ASSERT_EQ(2, subscription()->getTopologyVersion().getCounter());
+}
+
+TEST_F(TopologySubscriptionTest, DroppedSetIsRemoved) {
+    confirmSet("rs0/a:1", "a:1");
+    confirmSet("rs1/b:1", "b:1");
+    notifier().onDroppedSet("rs0");
+    ASSERT_EQ(3, subscription()->getTopologyVersion().getCounter());
+
+    auto opCtx = makeOperationContext();
+    auto replicaSets =
+        subscription()->awaitTopology(opCtx.get(), boost::none, boost::none)["replicaSets"].Obj();
+    ASSERT_EQ(1, replicaSets.nFields());
+    ASSERT_EQ("rs1", replicaSets.firstElement()["setName"].str());
+}
+
+TEST_F(TopologySubscriptionTest, RequestsShareTheSerializedTopology) {
+    confirmSet("rs0/a:1,b:1", "a:1");
+
+    auto opCtx = makeOperationContext();
+    auto first = subscription()->awaitTopology(opCtx.get(), boost::none, boost::none);
+    auto second = subscription()->awaitTopology(opCtx.get(), boost::none, boost::none);
+    ASSERT_EQ(first.objdata(), second.objdata());
+
+    // A new version is serialized again.
+    confirmSet("rs0/a:1,b:1", "b:1");
+    auto third = subscription()->awaitTopology(opCtx.get(), boost::none, boost::none);
+    ASSERT_NE(first.objdata(), third.objdata());
+}
+
+TEST_F(TopologySubscriptionTest, ErrorsWithHigherCounterAndSameProcessId) {
+    auto opCtx = makeOperationContext();
+    auto currentTopologyVersion = subscription()->getTopologyVersion();
+    auto higherTopologyVersion = TopologyVersion(currentTopologyVersion.getProcessId(),
+                                                 currentTopologyVersion.getCounter() + 1);
+    ASSERT_THROWS_CODE(
+        subscription()->awaitTopology(opCtx.get(), higherTopologyVersion, now() + Seconds(5)),
+        AssertionException,
+        9886615);
+}
+
+TEST_F(TopologySubscriptionTest, ReturnsImmediatelyWithDifferentProcessId) {
+    confirmSet("rs0/a:1", "a:1");
+
+    auto opCtx = makeOperationContext();
+    auto otherTopologyVersion =
+        TopologyVersion(OID::gen(), subscription()->getTopologyVersion().getCounter());
+    auto topology =
+        subscription()->awaitTopology(opCtx.get(), otherTopologyVersion, now() + Seconds(5));
+    ASSERT_BSONOBJ_EQ(subscription()->getTopologyVersion().toBSON(),
+                      topology["topologyVersion"].Obj());
+}
+
+TEST_F(TopologySubscriptionTest, ReturnsCurrentTopologyVersionOnTimeOut) {
+    auto maxAwaitTime = Milliseconds(5000);
+    auto deadline = now() + maxAwaitTime;
+    auto currentTopologyVersion = subscription()->getTopologyVersion();
+
+    stdx::thread awaitThread([&] {
+        Client::setCurrent(getServiceContext()->getService()->makeClient("awaitThread"));
+        auto threadOpCtx = cc().makeOperationContext();
+        auto topology =
+            subscription()->awaitTopology(threadOpCtx.get(), currentTopologyVersion, deadline);
+        ASSERT_BSONOBJ_EQ(currentTopologyVersion.toBSON(), topology["topologyVersion"].Obj());
+    });
+
+    advanceTime(maxAwaitTime);
+    awaitThread.join();
+}
+
+TEST_F(TopologySubscriptionTest, TopologyChangeWakesUpWaitingRequests) {
+    auto currentTopologyVersion = subscription()->getTopologyVersion();
+
+    // Whether the change happens before or while a request waits, each returns the new topology.
+    std::vector<stdx::thread> awaitThreads;
+    for (int i = 0; i < 3; ++i) {
+        awaitThreads.emplace_back([&] {
+            Client::setCurrent(getServiceContext()->getService()->makeClient("awaitThread"));
+            auto threadOpCtx = cc().makeOperationContext();
+            auto topology = subscription()->awaitTopology(
+                threadOpCtx.get(), currentTopologyVersion, Date_t::max());
+            ASSERT_EQ(currentTopologyVersion.getCounter() + 1,
+                      topology["topologyVersion"]["counter"].numberLong());
+            ASSERT_EQ(1, topology["replicaSets"].Obj().nFields());
+        });
+    }
+
+    confirmSet("rs0/a:1", "a:1");
+    for (auto& awaitThread : awaitThreads) {
+        awaitThread.join();
+    }
+}
+
+}  // namespace
+}  // namespace mongo